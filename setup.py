@@ -92,11 +92,21 @@ uncalled = Extension(
        "src/map_pool.cpp",
        "src/event_detector.cpp", 
        "src/read_buffer.cpp",
+       "src/squiggle_sim.cpp",
+       "src/paf_writer.cpp",
        "src/chunk.cpp",
+       "src/chunk_trace.cpp",
+       "src/index_presets.cpp",
+       "src/index_builder.cpp",
+       "src/kmer_masker.cpp",
+       "src/suffix_sorter.cpp",
+       "src/signal_sketch.cpp",
        "src/realtime_pool.cpp",
+       "src/map_engine.cpp",
        "src/seed_tracker.cpp", 
        "src/normalizer.cpp", 
-       "src/range.cpp"
+       "src/range.cpp",
+       "src/numa.cpp"
     ],
 
     include_dirs = [
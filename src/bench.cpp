@@ -0,0 +1,678 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <cfloat>
+#include <unistd.h>
+#include <pdqsort.h>
+#include "mapper.hpp"
+#include "squiggle_sim.hpp"
+#include "seed_tracker.hpp"
+#include "numa.hpp"
+
+//Microbenchmarks of the mapping hot path
+//Inputs are generated from a fixed seed, so numbers are comparable 
+//between builds. Each benchmark is repeated and reported as the median
+//(and min/max) nanoseconds per operation. Index benchmarks only run if
+//a BWA prefix is given.
+
+typedef struct {
+    u32 reps, scale, seed;
+    std::string filter, bwa_prefix;
+} BenchParams;
+
+const BenchParams BENCH_PRMS_DEF = {
+    reps       : 5,
+    scale      : 1,
+    seed       : 1,
+    filter     : "",
+    bwa_prefix : ""
+};
+
+BenchParams PRMS = BENCH_PRMS_DEF;
+
+//Results are added here so the compiler can't skip benchmarked code
+volatile float SINK = 0;
+
+//Resolutions of PoreModel::init_prob_lut compared to match_prob
+const std::vector<u32> LUT_BINS = {1024, 2048, 4096};
+
+//Events scored per read by the sketch prefilter, and signal noise of 
+//reads simulated for it as a multiple of the model stdv
+const u32 SKETCH_EVENTS = 300;
+const std::vector<float> SKETCH_NOISE = {1.0, 1.25};
+
+//Lowest threshold used when no index is loaded, and thresholds to check
+//for probabilities that fall on the other side with a table
+const float LUT_MIN_PROB = -10;
+const std::vector<float> LUT_THRESHES = {-2, -3.75, -6, -8, -10};
+
+void print_header() {
+    std::cout << "bench\tparam\tops\tns_per_op\tmin_ns\tmax_ns\n";
+}
+
+void print_result(const std::string &name, const std::string &param,
+                  u64 ops, std::vector<double> ns) {
+    if (ns.empty()) return;
+    std::sort(ns.begin(), ns.end());
+    std::cout << name << "\t" 
+              << (param.empty() ? "-" : param) << "\t" 
+              << ops << "\t" 
+              << std::fixed << std::setprecision(2)
+              << ns[ns.size() / 2] << "\t" 
+              << ns.front() << "\t" 
+              << ns.back() << "\n";
+    std::cout.unsetf(std::ios::fixed);
+}
+
+bool selected(const std::string &name) {
+    return PRMS.filter.empty() || name.find(PRMS.filter) != std::string::npos;
+}
+
+//Runs body PRMS.reps times. body returns the number of operations it 
+//performed, and adds the time spent on them (ms) to its argument so 
+//setup can be excluded
+template <typename F>
+void run_bench(const std::string &name, const std::string &param, F body) {
+    if (!selected(name)) return;
+
+    std::vector<double> ns;
+    u64 ops = 0;
+    for (u32 r = 0; r < PRMS.reps; r++) {
+        double ms = 0;
+        ops = body(ms);
+        if (ops > 0) ns.push_back(ms * 1e6 / ops);
+    }
+
+    print_result(name, param, ops, ns);
+}
+
+//Friend of Mapper, for benchmarks of its private steps
+class MapperBench {
+    public:
+
+    //Time per map_next() call, binned by number of paths before the call
+    static void map_next(const std::string &NAME, std::vector<ReadBuffer> &reads) {
+        const std::vector<u32> BINS = {10, 100, 1000, 10000};
+        if (!selected(NAME)) return;
+
+        std::vector< std::vector<double> > ns(BINS.size()+1);
+        std::vector<u64> ops(BINS.size()+1);
+
+        Mapper mapper;
+
+        for (u32 r = 0; r < PRMS.reps; r++) {
+            std::vector<double> ms(BINS.size()+1, 0);
+            std::fill(ops.begin(), ops.end(), 0);
+
+            for (ReadBuffer read : reads) {
+                mapper.new_read(read);
+                mapper.norm_.set_signal(
+                    mapper.evdt_.get_means(mapper.read_.full_signal_));
+
+                bool done = false;
+                while (!done) {
+                    u32 paths = 0;
+                    for (auto &s : mapper.searches_) paths += s.prev_size_;
+
+                    u32 b = 0;
+                    while (b < BINS.size() && paths >= BINS[b]) b++;
+
+                    Timer t;
+                    done = mapper.map_next();
+                    ms[b] += t.get();
+                    ops[b]++;
+                }
+                mapper.deactivate();
+            }
+
+            for (u32 b = 0; b < ms.size(); b++) {
+                if (ops[b] > 0) ns[b].push_back(ms[b] * 1e6 / ops[b]);
+            }
+        }
+
+        for (u32 b = 0; b < ns.size(); b++) {
+            std::string param = b < BINS.size() ? 
+                "paths<" + std::to_string(BINS[b]) : 
+                "paths>=" + std::to_string(BINS.back());
+            print_result(NAME, param, ops[b], ns[b]);
+        }
+    }
+
+    //How a read was mapped, to compare mapping decisions between builds
+    typedef struct {
+        std::string paf;
+        i32 state;
+        u32 events;
+    } MapOutcome;
+
+    //Same decision if both failed, or both mapped to overlapping
+    //locations on the same strand of the same reference
+    static bool same_decision(const MapOutcome &a, const MapOutcome &b) {
+        if (a.state != b.state) return false;
+        if (a.state != (i32) Mapper::State::SUCCESS) return true;
+
+        std::istringstream as(a.paf), bs(b.paf);
+        std::string rd, strand[2], ref[2];
+        u64 len, st[2], en[2];
+        as >> rd >> len >> len >> len >> strand[0] >> ref[0] >> len >> st[0] >> en[0];
+        bs >> rd >> len >> len >> len >> strand[1] >> ref[1] >> len >> st[1] >> en[1];
+
+        return strand[0] == strand[1] && ref[0] == ref[1] && 
+               st[0] < en[1] && st[1] < en[0];
+    }
+
+    //Maps each read to completion, adding the time spent to ms
+    static std::vector<MapOutcome> map_outcomes(std::vector<ReadBuffer> &reads,
+                                                double &ms) {
+        std::vector<MapOutcome> outcomes;
+        Mapper mapper;
+
+        for (ReadBuffer read : reads) {
+            mapper.new_read(read);
+            mapper.norm_.set_signal(
+                mapper.evdt_.get_means(mapper.read_.full_signal_));
+
+            Timer t;
+            while (!mapper.map_next());
+            ms += t.get();
+
+            MapOutcome o = {"", (i32) mapper.state_, mapper.event_i_};
+            mapper.read_.loc_.write_text(o.paf);
+            outcomes.push_back(o);
+
+            mapper.deactivate();
+        }
+
+        return outcomes;
+    }
+
+    //map_outcomes() with the fastest time of PRMS.reps
+    static std::vector<MapOutcome> fastest_outcomes(std::vector<ReadBuffer> &reads,
+                                                    double &ms) {
+        std::vector<MapOutcome> outcomes;
+        ms = DBL_MAX;
+        for (u32 r = 0; r < PRMS.reps; r++) {
+            double rep_ms = 0;
+            outcomes = map_outcomes(reads, rep_ms);
+            ms = std::min(ms, rep_ms);
+        }
+        return outcomes;
+    }
+
+    //Reads mapped by tables of each resolution with a different decision 
+    //or number of events than with match_prob, and the time to map all 
+    //reads relative to match_prob (fastest of PRMS.reps). map_next() is
+    //then timed as above
+    static void prob_lut(std::vector<ReadBuffer> &reads) {
+        if (!selected("mapper_map_next_lut")) return;
+
+        PoreModel<KLEN> exact = Mapper::model;
+
+        double exact_ms;
+        std::vector<MapOutcome> expected = fastest_outcomes(reads, exact_ms);
+        u64 events = 0;
+        for (auto &o : expected) events += o.events;
+
+        for (u32 bins : LUT_BINS) {
+            Mapper::PRMS.prob_lut_bins = bins;
+            Mapper::load_prob_lut();
+
+            double lut_ms;
+            std::vector<MapOutcome> outcomes = fastest_outcomes(reads, lut_ms);
+
+            u32 decisions = 0, changed = 0;
+            for (u32 i = 0; i < reads.size(); i++) {
+                decisions += !same_decision(outcomes[i], expected[i]);
+                changed += outcomes[i].events != expected[i].events ||
+                           outcomes[i].paf != expected[i].paf;
+            }
+
+            std::cerr << "prob_lut " << bins << " bins: " << decisions 
+                      << " of " << reads.size() << " reads with a different "
+                      << "decision, " << changed << " mapped differently, " 
+                      << std::fixed << std::setprecision(2)
+                      << (exact_ms * 1e6 / events) << " -> " 
+                      << (lut_ms * 1e6 / events) << " ns per event (" 
+                      << (exact_ms / lut_ms) << "x)\n";
+            std::cerr.unsetf(std::ios::fixed);
+
+            map_next("mapper_map_next_lut" + std::to_string(bins), reads);
+        }
+
+        Mapper::PRMS.prob_lut_bins = 0;
+        Mapper::model = exact;
+    }
+
+    //Sketch prefilter against mapping without it, for reads simulated 
+    //from the reference (on target) and from random sequence (off target)
+    //at each noise level. Scoring is timed per event up to SKETCH_EVENTS,
+    //to compare with map_next(), and reports give the reads ended by the sketch, 
+    //mapped reads lost, and the time to map all reads with and without 
+    //it (fastest of PRMS.reps). Needs <bwa_prefix>.sketch
+    static void sketch(u32 count) {
+        if (!selected("mapper_sketch")) return;
+
+        Mapper::PRMS.sketch_events = SKETCH_EVENTS;
+        Mapper::load_sketch();
+        if (!Mapper::sketch.is_scoring()) {
+            Mapper::PRMS.sketch_events = 0;
+            return;
+        }
+
+        //Swapped in only while mapping with the prefilter
+        SignalSketch sketch;
+        std::swap(sketch, Mapper::sketch);
+
+        for (float noise : SKETCH_NOISE) {
+            for (bool off_target : {false, true}) {
+                SquiggleSim::Params sim_prms = SquiggleSim::PRMS_DEF;
+                sim_prms.seed = PRMS.seed;
+                sim_prms.bwa_prefix = PRMS.bwa_prefix;
+                sim_prms.noise = noise;
+                sim_prms.off_target = off_target;
+
+                std::vector<ReadBuffer> reads;
+                {
+                    SquiggleSim sim(sim_prms);
+                    Paf truth;
+                    while (reads.size() < count) {
+                        reads.push_back(sim.next_read(truth));
+                    }
+                }
+
+                std::ostringstream param;
+                param << (off_target ? "off" : "on") << ",noise=" << noise;
+
+                Mapper mapper;
+                run_bench("mapper_sketch_add", param.str(), [&](double &ms) {
+                    SignalSketch::Scorer scorer;
+                    u64 events = 0;
+                    for (ReadBuffer read : reads) {
+                        mapper.new_read(read);
+                        mapper.norm_.set_signal(
+                            mapper.evdt_.get_means(mapper.read_.full_signal_));
+
+                        std::vector<float> levels;
+                        while (!mapper.norm_.empty() && 
+                               levels.size() < Mapper::PRMS.sketch_events) {
+                            levels.push_back(mapper.norm_.pop());
+                        }
+                        mapper.deactivate();
+
+                        scorer.reset();
+                        Timer t;
+                        for (float e : levels) scorer.add(sketch, e);
+                        ms += t.get();
+                        events += levels.size();
+                    }
+                    return events;
+                });
+
+                double base_ms, sketch_ms;
+                std::vector<MapOutcome> base = fastest_outcomes(reads, base_ms);
+
+                std::swap(sketch, Mapper::sketch);
+                std::vector<MapOutcome> outcomes = fastest_outcomes(reads, sketch_ms);
+                std::swap(sketch, Mapper::sketch);
+
+                //Reads ended by the sketch never search the index
+                u32 ended = 0, mapped = 0, lost = 0;
+                u64 events = 0;
+                for (u32 i = 0; i < reads.size(); i++) {
+                    ended += outcomes[i].events == 0;
+                    events += base[i].events;
+                    if (base[i].state == (i32) Mapper::State::SUCCESS) {
+                        mapped++;
+                        lost += !same_decision(outcomes[i], base[i]);
+                    }
+                }
+
+                std::cerr << "sketch " << param.str() << ": " << ended 
+                          << " of " << reads.size() << " reads ended, " 
+                          << lost << " of " << mapped << " mapped reads lost, "
+                          << std::fixed << std::setprecision(2)
+                          << (base_ms * 1e6 / events) << " ns per map_next, "
+                          << "all reads " << base_ms << " -> " << sketch_ms 
+                          << " ms (" << (base_ms / sketch_ms) << "x)\n";
+                std::cerr.unsetf(std::ios::fixed);
+            }
+        }
+
+        Mapper::PRMS.sketch_events = 0;
+    }
+
+    //pdqsort of paths by FM range, as done for each event
+    //32-bit paths are used for indexes under 2^32 bases
+    template <typename FmCoord>
+    static void sort_paths(const std::string &name, u32 count) {
+        std::mt19937 rng(PRMS.seed);
+        std::uniform_int_distribution<u64> loc(0, 1000000000);
+        std::uniform_int_distribution<u32> kmer(0, kmer_count<KLEN>()-1);
+        std::uniform_real_distribution<float> prob(-10, 0);
+
+        std::vector< Mapper::PathBuffer<FmCoord> > paths(count);
+        for (auto &p : paths) {
+            u64 st = loc(rng);
+            RangeT<FmCoord> r(st, st + (st % 8));
+            p.make_source(r, kmer(rng), prob(rng));
+        }
+
+        run_bench(name, std::to_string(count), [&](double &ms) {
+            u32 n = 100;
+            for (u32 i = 0; i < n; i++) {
+                std::shuffle(paths.begin(), paths.end(), rng);
+                Timer t;
+                pdqsort(paths.begin(), paths.end());
+                ms += t.get();
+            }
+            return (u64) n * count;
+        });
+
+        for (auto &p : paths) p.free_buffers();
+    }
+};
+
+void bench_signal(const std::vector<float> &signal) {
+    EventDetector evdt(Mapper::PRMS.event_prms);
+
+    run_bench("evdt_add_sample", "", [&](double &ms) {
+        evdt.reset();
+        Timer t;
+        float sum = 0;
+        for (float s : signal) {
+            if (evdt.add_sample(s)) sum += evdt.get_event().mean;
+        }
+        ms += t.get();
+        SINK = sum;
+        return (u64) signal.size();
+    });
+
+    evdt.reset();
+    std::vector<float> events = evdt.get_means(signal);
+
+    Normalizer norm(Mapper::PRMS.norm_prms);
+
+    run_bench("norm_push_pop", "", [&](double &ms) {
+        norm.reset();
+        Timer t;
+        float sum = 0;
+        for (float e : events) {
+            if (!norm.push(e)) {
+                sum += norm.pop();
+                norm.push(e);
+            }
+        }
+        while (!norm.empty()) sum += norm.pop();
+        ms += t.get();
+        SINK = sum;
+        return (u64) events.size();
+    });
+
+    norm.set_signal(events);
+    std::vector<float> norm_events;
+    while (!norm.empty()) norm_events.push_back(norm.pop());
+
+    //Scores every k-mer for each event, the most Mapper::kmer_prob computes
+    std::vector<float> kmer_probs(kmer_count<KLEN>());
+    run_bench("model_match_prob", "", [&](double &ms) {
+        Timer t;
+        for (float e : norm_events) {
+            for (u32 k = 0; k < kmer_probs.size(); k++) {
+                kmer_probs[k] = Mapper::model.match_prob(e, k);
+            }
+            SINK = kmer_probs[0];
+        }
+        ms += t.get();
+        return (u64) norm_events.size() * kmer_probs.size();
+    });
+
+    //Scores scattered k-mers for each event, like the paths of a read
+    const u32 PATH_KMERS = 256;
+    std::mt19937 rng(PRMS.seed);
+    std::uniform_int_distribution<u32> rand_kmer(0, kmer_count<KLEN>()-1);
+    std::vector<u32> path_kmers(norm_events.size() + PATH_KMERS);
+    for (u32 &k : path_kmers) k = rand_kmer(rng);
+
+    run_bench("model_match_prob_rand", "", [&](double &ms) {
+        Timer t;
+        float sum = 0;
+        for (u32 i = 0; i < norm_events.size(); i++) {
+            for (u32 j = i; j < i + PATH_KMERS; j++) {
+                sum += Mapper::model.match_prob(norm_events[i], path_kmers[j]);
+            }
+        }
+        ms += t.get();
+        SINK = sum;
+        return (u64) norm_events.size() * PATH_KMERS;
+    });
+
+    //Same scores read from precomputed tables, and how much they differ
+    for (u32 bins : LUT_BINS) {
+        PoreModel<KLEN> model = Mapper::model;
+        model.init_prob_lut(bins, model.get_window(LUT_MIN_PROB));
+
+        run_bench("model_prob_lut_rand", std::to_string(bins), [&](double &ms) {
+            Timer t;
+            float sum = 0;
+            for (u32 i = 0; i < norm_events.size(); i++) {
+                const float *row = model.get_prob_row(norm_events[i]);
+                for (u32 j = i; j < i + PATH_KMERS; j++) {
+                    sum += row[path_kmers[j]];
+                }
+            }
+            ms += t.get();
+            SINK = sum;
+            return (u64) norm_events.size() * PATH_KMERS;
+        });
+
+        //Error only matters where the exact probability could pass
+        float max_err = 0;
+        std::vector<u64> flips(LUT_THRESHES.size(), 0);
+        for (float e : norm_events) {
+            const float *row = model.get_prob_row(e);
+            for (u32 k = 0; k < kmer_probs.size(); k++) {
+                float exact = model.match_prob(e, k);
+                if (exact >= LUT_MIN_PROB) {
+                    max_err = std::max(max_err, std::abs(exact - row[k]));
+                }
+                for (u32 i = 0; i < LUT_THRESHES.size(); i++) {
+                    flips[i] += (exact >= LUT_THRESHES[i]) != (row[k] >= LUT_THRESHES[i]);
+                }
+            }
+        }
+
+        std::cerr << "prob_lut " << bins << " bins: max error " << max_err;
+        for (u32 i = 0; i < LUT_THRESHES.size(); i++) {
+            std::cerr << ", " << flips[i] << " flipped at " << LUT_THRESHES[i];
+        }
+        std::cerr << " (of " << norm_events.size() * kmer_probs.size() << ")\n";
+    }
+}
+
+void bench_seeds(u32 count) {
+    SeedTracker tracker(Mapper::PRMS.seed_prms);
+
+    //Mostly random seeds, with some from a true location every read
+    const u32 READ_EVENTS = 1000;
+    std::mt19937 rng(PRMS.seed);
+    std::uniform_int_distribution<u64> loc(0, 1000000000);
+    std::bernoulli_distribution on_target(0.2);
+
+    std::vector<u64> ref_ens(count);
+    u64 true_loc = 0;
+    for (u32 i = 0; i < count; i++) {
+        if (i % READ_EVENTS == 0) true_loc = loc(rng);
+        u32 e = i % READ_EVENTS;
+        ref_ens[i] = on_target(rng) ? true_loc + e / 2 : loc(rng);
+    }
+
+    run_bench("seeds_add_seed", "", [&](double &ms) {
+        Timer t;
+        for (u32 i = 0; i < count; i++) {
+            if (i % READ_EVENTS == 0) tracker.reset();
+            tracker.add_seed(ref_ens[i], Mapper::PRMS.seed_len, 
+                             i % READ_EVENTS);
+        }
+        ms += t.get();
+        return (u64) count;
+    });
+}
+
+void bench_index(BwaIndex<KLEN> &fmi, u32 count) {
+    std::mt19937 rng(PRMS.seed);
+    std::uniform_int_distribution<u32> kmer(0, kmer_count<KLEN>()-1);
+    std::uniform_int_distribution<u16> base(0, BASE_COUNT-1);
+    std::uniform_int_distribution<u64> sa_idx(0, fmi.size()-1);
+
+    std::vector<u32> kmers(count / Mapper::PRMS.seed_len + 1);
+    for (auto &k : kmers) k = kmer(rng);
+
+    std::vector<u8> bases(count);
+    for (auto &b : bases) b = base(rng);
+
+    //Extends random kmer ranges by seed_len bases, or until empty
+    run_bench("fmi_get_neighbor", "", [&](double &ms) {
+        u32 b = 0, k = 0;
+        u64 sum = 0;
+        Timer t;
+        while (b < count) {
+            Range r = fmi.get_kmer_range(kmers[k++]);
+            for (u32 i = 0; i < Mapper::PRMS.seed_len && b < count; i++) {
+                r = fmi.get_neighbor(r, bases[b++]);
+                if (!r.is_valid()) break;
+            }
+            sum += r.start_;
+        }
+        ms += t.get();
+        SINK = sum;
+        return (u64) b;
+    });
+
+    u32 sa_count = std::max<u32>(1, count / 10);
+    std::vector<u64> sa_locs(sa_count);
+    for (auto &i : sa_locs) i = sa_idx(rng);
+
+    run_bench("fmi_sa", "", [&](double &ms) {
+        u64 sum = 0;
+        Timer t;
+        for (u64 i : sa_locs) sum += fmi.sa(i);
+        ms += t.get();
+        SINK = sum;
+        return (u64) sa_count;
+    });
+}
+
+void usage() {
+    std::cerr << "Usage: bench [options] [bwa_prefix]\n"
+              << "  -r INT  repetitions of each benchmark [" << BENCH_PRMS_DEF.reps << "]\n"
+              << "  -n INT  input size multiplier [" << BENCH_PRMS_DEF.scale << "]\n"
+              << "  -s INT  random seed for inputs [" << BENCH_PRMS_DEF.seed << "]\n"
+              << "  -b STR  only run benchmarks containing STR\n"
+              << "  -c INT  pin to CPU\n"
+              << "  -p STR  index preset\n";
+}
+
+int main(int argc, char** argv) {
+    int opt;
+    while((opt = getopt(argc, argv, ":r:n:s:b:c:p:")) != -1) {
+        switch(opt) {
+            case 'r': PRMS.reps = std::max(1, atoi(optarg)); break;
+            case 'n': PRMS.scale = std::max(1, atoi(optarg)); break;
+            case 's': PRMS.seed = atoi(optarg); break;
+            case 'b': PRMS.filter = optarg; break;
+            case 'p': Mapper::PRMS.idx_preset = optarg; break;
+
+            case 'c':
+            if (!pin_this_thread({(u16) atoi(optarg)})) {
+                std::cerr << "Warning: failed to pin to CPU " << optarg << "\n";
+            }
+            break;
+
+            case ':':
+            std::cerr << "Error: failed to load flag value\n";
+            usage();
+            return 1;
+
+            case '?':
+            std::cerr << "Error: unknown flag\n";
+            usage();
+            return 1;
+        }
+    }
+
+    if (optind < argc) PRMS.bwa_prefix = argv[optind];
+
+    const u32 SIGNAL_LEN = 1000000 * PRMS.scale,
+              SEED_COUNT = 1000000 * PRMS.scale,
+              FMI_COUNT = 1000000 * PRMS.scale,
+              MAP_READS = 20 * PRMS.scale;
+
+    //Reads are simulated from the reference if an index is given
+    SquiggleSim::Params sim_prms = SquiggleSim::PRMS_DEF;
+    sim_prms.seed = PRMS.seed;
+    sim_prms.bwa_prefix = PRMS.bwa_prefix;
+
+    std::vector<float> signal;
+    std::vector<ReadBuffer> reads;
+    {
+        std::cerr << "Simulating signal\n";
+        SquiggleSim sim(sim_prms);
+        Paf truth;
+        while (signal.size() < SIGNAL_LEN) {
+            ReadBuffer r = sim.next_read(truth);
+            signal.insert(signal.end(), r.get_raw().begin(), r.get_raw().end());
+            if (reads.size() < MAP_READS) reads.push_back(r);
+        }
+        signal.resize(SIGNAL_LEN);
+    }
+
+    print_header();
+
+    bench_signal(signal);
+    bench_seeds(SEED_COUNT);
+    MapperBench::sort_paths<u64>("pdqsort_paths", 1000);
+    MapperBench::sort_paths<u64>("pdqsort_paths", 10000);
+    MapperBench::sort_paths<u32>("pdqsort_paths32", 1000);
+    MapperBench::sort_paths<u32>("pdqsort_paths32", 10000);
+
+    if (PRMS.bwa_prefix.empty()) {
+        std::cerr << "No index given, skipping index benchmarks\n";
+        return 0;
+    }
+
+    std::cerr << "Loading index\n";
+    Mapper::PRMS.bwa_prefix = PRMS.bwa_prefix;
+    Mapper::load_static();
+
+    bench_index(Mapper::indexes_[0].fmi_, FMI_COUNT);
+    MapperBench::map_next("mapper_map_next", reads);
+    MapperBench::prob_lut(reads);
+    MapperBench::sketch(MAP_READS);
+
+    return 0;
+}
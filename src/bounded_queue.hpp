@@ -0,0 +1,123 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _INCL_BOUNDED_QUEUE
+#define _INCL_BOUNDED_QUEUE
+
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include <condition_variable>
+#include "util.hpp"
+
+//Blocking FIFO with a maximum size, safe for any number of producers 
+//and consumers. Once closed, pushes fail and pops drain what is left.
+template <typename T>
+class BoundedQueue {
+    public:
+
+    BoundedQueue(u32 capacity) : 
+        capacity_(capacity > 0 ? capacity : 1), 
+        closed_(false) {}
+
+    //Waits for space, returns false if queue was closed
+    bool push(T &&item) {
+        std::unique_lock<std::mutex> lock(mtx_);
+        not_full_.wait(lock, [this] {
+            return closed_ || items_.size() < capacity_;
+        });
+
+        if (closed_) return false;
+
+        items_.push_back(std::move(item));
+        lock.unlock();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    //Waits for an item, returns false if closed and empty
+    bool pop(T &item) {
+        std::unique_lock<std::mutex> lock(mtx_);
+        not_empty_.wait(lock, [this] {
+            return closed_ || !items_.empty();
+        });
+
+        if (items_.empty()) return false;
+
+        item = std::move(items_.front());
+        items_.pop_front();
+        lock.unlock();
+        not_full_.notify_one();
+        return true;
+    }
+
+    //Moves all items into "out", waiting up to timeout_ms for the first
+    //Returns number of items added
+    u32 pop_all(std::vector<T> &out, u32 timeout_ms) {
+        std::unique_lock<std::mutex> lock(mtx_);
+        not_empty_.wait_for(lock, std::chrono::milliseconds(timeout_ms), 
+                            [this] { return closed_ || !items_.empty(); });
+
+        u32 n = items_.size();
+        for (T &item : items_) {
+            out.push_back(std::move(item));
+        }
+        items_.clear();
+
+        lock.unlock();
+        not_full_.notify_all();
+        return n;
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        closed_ = true;
+        not_full_.notify_all();
+        not_empty_.notify_all();
+    }
+
+    bool is_closed() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return closed_;
+    }
+
+    bool empty() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return items_.empty();
+    }
+
+    u32 size() {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return items_.size();
+    }
+
+    private:
+    u32 capacity_;
+    bool closed_;
+    std::deque<T> items_;
+    std::mutex mtx_;
+    std::condition_variable not_full_, not_empty_;
+};
+
+#endif
@@ -56,18 +56,20 @@ const char BASE_COMP_C[]
 const u8 BASE_COMP_B[] {3, 2, 1, 0};
 
 
-enum KmerLen {k2=2, k3=3, k4=4, k5=5};
+//K-mers are stored as u32, two bits per base, so k can be up to 16
+//(9-mers have 262144 k-mers)
+enum KmerLen {k2=2, k3=3, k4=4, k5=5, k6=6, k7=7, k8=8, k9=9};
 
-#define KMASK(k) ( (1 << (2*k)) - 1 )
+#define KMASK(k) ( (u32) ((1ull << (2*(k))) - 1) )
 
 template <KmerLen k>
-inline u16 kmer_count() {
-    return (u16) pow((u16)BASE_COUNT, (u16)k);
+constexpr u32 kmer_count() {
+    return (u32) 1 << (2 * (u32) k);
 }
 
 template <KmerLen k>
-u16 str_to_kmer(std::string kmer, u64 offset=0) {
-    u16 index = BASE_BYTES[(u8) kmer[offset]];
+u32 str_to_kmer(std::string kmer, u64 offset=0) {
+    u32 index = BASE_BYTES[(u8) kmer[offset]];
     for (u8 i = 1; i < (u8) k; i++) {
         index = (index << 2) | BASE_BYTES[(u8) kmer[offset+i]];
     }
@@ -75,22 +77,23 @@ u16 str_to_kmer(std::string kmer, u64 offset=0) {
 }
 
 template <KmerLen k>
-u16 kmer_comp(u16 kmer) {
+u32 kmer_comp(u32 kmer) {
     return kmer ^ KMASK((u8) k);
 }
 
 template <KmerLen k>
-u16 kmer_revcomp(u16 kmer) {
-    u16 r = ~kmer;
-    r = ( (r >> 2 & 0x3333) | (r & 0x3333) << 2 );
-    r = ( (r >> 4 & 0x0F0F) | (r & 0x0F0F) << 4 );
-    r = ( (r >> 8 & 0x00FF) | (r & 0x00FF) << 8 );
-    return r >> (2 * (8 - k));
+u32 kmer_revcomp(u32 kmer) {
+    u32 r = ~kmer;
+    r = ( (r >> 2 & 0x33333333) | (r & 0x33333333) << 2 );
+    r = ( (r >> 4 & 0x0F0F0F0F) | (r & 0x0F0F0F0F) << 4 );
+    r = ( (r >> 8 & 0x00FF00FF) | (r & 0x00FF00FF) << 8 );
+    r = ( (r >> 16) | (r << 16) );
+    return r >> (2 * (16 - k));
 }
 
 template <KmerLen KLEN>
-std::vector<u16> kmers_revcomp(const std::vector<u16> &kmers) {
-    std::vector<u16> rev;
+std::vector<u32> kmers_revcomp(const std::vector<u32> &kmers) {
+    std::vector<u32> rev;
     rev.reserve(kmers.size());
     for (auto k = kmers.rbegin(); k != kmers.rend(); k++) {
         rev.push_back(kmer_revcomp<KLEN>(*k));
@@ -99,22 +102,22 @@ std::vector<u16> kmers_revcomp(const std::vector<u16> &kmers) {
 }
 
 template <KmerLen k>
-u8 kmer_head(u16 kmer) {
+u8 kmer_head(u32 kmer) {
     return (u8) ((kmer >> (2*( (u8)k ) - 2)) & 0x3);
 }
 
 template <KmerLen k>
-u16 kmer_neighbor(u16 kmer, u8 i) {
+u32 kmer_neighbor(u32 kmer, u8 i) {
     return ((kmer << 2) & KMASK(k)) | i; 
 }
 
 template <KmerLen k>
-u8 kmer_base(u16 kmer, u8 i) {
-    return (u8) ((kmer >> (2 * ((u16)k-i-1))) & 0x3);
+u8 kmer_base(u32 kmer, u8 i) {
+    return (u8) ((kmer >> (2 * ((u32)k-i-1))) & 0x3);
 }
 
 template <KmerLen k>
-std::string kmer_to_str(u16 kmer) {
+std::string kmer_to_str(u32 kmer) {
     std::string s(k, 'N');
     for (u8 i = 0; i < k; i++) {
         s[i] = BASE_CHARS[kmer_base<k>(kmer, i)];
@@ -123,14 +126,14 @@ std::string kmer_to_str(u16 kmer) {
 }
 
 template <KmerLen KLEN>
-std::vector<u16> seq_to_kmers(u8 *seq, u64 st, u64 en) {
-    std::vector<u16> ret;
+std::vector<u32> seq_to_kmers(u8 *seq, u64 st, u64 en) {
+    std::vector<u32> ret;
 
     u64 pst = st >> 2,
         pen = ((en) >> 2)+1;
 
     u64 i = 0;
-    u16 kmer = 0;
+    u32 kmer = 0;
     u8 bst = (st&3), ben;
 
     for (u64 j = pst; j < pen; j++) {
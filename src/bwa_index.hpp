@@ -34,6 +34,7 @@
 #include "util.hpp"
 #include "bp.hpp"
 #include "range.hpp"
+#include "index_builder.hpp"
 
 #ifdef PYBIND
 #include <pybind11/pybind11.h>
@@ -48,12 +49,12 @@ class SubSeq {
         en_(en),
         size_(en_-st_-KLEN) {}
 
-    u16 operator[](u64 i) {
+    u32 operator[](u64 i) {
         i += st_;
         u64 pst = i >> 2;
         u32 comb = *((u32 *) &pacseq_[pst]);
         u8 shift = i & 3;
-        return (u16) ( (comb >> ((16-KLEN)<<1)) & KMASK(KLEN) );
+        return (u32) ( (comb >> ((16-KLEN)<<1)) & KMASK(KLEN) );
     }
 
     u64 size() {
@@ -82,22 +83,20 @@ class SubSeq {
         size_;
 };
 
-//From submods/bwa/bwtindex.c
-#define BWA_BLOCK_SIZE 10000000
-
 template <KmerLen KLEN>
 class BwaIndex {
     public:
 
-    static void create(const std::string &fasta_fname, 
-                      const std::string &prefix = "") {
-
-        std::string prefix_auto = prefix.empty() ? fasta_fname : prefix;
-
-        bwa_idx_build(fasta_fname.c_str(), 
-                      prefix.c_str(), 
-                      BWTALGO_AUTO,
-                      BWA_BLOCK_SIZE);
+    //Same files as bwa_idx_build, see IndexBuilder
+    //Reference is first masked if mask_iters > 0, see KmerMasker
+    static bool create(const std::string &fasta_fname, 
+                       const std::string &prefix = "", u16 threads = 1,
+                       u32 mask_iters = 0, u32 mask_k = 10) {
+        IndexBuilder builder(fasta_fname, prefix, threads);
+        if (mask_iters > 0 && !builder.mask(mask_k, mask_iters)) {
+            return false;
+        }
+        return builder.build();
     }
 
     BwaIndex() :
@@ -108,20 +107,22 @@ class BwaIndex {
         kmer_ranges_(kmer_count<KLEN>()),
         loaded_(false) {}
 
-    BwaIndex(const std::string &prefix, bool pacseq=false) : BwaIndex() {
-        if (!prefix.empty()) load_index(prefix);
+    //Without the SA, only FM ranges can be used, not reference locations
+    BwaIndex(const std::string &prefix, bool pacseq=false, bool sa=true) 
+        : BwaIndex() {
+        if (!prefix.empty()) load_index(prefix, sa);
         if (pacseq) load_pacseq();
     }
 
-    void load_index(const std::string &prefix) {
+    void load_index(const std::string &prefix, bool sa=true) {
         std::string bwt_fname = prefix + ".bwt",
                     sa_fname = prefix + ".sa";
 
         index_ = bwt_restore_bwt(bwt_fname.c_str());
-        bwt_restore_sa(sa_fname.c_str(), index_);
+        if (sa) bwt_restore_sa(sa_fname.c_str(), index_);
         bns_ = bns_restore(prefix.c_str());
 
-        for (u16 k = 0; k < kmer_ranges_.size(); k++) {
+        for (u32 k = 0; k < kmer_ranges_.size(); k++) {
 
             Range r = get_base_range(kmer_head<KLEN>(k));
             for (u8 i = 1; i < KLEN; i++) {
@@ -155,17 +156,35 @@ class BwaIndex {
         }
     }
 
-    Range get_neighbor(Range r1, u8 base) const {
+    //Range may be 32-bit if the index is small enough (see fits_u32)
+    template <typename T>
+    RangeT<T> get_neighbor(const RangeT<T> &r1, u8 base) const {
         u64 os, oe;
-        bwt_2occ(index_, r1.start_ - 1, r1.end_, base, &os, &oe);
-        return Range(index_->L2[base] + os + 1, index_->L2[base] + oe);
+        bwt_2occ(index_, (bwtint_t) r1.start_ - 1, r1.end_, base, &os, &oe);
+        return RangeT<T>(index_->L2[base] + os + 1, index_->L2[base] + oe);
+    }
+
+    //Prefetches the occurrence blocks get_neighbor(r, *) will read
+    //Mirrors the primary adjustment in bwt_2occ
+    template <typename T>
+    void prefetch_neighbors(const RangeT<T> &r) const {
+        bwtint_t k = (bwtint_t) r.start_ - 1, 
+                 l = r.end_;
+
+        if (k != (bwtint_t) -1) {
+            k -= (k >= index_->primary);
+            __builtin_prefetch(bwt_occ_intv(index_, k));
+        }
+
+        l -= (l >= index_->primary);
+        __builtin_prefetch(bwt_occ_intv(index_, l));
     }
 
-    Range get_kmer_range(u16 kmer) const {
+    Range get_kmer_range(u32 kmer) const {
         return kmer_ranges_[kmer];
     }
 
-    u64 get_kmer_count(u16 kmer) const {
+    u64 get_kmer_count(u32 kmer) const {
         return kmer_ranges_[kmer].length();
     }
 
@@ -181,6 +200,11 @@ class BwaIndex {
         return index_->seq_len;
     }
 
+    //True if all FM coordinates (and one past the end) fit in 32 bits
+    bool fits_u32() const {
+        return size() < UINT32_MAX;
+    }
+
     int get_rid(u64 sa_loc) {
         return bns_pos2rid(bns_, sa_loc);
     }
@@ -219,6 +243,15 @@ class BwaIndex {
         return bns_->anns[rid].len;
     }
 
+    //Same as translate_loc, but gives the reference index instead of name
+    u64 translate_rid(u64 sa_loc, i32 &rid, u64 &ref_loc) const {
+        rid = bns_pos2rid(bns_, sa_loc);
+        if (rid < 0) return 0;
+
+        ref_loc = sa_loc - bns_->anns[rid].offset;
+        return bns_->anns[rid].len;
+    }
+
     std::vector< std::pair<std::string, u64> > get_seqs() const {
         std::vector< std::pair<std::string, u64> > seqs;
 
@@ -244,13 +277,13 @@ class BwaIndex {
         return pacseq_ != NULL;
     }
 
-    std::vector<u16> get_kmers(std::string nm, u64 st, u64 en) {
+    std::vector<u32> get_kmers(std::string nm, u64 st, u64 en) {
         u64 sti = coord_to_pacseq(nm, st),
             eni = coord_to_pacseq(nm, en);
         return get_kmers(sti, eni);
     }
 
-    std::vector<u16> get_kmers(u64 st, u64 en) {
+    std::vector<u32> get_kmers(u64 st, u64 en) {
         return seq_to_kmers<KLEN>(pacseq_, st, en);
     }
 
@@ -339,12 +372,17 @@ class BwaIndex {
     static void pybind_defs(pybind11::class_<BwaIndex<KLEN>> &c) {
         c.def(pybind11::init<>());
         c.def(pybind11::init<const std::string &, bool>());
-        PY_BWA_INDEX_METH(create);
-        PY_BWA_INDEX_METH(load_index);
+        c.def_static("create", &BwaIndex<KLEN>::create, 
+                     pybind11::arg("fasta_fname"), pybind11::arg("prefix")="",
+                     pybind11::arg("threads")=1, pybind11::arg("mask_iters")=0,
+                     pybind11::arg("mask_k")=10,
+                     pybind11::call_guard<pybind11::gil_scoped_release>());
+        c.def("load_index", &BwaIndex<KLEN>::load_index, 
+              pybind11::arg("prefix"), pybind11::arg("sa")=true);
         PY_BWA_INDEX_METH(is_loaded);
         PY_BWA_INDEX_METH(load_pacseq);
         PY_BWA_INDEX_METH(destroy);
-        PY_BWA_INDEX_METH(get_neighbor);
+        c.def("get_neighbor", &BwaIndex<KLEN>::template get_neighbor<u64>);
         PY_BWA_INDEX_METH(get_kmer_range);
         PY_BWA_INDEX_METH(get_kmer_count);
         PY_BWA_INDEX_METH(get_base_range);
@@ -361,8 +399,8 @@ class BwaIndex {
         PY_BWA_INDEX_METH(get_ref_name);
         PY_BWA_INDEX_METH(get_ref_len);
         PY_BWA_INDEX_METH(range_to_fms);
-        c.def("get_kmers", static_cast< std::vector<u16> (BwaIndex::*)(u64, u64)> (&BwaIndex::get_kmers) );
-        c.def("get_kmers", static_cast< std::vector<u16> (BwaIndex::*)(std::string, u64, u64)> (&BwaIndex::get_kmers) );
+        c.def("get_kmers", static_cast< std::vector<u32> (BwaIndex::*)(u64, u64)> (&BwaIndex::get_kmers) );
+        c.def("get_kmers", static_cast< std::vector<u32> (BwaIndex::*)(std::string, u64, u64)> (&BwaIndex::get_kmers) );
     }
 
     #endif
@@ -34,6 +34,7 @@ class Chunk {
     u16 get_channel_idx() const;
     u32 get_number() const;
     u32 get_raw_data() const;
+    const std::vector<float> &get_raw() const {return raw_data_;}
     u32 size() const;
     void print() const;
     void set_start(u64 time);
@@ -0,0 +1,182 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include "chunk_trace.hpp"
+
+const char ChunkTrace::MAGIC[] = "UNCLTRC";
+const u16 ChunkTrace::VERSION;
+
+ChunkTrace::Writer::Writer(const std::string &fname, const Header &h) {
+    out_ = fopen(fname.c_str(), "wb");
+    if (out_ == NULL) {
+        std::cerr << "Error: failed to open chunk trace \"" << fname << "\"\n";
+        return;
+    }
+
+    fwrite(MAGIC, 1, sizeof(MAGIC), out_);
+    fwrite(&VERSION, sizeof(VERSION), 1, out_);
+
+    //Fields written individually so the file has no struct padding
+    fwrite(&h.num_channels, sizeof(h.num_channels), 1, out_);
+    fwrite(&h.max_active_reads, sizeof(h.max_active_reads), 1, out_);
+    fwrite(&h.realtime_mode, sizeof(h.realtime_mode), 1, out_);
+    fwrite(&h.chunk_time, sizeof(h.chunk_time), 1, out_);
+    fwrite(&h.sample_rate, sizeof(h.sample_rate), 1, out_);
+
+    time_.reset();
+}
+
+ChunkTrace::Writer::~Writer() {
+    if (out_ != NULL) fclose(out_);
+}
+
+bool ChunkTrace::Writer::is_open() const {
+    return out_ != NULL;
+}
+
+void ChunkTrace::Writer::write_type(Type type) {
+    double t = time_.get();
+    fwrite(&type, sizeof(type), 1, out_);
+    fwrite(&t, sizeof(t), 1, out_);
+}
+
+void ChunkTrace::Writer::write_chunk(Type type, const Chunk &c) {
+    if (out_ == NULL) return;
+
+    write_type(type);
+
+    u16 channel = c.get_channel();
+    u32 number = c.get_number();
+    u64 start = c.get_start();
+    std::string id = c.get_id();
+    u16 id_len = std::min<size_t>(id.size(), UINT16_MAX);
+    u32 len = c.size();
+
+    fwrite(&channel, sizeof(channel), 1, out_);
+    fwrite(&number, sizeof(number), 1, out_);
+    fwrite(&start, sizeof(start), 1, out_);
+    fwrite(&id_len, sizeof(id_len), 1, out_);
+    fwrite(id.data(), 1, id_len, out_);
+    fwrite(&len, sizeof(len), 1, out_);
+    fwrite(c.get_raw().data(), sizeof(float), len, out_);
+}
+
+void ChunkTrace::Writer::write_update(u32 count) {
+    if (out_ == NULL) return;
+    write_type(Type::UPDATE);
+    fwrite(&count, sizeof(count), 1, out_);
+}
+
+ChunkTrace::Reader::Reader(const std::string &fname) : fname_(fname) {
+    in_ = fopen(fname.c_str(), "rb");
+    if (in_ == NULL) {
+        std::cerr << "Error: failed to open chunk trace \"" << fname << "\"\n";
+        return;
+    }
+
+    char magic[sizeof(MAGIC)];
+    u16 version = 0;
+    if (fread(magic, 1, sizeof(magic), in_) != sizeof(magic) ||
+        memcmp(magic, MAGIC, sizeof(magic)) != 0 ||
+        !read(version)) {
+        std::cerr << "Error: \"" << fname << "\" is not a chunk trace\n";
+        fclose(in_);
+        in_ = NULL;
+        return;
+    }
+
+    if (version != VERSION) {
+        std::cerr << "Error: unsupported chunk trace version " << version << "\n";
+        fclose(in_);
+        in_ = NULL;
+        return;
+    }
+
+    if (!read(header_.num_channels) || !read(header_.max_active_reads) ||
+        !read(header_.realtime_mode) || !read(header_.chunk_time) ||
+        !read(header_.sample_rate)) {
+        std::cerr << "Error: truncated chunk trace header\n";
+        fclose(in_);
+        in_ = NULL;
+    }
+}
+
+ChunkTrace::Reader::~Reader() {
+    if (in_ != NULL) fclose(in_);
+}
+
+bool ChunkTrace::Reader::is_open() const {
+    return in_ != NULL;
+}
+
+const ChunkTrace::Header &ChunkTrace::Reader::get_header() const {
+    return header_;
+}
+
+bool ChunkTrace::Reader::next(Record &r) {
+    if (in_ == NULL || !read(r.type)) return false;
+
+    if (!read(r.time)) {
+        std::cerr << "Warning: ignoring truncated record at end of \"" 
+                  << fname_ << "\"\n";
+        return false;
+    }
+
+    u16 channel, id_len;
+    u32 number, len;
+    u64 start;
+    std::string id;
+
+    switch (r.type) {
+        case Type::ADD_CHUNK:
+        case Type::TRY_ADD_CHUNK:
+            if (!read(channel) || !read(number) || 
+                !read(start) || !read(id_len)) break;
+
+            id.resize(id_len);
+            if (fread(&id[0], 1, id_len, in_) != id_len || !read(len)) break;
+
+            signal_.resize(len);
+            if (fread(signal_.data(), sizeof(float), len, in_) != len) break;
+
+            r.chunk = Chunk(id, channel, number, start, signal_, 0, len);
+            r.count = 0;
+            return true;
+
+        case Type::UPDATE:
+            if (!read(r.count)) break;
+            return true;
+
+        default:
+            std::cerr << "Error: malformed record in \"" << fname_ << "\"\n";
+            return false;
+    }
+
+    std::cerr << "Warning: ignoring truncated record at end of \"" 
+              << fname_ << "\"\n";
+    return false;
+}
@@ -0,0 +1,113 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _INCL_CHUNK_TRACE
+#define _INCL_CHUNK_TRACE
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include "chunk.hpp"
+#include "util.hpp"
+
+//Binary trace of the calls made to a RealtimePool, so the exact chunk
+//stream seen during a live run can be replayed offline
+//
+//File starts with magic string, u16 version, and a Header. Each record
+//is a u8 Type and f64 milliseconds since the trace started, followed by
+//the chunk for ADD/TRY_ADD records:
+//  u16 channel, u32 number, u64 start, u16 id length, id, 
+//  u32 samples, f32 signal
+//or u32 number of reads returned for UPDATE records
+class ChunkTrace {
+    public:
+
+    static const char MAGIC[];
+    static const u16 VERSION = 1;
+
+    enum class Type : u8 {ADD_CHUNK, TRY_ADD_CHUNK, UPDATE, NUM};
+
+    //Pool settings recorded so replays can match them
+    typedef struct {
+        u16 num_channels;
+        u32 max_active_reads;
+        u8 realtime_mode;
+        float chunk_time, sample_rate;
+    } Header;
+
+    typedef struct {
+        Type type;
+        double time;
+        Chunk chunk;
+        u32 count;
+    } Record;
+
+    class Writer {
+        public:
+        Writer(const std::string &fname, const Header &header);
+        ~Writer();
+
+        Writer(const Writer &) = delete;
+        Writer &operator=(const Writer &) = delete;
+
+        bool is_open() const;
+
+        //Call before passing chunk to the pool, which may swap it out
+        void write_chunk(Type type, const Chunk &c);
+        void write_update(u32 count);
+
+        private:
+        void write_type(Type type);
+
+        FILE *out_;
+        Timer time_;
+    };
+
+    class Reader {
+        public:
+        Reader(const std::string &fname);
+        ~Reader();
+
+        Reader(const Reader &) = delete;
+        Reader &operator=(const Reader &) = delete;
+
+        bool is_open() const;
+        const Header &get_header() const;
+
+        //Returns false at end of file, or on a malformed record 
+        bool next(Record &r);
+
+        private:
+        template <typename T>
+        bool read(T &v) {
+            return fread(&v, sizeof(T), 1, in_) == 1;
+        }
+
+        FILE *in_;
+        std::string fname_;
+        Header header_;
+        std::vector<float> signal_;
+    };
+};
+
+#endif
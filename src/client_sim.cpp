@@ -21,26 +21,52 @@
  * SOFTWARE.
  */
 
+#include <cfloat>
 #include "client_sim.hpp"
 
+//Lazily loaded reads only need signal locations from the fast5s
+static Fast5Reader::Params sim_fast5_prms(const Conf &conf) {
+    Fast5Reader::Params p = conf.fast5_prms;
+    p.stream_signal = conf.sim_prms.read_lookahead > 0;
+    return p;
+}
+
 ClientSim::ClientSim(Conf &conf) :
       PRMS(conf.sim_prms),
-      fast5s_(conf.fast5_prms),
+      fast5s_(sim_fast5_prms(conf)),
       scan_start_(0),
       is_running_(false),
-      in_scan_(false) {
+      in_scan_(false),
+      loader_stop_(false),
+      virtual_time_(0) {
+
+    sample_rate_ = conf.get_sample_rate();
+    time_coef_  = PRMS.sim_speed * sample_rate_ / 1000;
+    ej_time_    = PRMS.ej_time   * sample_rate_;
+    scan_time_  = PRMS.scan_time * sample_rate_;
+    step_samples_ = PRMS.sim_step * sample_rate_;
+
+    if (PRMS.virtual_clock && step_samples_ == 0) {
+        std::cerr << "Warning: sim_step too small, using one sample\n";
+        step_samples_ = 1;
+    }
 
-    float sample_rate = conf.get_sample_rate();
-    time_coef_  = sample_rate / 1000;
-    ej_time_    = PRMS.ej_time   * sample_rate;
-    scan_time_  = PRMS.scan_time * sample_rate;
+    //Mapping latency is modelled by delaying decisions instead
+    if (PRMS.virtual_clock) {
+        conf.mapper_prms.chunk_timeout = FLT_MAX;
+        conf.mapper_prms.evt_timeout = FLT_MAX;
+    }
 
     channels_.reserve(conf.get_num_channels());
     for (u32 c = 1; c <= conf.get_num_channels(); c++) {
-        channels_.emplace_back(c);
+        channels_.emplace_back(this, c);
     }
 }
 
+ClientSim::~ClientSim() {
+    stop_loader();
+}
+
 bool ClientSim::load_from_files(const std::string &prefix) {
     std::string itvs_file = prefix + "_itvs.txt",
                 gaps_file = prefix + "_gaps.txt",
@@ -158,11 +184,22 @@ void ClientSim::add_read(u16 ch, const std::string &id, u32 offs) {
     fast5s_.add_read(id);
 }
 
+void ClientSim::add_read_buffer(u16 ch, ReadBuffer &read) {
+    u32 i = channels_[ch-1].reserve_read();
+    read.set_channel(ch);
+
+    SimRead &sr = channels_[ch-1].set_read(i, 0, read);
+    sr.load_chunks();
+    sr.load_ = SimRead::Load::LOADED;
+}
+
 void ClientSim::add_fast5(const std::string &fname) {
     fast5s_.add_fast5(fname);
 }
 
 
+//Only loads signal locations if read_lookahead > 0
+//Signal is then loaded by run_loader() shortly before each read starts
 void ClientSim::load_fast5s() {
     u32 n = 0;
     while(!fast5s_.empty()) {
@@ -170,7 +207,12 @@ void ClientSim::load_fast5s() {
         ReadLoc r = read_locs[read.get_id()];
 
         read.set_channel(r.ch);
-        channels_[r.ch-1].load_read(r.i, r.offs, read);
+        SimRead &sr = channels_[r.ch-1].set_read(r.i, r.offs, read);
+
+        if (!is_lazy()) {
+            sr.load_chunks();
+            sr.load_ = SimRead::Load::LOADED;
+        }
 
         if (n % 1000 == 0) {
             std::cerr << n << " loaded\n";
@@ -209,15 +251,99 @@ bool ClientSim::load_reads(const std::string &fname) {
 
 
 bool ClientSim::run() {
+    if (is_lazy() && !loader_.joinable()) {
+        loader_stop_ = false;
+        loader_ = std::thread(&ClientSim::run_loader, this);
+        for (SimChannel &ch : channels_) {
+            if (!ch.reads_.empty()) ch.prefetch();
+        }
+    }
+
     is_running_ = true;
     in_scan_ = false;
     timer_.reset();
+    virtual_time_ = 0;
     for (SimChannel &ch : channels_) {
         ch.start(0);
     }
     return true;
 }
 
+bool ClientSim::is_lazy() const {
+    return PRMS.read_lookahead > 0;
+}
+
+void ClientSim::request_load(SimRead &r) {
+    std::lock_guard<std::mutex> lock(load_mtx_);
+    if (r.load_ != SimRead::Load::UNLOADED) return;
+
+    r.load_ = SimRead::Load::QUEUED;
+    load_queue_.push_back(&r);
+    load_cv_.notify_one();
+}
+
+//Blocks until read is loaded, moving it to the front of the queue
+//unless the loader thread already has it
+void ClientSim::wait_loaded(SimRead &r) {
+    std::unique_lock<std::mutex> lock(load_mtx_);
+    if (r.load_ == SimRead::Load::LOADED) return;
+
+    if (r.load_ != SimRead::Load::LOADING) {
+        if (r.load_ == SimRead::Load::QUEUED) {
+            auto it = std::find(load_queue_.begin(), load_queue_.end(), &r);
+            if (it != load_queue_.end()) load_queue_.erase(it);
+        }
+
+        r.load_ = SimRead::Load::QUEUED;
+        load_queue_.push_front(&r);
+        load_cv_.notify_one();
+    }
+
+    loaded_cv_.wait(lock, [&r] {return r.load_ == SimRead::Load::LOADED;});
+}
+
+void ClientSim::unload_read(SimRead &r) {
+    std::lock_guard<std::mutex> lock(load_mtx_);
+    //Only streamed reads can be loaded again
+    if (r.load_ == SimRead::Load::LOADED && r.read_.is_streamed()) r.unload();
+}
+
+void ClientSim::run_loader() {
+    std::unique_lock<std::mutex> lock(load_mtx_);
+
+    while (true) {
+        load_cv_.wait(lock, [this] {
+            return loader_stop_ || !load_queue_.empty();
+        });
+        if (loader_stop_) break;
+
+        SimRead *r = load_queue_.front();
+        load_queue_.pop_front();
+
+        //Skip duplicate entries of reads already being or done loading
+        if (r->load_ != SimRead::Load::QUEUED) continue;
+        r->load_ = SimRead::Load::LOADING;
+
+        lock.unlock();
+        r->load_chunks();
+        lock.lock();
+
+        r->load_ = SimRead::Load::LOADED;
+        loaded_cv_.notify_all();
+    }
+}
+
+void ClientSim::stop_loader() {
+    if (!loader_.joinable()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(load_mtx_);
+        loader_stop_ = true;
+    }
+    load_cv_.notify_all();
+    loader_.join();
+}
+
 std::vector< std::pair<u16, Chunk> > ClientSim::get_read_chunks() {
     std::vector< std::pair<u16, Chunk> > ret; //TODO rename chunks?
 
@@ -262,6 +388,8 @@ std::vector< std::pair<u16, Chunk> > ClientSim::get_read_chunks() {
 
         intvs_ended = false;
 
+        ch.apply_decision(time, ej_time_);
+
         while (ch.chunk_ready(time)) {
             ret.push_back( std::pair<u16, Chunk>(c+1, ch.next_chunk(time)));
         }
@@ -285,25 +413,48 @@ u32 ClientSim::get_number(u16 ch) {
     //return chunks.front().get_number();
 }
 
-void ClientSim::stop_receiving_read(u16 ch, u32 number) {
-    if (get_number(ch) == number) {
+//Map time is converted to samples at the same rate as the wall clock
+//would advance in realtime mode
+u32 ClientSim::get_decision_time(u16 ch, float map_time) {
+    return channels_[ch-1].chunk_time_ + (u32) (map_time * time_coef_);
+}
+
+void ClientSim::stop_receiving_read(u16 ch, u32 number, float map_time) {
+    if (get_number(ch) != number) return;
+
+    if (PRMS.virtual_clock) {
+        channels_[ch-1].decide(get_decision_time(ch, map_time), false);
+    } else {
         channels_[ch-1].stop_receiving_read();
     }
 }
 
-u32 ClientSim::unblock_read(u16 ch, u32 number) {
+u32 ClientSim::unblock_read(u16 ch, u32 number, float map_time) {
     if (get_number(ch) != number) { 
         return 0;
     }
+
+    if (PRMS.virtual_clock) {
+        return channels_[ch-1].decide(get_decision_time(ch, map_time), true);
+    }
     return channels_[ch-1].unblock(get_time(), ej_time_);
 }
 
 float ClientSim::get_time() {
+    if (PRMS.virtual_clock) return virtual_time_;
     return (timer_.get() * time_coef_);
 }
 
 float ClientSim::get_runtime() {
-    return timer_.get() / 1000;
+    return get_time() / sample_rate_;
+}
+
+void ClientSim::advance_clock() {
+    if (PRMS.virtual_clock) virtual_time_ += step_samples_;
+}
+
+bool ClientSim::is_virtual() const {
+    return PRMS.virtual_clock;
 }
 
 bool ClientSim::is_running() {
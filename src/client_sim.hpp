@@ -26,6 +26,10 @@
 
 #include <unordered_map>
 #include <deque>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include "util.hpp"
 #include "chunk.hpp"
 #include "read_buffer.hpp" 
@@ -35,20 +39,36 @@
 class ClientSim {
     public:
     ClientSim(Conf &c);
+    ~ClientSim();
 
     bool run();
     std::vector< std::pair<u16, Chunk> > get_read_chunks();
-    void stop_receiving_read(u16 channel, u32 number);
-    u32 unblock_read(u16 channel, u32 number);
+
+    //With a virtual clock, decisions take effect once the read's map
+    //time (in wall milliseconds, e.g. the "mt" tag) has passed in 
+    //simulated time after its last chunk was received
+    void stop_receiving_read(u16 channel, u32 number, float map_time=0);
+    u32 unblock_read(u16 channel, u32 number, float map_time=0);
     bool is_running();
+
+    //Simulated seconds since run() 
     float get_runtime();
 
+    //Advances virtual clock by sim_step, no effect in realtime mode
+    //Mapper timeouts are disabled with a virtual clock, since they
+    //would make results depend on wall clock time
+    void advance_clock();
+    bool is_virtual() const;
+
     bool load_from_files(const std::string &prefix);
 
     void add_intv(u16 ch, u16 i, u32 st, u32 en);
     void add_gap(u16 ch, u16 i, u32 len);
     void add_delay(u16 ch, u16 i, u32 len);
     void add_read(u16 ch, const std::string &id, u32 offs);
+
+    //Adds a read already in memory, e.g. from SquiggleSim
+    void add_read_buffer(u16 ch, ReadBuffer &read);
     void add_fast5(const std::string &fname);
     void load_fast5s();
 
@@ -62,13 +82,20 @@ class ClientSim {
         c.def(pybind11::init<Conf &>());
         PY_SIM_METH(run);
         PY_SIM_METH(get_runtime);
+        PY_SIM_METH(advance_clock);
+        PY_SIM_METH(is_virtual);
         PY_SIM_METH(get_read_chunks);
-        PY_SIM_METH(stop_receiving_read);
-        PY_SIM_METH(unblock_read);
+        c.def("stop_receiving_read", &ClientSim::stop_receiving_read,
+              pybind11::arg("channel"), pybind11::arg("number"),
+              pybind11::arg("map_time")=0);
+        c.def("unblock_read", &ClientSim::unblock_read,
+              pybind11::arg("channel"), pybind11::arg("number"),
+              pybind11::arg("map_time")=0);
         PY_SIM_METH(add_intv);
         PY_SIM_METH(add_gap);
         PY_SIM_METH(add_delay);
         PY_SIM_METH(add_read);
+        PY_SIM_METH(add_read_buffer);
         PY_SIM_METH(add_fast5);
         PY_SIM_METH(load_fast5s);
 
@@ -88,6 +115,22 @@ class ClientSim {
     u32 get_number(u16 channel);
     float get_time();
 
+    //Decision made with a virtual clock, applied at a later time
+    typedef struct {
+        u32 time, delay;
+        bool unblock;
+    } Decision;
+    u32 get_decision_time(u16 channel, float map_time);
+
+    //Lazy loading of read signal, only used if read_lookahead > 0
+    class SimRead;
+    bool is_lazy() const;
+    void request_load(SimRead &r);
+    void wait_loaded(SimRead &r);
+    void unload_read(SimRead &r);
+    void run_loader();
+    void stop_loader();
+
     typedef struct {
         u16 ch;
         u32 i, offs;
@@ -184,21 +227,43 @@ class ClientSim {
     class SimRead {
         //private:
         public:
+        //LOADING while the loader thread is reading signal
+        enum class Load {UNLOADED, QUEUED, LOADING, LOADED};
+
+        //Only holds signal location if reads are lazily loaded
+        ReadBuffer read_;
         std::vector<Chunk> chunks_;
+        Load load_;
         u8 c_;
-        u32 start_, end_, duration_, number_;
+        u32 offs_, start_, end_, duration_, number_;
 
         SimRead() :
+            load_(Load::UNLOADED),
             c_(0),
+            offs_(0),
             start_(0),
             end_(0),
             duration_(0),
             number_(0) {}
 
-        void load_read(const ReadBuffer &read, u32 offs) {
+        void set_read(ReadBuffer &read, u32 offs) {
             duration_ = read.get_duration();
-            read.get_chunks(chunks_, false, offs);
             number_ = read.get_number();
+            offs_ = offs;
+            read_.swap(read);
+        }
+
+        //Loads signal and splits it into chunks
+        void load_chunks() {
+            read_.load_signal();
+            chunks_.clear();
+            read_.get_chunks(chunks_, false, offs_);
+            std::vector<float>().swap(read_.full_signal_);
+        }
+
+        void unload() {
+            std::vector<Chunk>().swap(chunks_);
+            load_ = Load::UNLOADED;
         }
 
         void start(u32 t) {
@@ -251,6 +316,7 @@ class ClientSim {
     class SimChannel {
         //private:
         public:
+        ClientSim *sim_;
         u16 channel_;
         std::deque<ScanIntv> intvs_; //intervals
         std::vector<SimRead> reads_;
@@ -259,11 +325,21 @@ class ClientSim {
         u32 read_count_;
         bool is_active_;
 
-        SimChannel(u16 channel) : 
+        //Time the last chunk was received, and a pending decision on
+        //the current read. Its chunks are held back until then, since
+        //the client has already decided
+        u32 chunk_time_;
+        Decision decision_;
+        bool decided_;
+
+        SimChannel(ClientSim *sim, u16 channel) : 
+            sim_(sim),
             channel_(channel), 
             r_(0), 
             read_count_(0),
-            is_active_(false) {}
+            is_active_(false),
+            chunk_time_(0),
+            decided_(false) {}
 
         bool is_dead() {
             return intvs_.empty();
@@ -274,12 +350,12 @@ class ClientSim {
 
             if (intvs_[0].is_active(t)) {
                 if (!is_active_) {
-                    reads_[r_].start(t + intvs_[0].next_gap());
+                    start_read(t + intvs_[0].next_gap());
                     is_active_ = true;
                 }
                 
             } else if (is_active_) {
-                r_ = (r_+1) % reads_.size();
+                next_read();
                 is_active_ = false;
             }
 
@@ -299,12 +375,38 @@ class ClientSim {
             return read_count_++;
         }
 
-        void load_read(u32 i, u32 offs, const ReadBuffer &read) {
+        SimRead &set_read(u32 i, u32 offs, ReadBuffer &read) {
             if (reads_.size() < read_count_) {
                 reads_.resize(read_count_);
             }
 
-            reads_[i].load_read(read, offs);
+            reads_[i].set_read(read, offs);
+            return reads_[i];
+        }
+
+        //Queue current and upcoming reads to be loaded
+        void prefetch() {
+            u32 n = std::min<u32>(sim_->PRMS.read_lookahead + 1, reads_.size());
+            for (u32 i = 0; i < n; i++) {
+                sim_->request_load(reads_[(r_+i) % reads_.size()]);
+            }
+        }
+
+        void start_read(u32 t) {
+            sim_->wait_loaded(reads_[r_]);
+            reads_[r_].start(t);
+        }
+
+        //Move to next read, freeing signal of the previous one unless 
+        //all of the channel's reads fit in the look-ahead
+        void next_read() {
+            if (sim_->is_lazy() && 
+                reads_.size() > sim_->PRMS.read_lookahead + 1u) {
+                sim_->unload_read(reads_[r_]);
+            }
+            r_ = (r_+1) % reads_.size();
+            decided_ = false;
+            prefetch();
         }
 
         void add_delay(u32 i, u32 delay) {
@@ -334,18 +436,19 @@ class ClientSim {
 
             u32 end = reads_[r_].get_end();
             while (t >= end) {
-                r_ = (r_+1) % reads_.size();
+                next_read();
 
-                reads_[r_].start(end + intvs_[0].next_gap() + extra_gap_);
+                start_read(end + intvs_[0].next_gap() + extra_gap_);
                 extra_gap_ = 0;
                 end = reads_[r_].get_end();
             }
 
-            return reads_[r_].chunk_ready(t);
+            return !decided_ && reads_[r_].chunk_ready(t);
         }
 
         Chunk next_chunk(u32 t) {
             assert(chunk_ready(t));
+            chunk_time_ = t;
             return reads_[r_].pop_chunk();
         }
 
@@ -372,6 +475,31 @@ class ClientSim {
             extra_gap_ = ej_time;
             return delay;
         }
+
+        //Delay is drawn now so it doesn't depend on when it's applied
+        u32 decide(u32 t, bool unblock) {
+            u32 delay = unblock ? intvs_[0].next_delay() : 0;
+            decision_ = {t, delay, unblock};
+            decided_ = true;
+            return delay;
+        }
+
+        //Applies the pending decision if its time has passed, unless
+        //the read already ended on its own
+        void apply_decision(u32 t, u32 ej_time) {
+            if (!decided_ || decision_.time > t) return;
+            decided_ = false;
+
+            SimRead &r = reads_[r_];
+            if (decision_.time >= r.get_end()) return;
+
+            if (decision_.unblock) {
+                r.unblock(decision_.time, decision_.delay);
+                extra_gap_ = ej_time;
+            } else {
+                r.stop_receiving();
+            }
+        }
     };
 
     friend bool operator< (const SimRead &r1, const SimRead &r2);
@@ -385,6 +513,17 @@ class ClientSim {
     bool is_running_, in_scan_;
 
     Timer timer_;
+
+    //Reads waiting for the loader thread
+    std::thread loader_;
+    std::mutex load_mtx_;
+    std::condition_variable load_cv_, loaded_cv_;
+    std::deque<SimRead *> load_queue_;
+    bool loader_stop_;
+
+    //Simulated time in samples and step size if virtual_clock is set
+    float sample_rate_;
+    u64 virtual_time_, step_samples_;
     
     std::vector<SimChannel> channels_;
 };
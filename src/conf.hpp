@@ -29,6 +29,7 @@
 #include <cfloat>
 #include "mapper.hpp"
 #include "fast5_reader.hpp"
+#include "paf_writer.hpp"
 #include "toplevel_prms.hpp"
 #include "toml.hpp"
 
@@ -40,6 +41,8 @@
 
 const std::string ACTIVE_STRS[] = {"full", "even", "odd"};
 const std::string MODE_STRS[] = {"deplete", "enrich"};
+const std::string NUMA_STRS[] = {"none", "replicate", "interleave"};
+const std::string PAF_FORMAT_STRS[] = {"text", "binary"};
 
 #define GET_SET(T, N) T get_##N() { return N; } \
                       void set_##N(const T &v) { N = v; }
@@ -63,6 +66,15 @@ class Conf {
     Mode mode;
     u16 threads;
 
+    //Linux-style CPU list mapper threads are pinned to ("" = unpinned)
+    std::string cpu_set;
+
+    //Number of reads each mapper thread advances in lockstep
+    u16 interleave_reads;
+
+    //Text PAF or compact binary records (converted with uncalled_paf)
+    PafWriter::Format paf_format;
+
     Mapper::Params &mapper_prms = Mapper::PRMS;
     Normalizer::Params &norm_prms = mapper_prms.norm_prms;
     EventDetector::Params &event_prms = mapper_prms.event_prms;
@@ -78,7 +90,8 @@ class Conf {
     SimParams sim_prms = SIM_PRMS_DEF;
     MapOrdParams map_ord_prms = MAP_ORD_PRMS_DEF;
 
-    Conf() : mode(Mode::UNDEF), threads(1) {}
+    Conf() : mode(Mode::UNDEF), threads(1), interleave_reads(1),
+             paf_format(PafWriter::Format::TEXT) {}
 
     Conf(Mode m) : Conf() {
         mode = m;
@@ -101,6 +114,28 @@ class Conf {
         if (conf.contains("global")) {
             const auto subconf = toml::find(conf, "global");
             GET_TOML(u16, threads);
+            GET_TOML(std::string, cpu_set);
+            GET_TOML(u16, interleave_reads);
+
+            if (subconf.contains("numa_index")) {
+                std::string numa_str = toml::find<std::string>(subconf, "numa_index");
+                for (u8 i = 0; i != (u8) NumaIndex::NUM; i++) {
+                    if (numa_str == NUMA_STRS[i]) {
+                        mapper_prms.numa_index = (NumaIndex) i;
+                        break;
+                    }
+                }
+            }
+
+            if (subconf.contains("paf_format")) {
+                std::string fmt_str = toml::find<std::string>(subconf, "paf_format");
+                for (u8 i = 0; i != (u8) PafWriter::Format::NUM; i++) {
+                    if (fmt_str == PAF_FORMAT_STRS[i]) {
+                        paf_format = (PafWriter::Format) i;
+                        break;
+                    }
+                }
+            }
         }
 
         if (conf.contains("realtime")) {
@@ -109,6 +144,7 @@ class Conf {
             GET_TOML_EXTERN(u16, port, realtime_prms);
             GET_TOML_EXTERN(float, duration, realtime_prms);
             GET_TOML_EXTERN(u32, max_active_reads, realtime_prms);
+            GET_TOML_EXTERN(std::string, chunk_trace, realtime_prms);
 
             if (subconf.contains("realtime_mode")) {
                 std::string mode_str = toml::find<std::string>(subconf, "realtime_mode");
@@ -142,6 +178,10 @@ class Conf {
             GET_TOML_EXTERN(float, scan_intv_time, sim_prms);
             GET_TOML_EXTERN(float, ej_time, sim_prms);
             GET_TOML_EXTERN(u32, min_ch_reads, sim_prms);
+            GET_TOML_EXTERN(bool, virtual_clock, sim_prms);
+            GET_TOML_EXTERN(float, sim_step, sim_prms);
+            GET_TOML_EXTERN(u32, seed, sim_prms);
+            GET_TOML_EXTERN(u32, read_lookahead, sim_prms);
         }
 
         if (conf.contains("map_ord")) {
@@ -154,6 +194,7 @@ class Conf {
 
             GET_TOML_EXTERN(u32, max_buffer, fast5_prms);
             GET_TOML_EXTERN(u32, max_reads, fast5_prms);
+            GET_TOML_EXTERN(bool, stream_signal, fast5_prms);
             GET_TOML_EXTERN(std::string, fast5_list, fast5_prms);
             GET_TOML_EXTERN(std::string, read_list, fast5_prms);
         }
@@ -179,9 +220,17 @@ class Conf {
             GET_TOML_EXTERN(u32, max_events, mapper_prms);
             GET_TOML_EXTERN(float, max_stay_frac, mapper_prms);
             GET_TOML_EXTERN(float, min_seed_prob, mapper_prms);
+            GET_TOML_EXTERN(u32, prob_lut_bins, mapper_prms);
+            GET_TOML_EXTERN(u32, sketch_events, mapper_prms);
+            GET_TOML_EXTERN(u32, sketch_margin, mapper_prms);
+            GET_TOML_EXTERN(float, sketch_prob, mapper_prms);
             GET_TOML_EXTERN(std::string, bwa_prefix, mapper_prms);
             GET_TOML_EXTERN(std::string, idx_preset, mapper_prms);
             GET_TOML_EXTERN(std::string, model_path, mapper_prms);
+            GET_TOML_EXTERN(std::vector<std::string>, extra_prefixes, mapper_prms);
+            GET_TOML_EXTERN(std::vector<std::string>, extra_presets, mapper_prms);
+            GET_TOML_EXTERN(std::vector<std::string>, extra_roles, mapper_prms);
+            GET_TOML_EXTERN(i32, map_index, mapper_prms);
             GET_TOML_EXTERN(u16, evt_batch_size, mapper_prms);
             GET_TOML_EXTERN(float, evt_timeout, mapper_prms);
             GET_TOML_EXTERN(float, chunk_timeout, mapper_prms);
@@ -232,6 +281,9 @@ class Conf {
     }
 
     GET_SET(u16, threads)
+    GET_SET(std::string, cpu_set)
+    GET_SET(u16, interleave_reads)
+    GET_SET(PafWriter::Format, paf_format)
 
 
     //TODO define get<type, param>, set<type, param>, doc<type, param>
@@ -245,11 +297,13 @@ class Conf {
     GET_SET_DOC(fast5, std::string, read_list)
     GET_SET_DOC(fast5, u32, max_reads)
     GET_SET_DOC(fast5, u32, max_buffer)
+    GET_SET_DOC(fast5, bool, stream_signal)
 
     GET_SET_EXTERN(std::string, realtime_prms, host)
     GET_SET_EXTERN(u16, realtime_prms, port)
     GET_SET_EXTERN(float, realtime_prms, duration)
     GET_SET_EXTERN(u32, realtime_prms, max_active_reads)
+    GET_SET_EXTERN(std::string, realtime_prms, chunk_trace)
     GET_SET_EXTERN(RealtimeParams::ActiveChs, realtime_prms, active_chs)
     GET_SET_EXTERN(RealtimeParams::Mode, realtime_prms, realtime_mode)
 
@@ -259,8 +313,16 @@ class Conf {
     GET_SET_EXTERN(std::string, mapper_prms, bwa_prefix)
     GET_SET_EXTERN(std::string, mapper_prms, idx_preset)
     GET_SET_EXTERN(std::string, mapper_prms, model_path)
+    GET_SET_EXTERN(std::vector<std::string>, mapper_prms, extra_prefixes)
+    GET_SET_EXTERN(std::vector<std::string>, mapper_prms, extra_presets)
+    GET_SET_EXTERN(std::vector<std::string>, mapper_prms, extra_roles)
+    GET_SET_EXTERN(i32, mapper_prms, map_index)
     GET_SET_EXTERN(u32, mapper_prms, max_events)
     GET_SET_EXTERN(u32, mapper_prms, seed_len);
+    GET_SET_EXTERN(u32, mapper_prms, prob_lut_bins)
+    GET_SET_EXTERN(u32, mapper_prms, sketch_events)
+    GET_SET_EXTERN(u32, mapper_prms, sketch_margin)
+    GET_SET_EXTERN(float, mapper_prms, sketch_prob)
 
     #ifdef DEBUG_OUT
     GET_SET_EXTERN(std::string, mapper_prms, dbg_prefix)
@@ -280,6 +342,10 @@ class Conf {
     GET_SET_EXTERN(float, sim_prms, scan_intv_time);
     GET_SET_EXTERN(float, sim_prms, ej_time);
     GET_SET_EXTERN(u32, sim_prms, min_ch_reads);
+    GET_SET_EXTERN(bool, sim_prms, virtual_clock);
+    GET_SET_EXTERN(float, sim_prms, sim_step);
+    GET_SET_EXTERN(u32, sim_prms, seed);
+    GET_SET_EXTERN(u32, sim_prms, read_lookahead);
 
     GET_SET_EXTERN(u32, map_ord_prms, min_active_reads);
 
@@ -299,12 +365,23 @@ class Conf {
          .def("load_toml", &Conf::load_toml);
 
         DEFPRP(threads)
+        DEFPRP(cpu_set)
+        DEFPRP(interleave_reads)
+        DEFPRP(paf_format)
 
         DEFPRP(bwa_prefix)
         DEFPRP(idx_preset)
         DEFPRP(model_path);
+        DEFPRP(extra_prefixes)
+        DEFPRP(extra_presets)
+        DEFPRP(extra_roles)
+        DEFPRP(map_index)
         DEFPRP(max_events)
         DEFPRP(seed_len);
+        DEFPRP(prob_lut_bins)
+        DEFPRP(sketch_events)
+        DEFPRP(sketch_margin)
+        DEFPRP(sketch_prob)
         DEFPRP(chunk_time)
 
         #ifdef DEBUG_OUT
@@ -315,11 +392,13 @@ class Conf {
         DEFPRP_DOC(read_list)
         DEFPRP_DOC(max_reads)
         DEFPRP_DOC(max_buffer)
+        DEFPRP_DOC(stream_signal)
 
         DEFPRP(host)
         DEFPRP(port)
         DEFPRP(duration)
         DEFPRP(max_active_reads)
+        DEFPRP(chunk_trace)
         DEFPRP(active_chs)
         DEFPRP(realtime_mode)
 
@@ -337,6 +416,10 @@ class Conf {
         DEFPRP(scan_intv_time)
         DEFPRP(ej_time)
         DEFPRP(min_ch_reads)
+        DEFPRP(virtual_clock)
+        DEFPRP(sim_step)
+        DEFPRP(seed)
+        DEFPRP(read_lookahead)
     }
     #endif
 };
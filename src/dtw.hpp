@@ -185,13 +185,13 @@ class DTW {
     #endif
 };
 
-float dtwcost_r94p(u16 k, float e) {
+float dtwcost_r94p(u32 k, float e) {
     return -pmodel_r94_template.match_prob(e,k);
 }
-class DTWr94p : public DTW<float, u16, decltype(dtwcost_r94p)> {
+class DTWr94p : public DTW<float, u32, decltype(dtwcost_r94p)> {
     public:
     DTWr94p(const std::vector<float> &means,
-            const std::vector<u16> &kmers,
+            const std::vector<u32> &kmers,
             const DTWParams &prms) 
         : DTW(means, kmers, prms, dtwcost_r94p) {}
 
@@ -199,7 +199,7 @@ class DTWr94p : public DTW<float, u16, decltype(dtwcost_r94p)> {
     #define PY_DTW_R94P_METH(P) c.def(#P, &DTWr94p::P);
     static void pybind_defs(pybind11::class_<DTWr94p> &c) {
         c.def(pybind11::init<const std::vector<float>&, 
-                             const std::vector<u16>&,
+                             const std::vector<u32>&,
                              const DTWParams&>());
         PY_DTW_R94P_METH(get_path)
         PY_DTW_R94P_METH(score)
@@ -209,13 +209,13 @@ class DTWr94p : public DTW<float, u16, decltype(dtwcost_r94p)> {
     
 };
 
-float dtwcost_r94d(u16 k, float e) {
+float dtwcost_r94d(u32 k, float e) {
     return abs(e-pmodel_r94_template.get_mean(k));
 }
-class DTWr94d : public DTW<float, u16, decltype(dtwcost_r94d)> {
+class DTWr94d : public DTW<float, u32, decltype(dtwcost_r94d)> {
     public:
     DTWr94d(const std::vector<float> &means,
-            const std::vector<u16> &kmers,
+            const std::vector<u32> &kmers,
             const DTWParams &prms) 
         : DTW(means, kmers, prms, dtwcost_r94d) {}
 
@@ -223,7 +223,7 @@ class DTWr94d : public DTW<float, u16, decltype(dtwcost_r94d)> {
     #define PY_DTW_R94D_METH(P) c.def(#P, &DTWr94d::P);
     static void pybind_defs(pybind11::class_<DTWr94d> &c) {
         c.def(pybind11::init<const std::vector<float>&, 
-                             const std::vector<u16>&,
+                             const std::vector<u32>&,
                              const DTWParams&>());
         PY_DTW_R94D_METH(get_path)
         PY_DTW_R94D_METH(score)
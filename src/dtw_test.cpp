@@ -100,16 +100,16 @@ int main(int argc, char** argv) {
 
         Query q = queries[read.get_id()];
 
-        std::vector<u16> kmers = idx.get_kmers(q.rf_name, q.rf_st, q.rf_en);
+        std::vector<u32> kmers = idx.get_kmers(q.rf_name, q.rf_st, q.rf_en);
         if (!q.fwd) kmers = kmers_revcomp<KLEN>(kmers);
 
         float read_mean = 0;
-        for (u16 k : kmers) {
+        for (u32 k : kmers) {
             read_mean += model.get_mean(k);
         }
         read_mean /= kmers.size();
         float read_stdv = 0;
-        for (u16 k : kmers) {
+        for (u32 k : kmers) {
             read_stdv += pow(model.get_mean(k) - read_mean, 2);
         }
         read_stdv = sqrt(read_stdv / kmers.size());
@@ -29,7 +29,8 @@ const Fast5Reader::Params Fast5Reader::PRMS_DEF = {
     fast5_list : "",
     read_list  : "",
     max_reads  : 0,
-    max_buffer : 100
+    max_buffer : 100,
+    stream_signal : false
 };
 
 const std::string Fast5Reader::FMT_RAW_PATHS[] = {
@@ -58,7 +59,8 @@ Fast5Reader::Fast5Reader(const std::string &fast5_list,
     : PRMS({fast5_list, 
             read_list, 
             max_reads, 
-            max_buffer}) {
+            max_buffer,
+            PRMS_DEF.stream_signal}) {
 
     total_buffered_ = 0;
     if (!PRMS.fast5_list.empty()) load_fast5_list(PRMS.fast5_list);
@@ -183,6 +185,9 @@ bool Fast5Reader::open_next() {
 u32 Fast5Reader::fill_buffer() {
     u32 count = 0;
 
+    //HDF5 isn't thread safe, streamed reads may be loading signal
+    std::lock_guard<std::mutex> lock(ReadBuffer::HDF5_MTX);
+
     //TODO: max total default to max int
     while (buffered_reads_.size() < PRMS.max_buffer) {
 
@@ -218,7 +223,8 @@ u32 Fast5Reader::fill_buffer() {
         //            ch_path =  read_paths_.front() + FMT_CH_PATHS[open_fmt_];
         read_paths_.pop_front();
 
-        buffered_reads_.emplace_back(open_fast5_, raw_path, ch_path);
+        buffered_reads_.emplace_back(open_fast5_, raw_path, ch_path, 
+                                     PRMS.stream_signal);
 
         count++;
         total_buffered_++;
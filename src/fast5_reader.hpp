@@ -42,11 +42,13 @@ class Fast5Reader {
         std::string fast5_list;
         std::string read_list;
         u32 max_reads, max_buffer;
+        bool stream_signal;
     } Params;
     static Params const PRMS_DEF;
 
     typedef struct {
-        const char *fast5_list, *read_list, *max_reads, *max_buffer;
+        const char *fast5_list, *read_list, *max_reads, *max_buffer, 
+                   *stream_signal;
     } Docstrs;
     static constexpr Docstrs DOCSTRS = {
         fast5_list : 
@@ -56,7 +58,10 @@ class Fast5Reader {
         max_reads : 
             "Maximum number of reads to load.",
         max_buffer : 
-            "Maximum number of reads to store in memory."
+            "Maximum number of reads to store in memory.",
+        stream_signal : 
+            "Read signal from fast5 files one chunk at a time while mapping, "
+            "stopping once the read is mapped."
     };
 
 
@@ -118,6 +123,7 @@ class Fast5Reader {
         PY_FAST5_PRM(read_list);
         PY_FAST5_PRM(max_reads);
         PY_FAST5_PRM(max_buffer);
+        PY_FAST5_PRM(stream_signal);
     }
 
     #endif
@@ -0,0 +1,279 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <cstdio>
+#include <atomic>
+#include <bwa/bntseq.h>
+#include <bwa/utils.h>
+#include "index_builder.hpp"
+#include "kmer_masker.hpp"
+#include "suffix_sorter.hpp"
+
+//Defined in submods/bwa/bwtindex.c, but not declared in its headers
+extern "C" bwt_t *bwt_pac2bwt(const char *fn_pac, int use_is);
+
+const u32 IndexBuilder::SA_INTV;
+
+//Anchors are searched for at this many points per thread, so threads
+//which finish early can take more of the walk
+const u32 SEGS_PER_THREAD = 8;
+
+//Substring lengths tried for a unique match, and positions tried per anchor
+const u32 ANCHOR_MIN_LEN = 32,
+          ANCHOR_MAX_LEN = 8192,
+          ANCHOR_STEP = 1024,
+          ANCHOR_TRIES = 64;
+
+//Copied from bwa/bwt.c, where it is static
+//SA index of the suffix one position before that of SA index k
+inline bwtint_t inv_psi(const bwt_t *bwt, bwtint_t k) {
+    bwtint_t x = k - (k > bwt->primary);
+    x = bwt_B0(bwt, x);
+    x = bwt->L2[x] + bwt_occ(bwt, k, x);
+    return k == bwt->primary ? 0 : x;
+}
+
+//Single write, so lines from concurrent stages don't interleave
+void log_stage(const std::string &stage, double ms) {
+    char line[128];
+    snprintf(line, sizeof(line), "[index] %s: %.2f sec\n", 
+             stage.c_str(), ms / 1000);
+    std::cerr << line;
+}
+
+IndexBuilder::IndexBuilder(const std::string &fasta_fname, 
+                           const std::string &prefix, u16 threads) 
+    : fasta_fname_(fasta_fname),
+      prefix_(prefix.empty() ? fasta_fname : prefix),
+      threads_(std::max<u16>(threads, 1)),
+      bwt_(NULL),
+      bwt_built_(false) {}
+
+IndexBuilder::~IndexBuilder() {
+    if (sa_thread_.joinable()) sa_thread_.join();
+    if (bwt_ != NULL) bwt_destroy(bwt_);
+}
+
+bool IndexBuilder::build() {
+    return build_bwt() && start_sa() && wait_sa();
+}
+
+bool IndexBuilder::mask(u32 k, u32 iters) {
+    Timer t;
+    std::string masked_fname = prefix_ + ".mask.fa";
+
+    KmerMasker masker(k, threads_);
+    if (!masker.load_fasta(fasta_fname_)) return false;
+    masker.mask(iters);
+    if (!masker.write_fasta(masked_fname)) return false;
+
+    fasta_fname_ = masked_fname;
+    log_stage("mask", t.get());
+    return true;
+}
+
+bool IndexBuilder::build_bwt() {
+    Timer t;
+
+    //Both strands are packed under a temporary prefix for BWT construction
+    //bwa_idx_build packs them to the final prefix, then overwrites the 
+    //.pac, .ann and .amb with forward-only ones
+    std::string tmp_prefix = prefix_ + ".tmp",
+                tmp_pac = tmp_prefix + ".pac",
+                bwt_fname = prefix_ + ".bwt";
+
+    gzFile fp = xzopen(fasta_fname_.c_str(), "r");
+    i64 l_pac = bns_fasta2bntseq(fp, tmp_prefix.c_str(), 0);
+    err_gzclose(fp);
+    log_stage("pack", t.lap());
+
+    //Packing seeds drand48 to fill in ambiguous bases, so two can't run
+    //at once, but BWT construction doesn't use it
+    std::thread fwd_pack([this]() {
+        Timer ft;
+        gzFile fp = xzopen(fasta_fname_.c_str(), "r");
+        bns_fasta2bntseq(fp, prefix_.c_str(), 1);
+        err_gzclose(fp);
+        log_stage("pack forward", ft.get());
+    });
+
+    //Kept in memory for suffix sorting and SA sampling, where 
+    //bwa_idx_build reloads it. Padded as SuffixSorter requires
+    u64 pac_len = (l_pac + 3) / 4;
+    pac_.assign(pac_len + 8, 0);
+    FILE *pac_in = fopen(tmp_pac.c_str(), "rb");
+    bool pac_read = pac_in != NULL && 
+                    fread(pac_.data(), 1, pac_len, pac_in) == pac_len;
+    if (pac_in != NULL) fclose(pac_in);
+
+    if (pac_read) {
+        //Otherwise same algorithm as BWTALGO_AUTO
+        if (threads_ > 1) {
+            bwt_ = SuffixSorter(pac_, l_pac, threads_).get_bwt();
+        } else if (l_pac > 50000000) {
+            bwt_bwtgen2(tmp_pac.c_str(), bwt_fname.c_str(), BWA_BLOCK_SIZE);
+            bwt_ = bwt_restore_bwt(bwt_fname.c_str());
+        } else {
+            bwt_ = bwt_pac2bwt(tmp_pac.c_str(), 1);
+        }
+        log_stage("bwt", t.lap());
+
+        bwt_bwtupdate_core(bwt_);
+        bwt_gen_cnt_table(bwt_);
+        bwt_dump_bwt(bwt_fname.c_str(), bwt_);
+        log_stage("occ", t.lap());
+    }
+
+    fwd_pack.join();
+
+    for (auto suff : {".pac", ".ann", ".amb"}) {
+        remove((tmp_prefix + suff).c_str());
+    }
+
+    if (!pac_read) {
+        std::cerr << "Error: failed to read \"" << tmp_pac << "\"\n";
+        return false;
+    }
+
+    bwt_built_ = true;
+    return true;
+}
+
+bool IndexBuilder::start_sa() {
+    if (!bwt_built_ || sa_thread_.joinable()) {
+        std::cerr << "Error: BWT must be built before sampling SA\n";
+        return false;
+    }
+    sa_thread_ = std::thread(&IndexBuilder::sample_sa, this);
+    return true;
+}
+
+bool IndexBuilder::wait_sa() {
+    if (!sa_thread_.joinable()) {
+        std::cerr << "Error: SA sampling was not started\n";
+        return false;
+    }
+    sa_thread_.join();
+    return true;
+}
+
+u8 IndexBuilder::get_base(u64 i) const {
+    return (pac_[i >> 2] >> ((~i & 3) << 1)) & 3;
+}
+
+//Finds position in [st, en) whose suffix is the only match of some 
+//substring, which gives its SA index. Same search as bwt_match_exact
+bool IndexBuilder::find_anchor(u64 st, u64 en, Anchor &a) const {
+    u64 n = bwt_->seq_len;
+
+    for (u64 p = st; p < en; p += ANCHOR_STEP) {
+        for (u64 len = ANCHOR_MIN_LEN; len <= ANCHOR_MAX_LEN && p+len <= n; len <<= 2) {
+            bwtint_t k = 0, l = n, ok, ol;
+            for (u64 i = p + len; i > p && k <= l; i--) {
+                u8 c = get_base(i-1);
+                bwt_2occ(bwt_, k - 1, l, c, &ok, &ol);
+                k = bwt_->L2[c] + ok + 1;
+                l = bwt_->L2[c] + ol;
+            }
+
+            if (k == l) {
+                a = {p, k};
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+//Anchors spread across the text, ending with the sentinel suffix
+//Points in long repeats may have no anchor, which only makes a longer walk
+std::vector<IndexBuilder::Anchor> IndexBuilder::find_anchors() const {
+    u64 n = bwt_->seq_len;
+    u32 nsegs = threads_ > 1 ? threads_ * SEGS_PER_THREAD : 1;
+
+    std::vector<Anchor> anchors;
+    Anchor a;
+
+    for (u32 s = 1; s < nsegs; s++) {
+        u64 st = n * s / nsegs;
+        if (!anchors.empty() && st <= anchors.back().pos) continue;
+
+        u64 en = std::min(st + ANCHOR_STEP * ANCHOR_TRIES, n);
+        if (find_anchor(st, en, a)) anchors.push_back(a);
+    }
+
+    anchors.push_back({n, 0});
+    return anchors;
+}
+
+//Each thread walks from an anchor back to the previous one, sampling 
+//like bwt_cal_sa. Every SA index is visited by exactly one thread
+void IndexBuilder::sample_sa() {
+    Timer t;
+    u64 n = bwt_->seq_len;
+
+    if (bwt_->sa != NULL) free(bwt_->sa);
+    bwt_->sa_intv = SA_INTV;
+    bwt_->n_sa = (n + SA_INTV) / SA_INTV;
+    bwt_->sa = (bwtint_t *) calloc(bwt_->n_sa, sizeof(bwtint_t));
+
+    std::vector<Anchor> anchors = find_anchors();
+    std::atomic<u32> next_seg(0);
+
+    auto run = [&]() {
+        u32 s;
+        while ((s = next_seg++) < anchors.size()) {
+            u64 pos = anchors[s].pos, 
+                isa = anchors[s].isa,
+                stop = s > 0 ? anchors[s-1].pos + 1 : 0;
+
+            while (true) {
+                if (isa % SA_INTV == 0) bwt_->sa[isa / SA_INTV] = pos;
+                if (pos == stop) break;
+                pos--;
+                isa = inv_psi(bwt_, isa);
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (u16 i = 1; i < threads_; i++) {
+        workers.emplace_back(run);
+    }
+    run();
+    for (auto &w : workers) w.join();
+
+    //Sentinel suffix, as in bwt_cal_sa
+    bwt_->sa[0] = (bwtint_t) -1;
+
+    std::string sa_fname = prefix_ + ".sa";
+    bwt_dump_sa(sa_fname.c_str(), bwt_);
+
+    bwt_destroy(bwt_);
+    bwt_ = NULL;
+    std::vector<u8>().swap(pac_);
+
+    log_stage("sa", t.get());
+}
@@ -0,0 +1,121 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _INCL_INDEX_BUILDER
+#define _INCL_INDEX_BUILDER
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <bwa/bwt.h>
+#include "util.hpp"
+
+#ifdef PYBIND
+#include <pybind11/pybind11.h>
+#endif
+
+//From submods/bwa/bwtindex.c
+#define BWA_BLOCK_SIZE 10000000
+
+//Prints the time taken by a stage of index building
+void log_stage(const std::string &stage, double ms);
+
+//Builds the same files as bwa_idx_build, in stages which are timed and 
+//run in parallel where possible. The forward-only .pac is packed while 
+//the BWT is constructed, and the SA is sampled by several threads.
+//
+//With more than one thread, the BWT is built by SuffixSorter instead of 
+//BWA's single-threaded algorithms. The .bwt is identical either way.
+//
+//SA sampling runs in the background after build_bwt(), since the .bwt,
+//.pac, .ann and .amb files are all that's needed to parameterize the 
+//index. Threads walk the BWT back from positions whose suffix rank is 
+//found by matching a unique substring, so each SA sample is still 
+//computed exactly as bwt_cal_sa does
+class IndexBuilder {
+    public:
+
+    //SA sample interval used by bwa_idx_build
+    static const u32 SA_INTV = 32;
+
+    IndexBuilder(const std::string &fasta_fname, const std::string &prefix,
+                 u16 threads=1);
+    ~IndexBuilder();
+
+    //Masks high-frequency k-mers (see KmerMasker), and builds the index
+    //from the masked reference, written to <prefix>.mask.fa
+    bool mask(u32 k, u32 iters);
+
+    //Writes .pac, .ann, .amb and .bwt
+    bool build_bwt();
+
+    //Samples the SA in background threads, then writes .sa
+    bool start_sa();
+    bool wait_sa();
+
+    //Runs all stages
+    bool build();
+
+    #ifdef PYBIND
+
+    //Stages only block on C++ threads, so Python threads can run meanwhile
+    #define PY_BUILDER_METH(P) c.def(#P, &IndexBuilder::P, \
+        pybind11::call_guard<pybind11::gil_scoped_release>());
+
+    static void pybind_defs(pybind11::class_<IndexBuilder> &c) {
+        c.def(pybind11::init<const std::string &, const std::string &, u16>(),
+              pybind11::arg("fasta_fname"), pybind11::arg("prefix"), 
+              pybind11::arg("threads")=1);
+        PY_BUILDER_METH(mask);
+        PY_BUILDER_METH(build_bwt);
+        PY_BUILDER_METH(start_sa);
+        PY_BUILDER_METH(wait_sa);
+        PY_BUILDER_METH(build);
+    }
+
+    #endif
+
+    private:
+    //Position in the forward+reverse text with its suffix array index
+    typedef struct {
+        u64 pos, isa;
+    } Anchor;
+
+    u8 get_base(u64 i) const;
+    bool find_anchor(u64 st, u64 en, Anchor &a) const;
+    std::vector<Anchor> find_anchors() const;
+    void sample_sa();
+
+    std::string fasta_fname_, prefix_;
+    u16 threads_;
+
+    bwt_t *bwt_;
+
+    //Packed forward and reverse complement sequence, which the BWT is of
+    std::vector<u8> pac_;
+
+    std::thread sa_thread_;
+    bool bwt_built_;
+};
+
+#endif
@@ -0,0 +1,245 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <cstdio>
+#include "index_presets.hpp"
+
+const char IndexPresets::MAGIC[] = "UNCLPRM";
+const u16 IndexPresets::VERSION;
+const u32 IndexPresets::NAME_LEN, IndexPresets::FM_BINS;
+
+IndexPresets::IndexPresets() {}
+
+bool IndexPresets::load(const std::string &fname) {
+    presets_.clear();
+
+    FILE *in = fopen(fname.c_str(), "rb");
+    if (in == NULL) {
+        std::cerr << "Error: failed to open index presets \"" << fname << "\"\n";
+        return false;
+    }
+
+    char magic[sizeof(MAGIC)];
+    bool binary = fread(magic, 1, sizeof(magic), in) == sizeof(magic) &&
+                  memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+
+    bool ok;
+    if (binary) {
+        ok = load_binary(in, fname);
+        fclose(in);
+    } else {
+        fclose(in);
+        ok = load_text(fname);
+    }
+
+    if (ok && presets_.empty()) {
+        std::cerr << "Error: no presets in \"" << fname << "\"\n";
+        ok = false;
+    }
+
+    if (!ok) presets_.clear();
+    return ok;
+}
+
+bool IndexPresets::load_binary(FILE *in, const std::string &fname) {
+    u16 version;
+    u32 count;
+
+    if (fread(&version, sizeof(version), 1, in) != 1) {
+        std::cerr << "Error: \"" << fname << "\" is truncated\n";
+        return false;
+    }
+
+    if (version != VERSION) {
+        std::cerr << "Error: \"" << fname << "\" is version " << version 
+                  << ", expected " << VERSION << "\n";
+        return false;
+    }
+
+    if (fread(&count, sizeof(count), 1, in) != 1) {
+        std::cerr << "Error: \"" << fname << "\" is truncated\n";
+        return false;
+    }
+
+    char name[NAME_LEN];
+    for (u32 i = 0; i < count; i++) {
+        Preset p;
+        bool ok = fread(name, 1, NAME_LEN, in) == NAME_LEN &&
+                  fread(&p.prob, sizeof(p.prob), 1, in) == 1 &&
+                  fread(&p.speed, sizeof(p.speed), 1, in) == 1 &&
+                  fread(&p.source_prob, sizeof(p.source_prob), 1, in) == 1 &&
+                  fread(p.threshes.data(), sizeof(float), FM_BINS, in) == FM_BINS;
+
+        if (!ok) {
+            std::cerr << "Error: \"" << fname << "\" is truncated\n";
+            return false;
+        }
+
+        if (name[NAME_LEN-1] != '\0') {
+            std::cerr << "Error: preset " << i << " in \"" << fname 
+                      << "\" has an invalid name\n";
+            return false;
+        }
+
+        p.name = name;
+        presets_.push_back(p);
+    }
+
+    if (fgetc(in) != EOF) {
+        std::cerr << "Error: \"" << fname << "\" has data after " 
+                  << count << " presets\n";
+        return false;
+    }
+
+    return true;
+}
+
+bool IndexPresets::load_text(const std::string &fname) {
+    std::ifstream in(fname);
+    std::string line;
+    u32 line_num = 0;
+
+    while (getline(in, line)) {
+        line_num++;
+        if (line.empty()) continue;
+
+        std::stringstream ss(line);
+        std::string name, threshes_str;
+        float prob, speed;
+
+        if (!getline(ss, name, '\t') || !getline(ss, threshes_str, '\t') ||
+            !(ss >> prob >> speed)) {
+            std::cerr << "Error: line " << line_num << " of \"" << fname 
+                      << "\" is malformed\n";
+            return false;
+        }
+
+        std::vector<float> threshes;
+        std::stringstream ts(threshes_str);
+        std::string t;
+        while (getline(ts, t, ',')) {
+            char *end;
+            threshes.push_back(strtof(t.c_str(), &end));
+            if (t.empty() || *end != '\0') {
+                std::cerr << "Error: invalid threshold \"" << t << "\" on line " 
+                          << line_num << " of \"" << fname << "\"\n";
+                return false;
+            }
+        }
+
+        if (!add(name, threshes, prob, speed)) return false;
+    }
+
+    return true;
+}
+
+bool IndexPresets::write(const std::string &fname) const {
+    FILE *out = fopen(fname.c_str(), "wb");
+    if (out == NULL) {
+        std::cerr << "Error: failed to open \"" << fname << "\"\n";
+        return false;
+    }
+
+    u32 count = presets_.size();
+    fwrite(MAGIC, 1, sizeof(MAGIC), out);
+    fwrite(&VERSION, sizeof(VERSION), 1, out);
+    fwrite(&count, sizeof(count), 1, out);
+
+    //Fields written individually so the file has no struct padding
+    char name[NAME_LEN];
+    for (const Preset &p : presets_) {
+        memset(name, 0, NAME_LEN);
+        memcpy(name, p.name.c_str(), p.name.size());
+        fwrite(name, 1, NAME_LEN, out);
+        fwrite(&p.prob, sizeof(p.prob), 1, out);
+        fwrite(&p.speed, sizeof(p.speed), 1, out);
+        fwrite(&p.source_prob, sizeof(p.source_prob), 1, out);
+        fwrite(p.threshes.data(), sizeof(float), FM_BINS, out);
+    }
+
+    bool ok = !ferror(out);
+    return fclose(out) == 0 && ok;
+}
+
+bool IndexPresets::add(const std::string &name, 
+                       const std::vector<float> &threshes,
+                       float prob, float speed) {
+
+    if (name.empty() || name.size() >= NAME_LEN) {
+        std::cerr << "Error: preset name \"" << name << "\" must be 1 to " 
+                  << (NAME_LEN-1) << " characters\n";
+        return false;
+    }
+
+    if (threshes.empty() || threshes.size() > FM_BINS) {
+        std::cerr << "Error: preset \"" << name << "\" must have 1 to " 
+                  << FM_BINS << " thresholds\n";
+        return false;
+    }
+
+    if (find(name) >= 0) {
+        std::cerr << "Error: duplicate preset \"" << name << "\"\n";
+        return false;
+    }
+
+    Preset p;
+    p.name = name;
+    p.prob = prob;
+    p.speed = speed;
+
+    for (u32 i = 0; i < FM_BINS; i++) {
+        u32 t = std::min<u32>(i, threshes.size()-1);
+        p.threshes[FM_BINS-1-i] = threshes[t];
+    }
+
+    //Full FM ranges are in the longest length bin
+    p.source_prob = p.threshes[0];
+
+    presets_.push_back(p);
+    return true;
+}
+
+u32 IndexPresets::size() const {
+    return presets_.size();
+}
+
+const IndexPresets::Preset &IndexPresets::get(u32 i) const {
+    return presets_[i];
+}
+
+i32 IndexPresets::find(const std::string &name) const {
+    for (u32 i = 0; i < presets_.size(); i++) {
+        if (presets_[i].name == name) return i;
+    }
+    return -1;
+}
+
+std::vector<std::string> IndexPresets::get_names() const {
+    std::vector<std::string> names;
+    for (const Preset &p : presets_) names.push_back(p.name);
+    return names;
+}
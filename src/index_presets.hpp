@@ -0,0 +1,109 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _INCL_INDEX_PRESETS
+#define _INCL_INDEX_PRESETS
+
+#include <string>
+#include <vector>
+#include <array>
+#include "util.hpp"
+
+#ifdef PYBIND
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#endif
+
+//Mapping presets of an index (the .uncl file written by "uncalled index")
+//Each preset has a k-mer match probability threshold per FM range length
+//bin, so one file can hold several speed/sensitivity trade-offs
+//
+//File starts with magic string, u16 version and u32 preset count. Each 
+//preset is a NUL padded name of NAME_LEN bytes, then f32 fields prob, 
+//speed, source_prob and FM_BINS thresholds. The threshold for a range of
+//length n is at index clz64(n), so index 63 is for single locations
+//
+//Files from older versions (tab separated name, comma separated 
+//thresholds from the shortest range up, prob and speed) are also read
+class IndexPresets {
+    public:
+
+    static const char MAGIC[];
+    static const u16 VERSION = 1;
+    static const u32 NAME_LEN = 32, FM_BINS = 64;
+
+    typedef struct {
+        std::string name;
+
+        //Expected sensitivity and relative speed, from "uncalled index"
+        float prob, speed;
+
+        //Threshold for k-mers to start new paths from full FM range 
+        float source_prob;
+
+        std::array<float, FM_BINS> threshes;
+    } Preset;
+
+    IndexPresets();
+
+    //Loads binary or legacy text file, returns false if either is malformed
+    bool load(const std::string &fname);
+    bool write(const std::string &fname) const;
+
+    //Adds preset from thresholds for FM range lengths 1, 2-3, 4-7, ...
+    //The last threshold is used for all longer ranges
+    bool add(const std::string &name, const std::vector<float> &threshes,
+             float prob, float speed);
+
+    u32 size() const;
+    const Preset &get(u32 i) const;
+
+    //Index of preset with name, or -1 if there is none
+    i32 find(const std::string &name) const;
+
+    std::vector<std::string> get_names() const;
+
+    #ifdef PYBIND
+
+    #define PY_PRESETS_METH(P) c.def(#P, &IndexPresets::P);
+
+    static void pybind_defs(pybind11::class_<IndexPresets> &c) {
+        c.def(pybind11::init());
+        PY_PRESETS_METH(load);
+        PY_PRESETS_METH(write);
+        PY_PRESETS_METH(add);
+        PY_PRESETS_METH(size);
+        PY_PRESETS_METH(find);
+        PY_PRESETS_METH(get_names);
+    }
+
+    #endif
+
+    private:
+    bool load_binary(FILE *in, const std::string &fname);
+    bool load_text(const std::string &fname);
+
+    std::vector<Preset> presets_;
+};
+
+#endif
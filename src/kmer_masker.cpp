@@ -0,0 +1,231 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <thread>
+#include "kmer_masker.hpp"
+#include "bp.hpp"
+
+const u32 KmerMasker::MAX_K;
+
+inline u8 base_byte(char c) {
+    return (u8) c < 128 ? BASE_BYTES[(u8) c] : 4;
+}
+
+KmerMasker::KmerMasker(u32 k, u16 threads) 
+    : k_(k),
+      threads_(std::max<u16>(threads, 1)) {
+
+    if (k_ < 1 || k_ > MAX_K) {
+        k_ = std::min(std::max<u32>(k_, 1), MAX_K);
+        std::cerr << "Warning: masked k-mer length must be 1-" << MAX_K 
+                  << ", using " << k_ << "\n";
+    }
+
+    kmer_mask_ = (1u << (2*k_)) - 1;
+}
+
+bool KmerMasker::load_fasta(const std::string &fname) {
+    std::ifstream in(fname);
+    if (!in.is_open()) {
+        std::cerr << "Error: failed to open \"" << fname << "\"\n";
+        return false;
+    }
+
+    seq_.clear();
+    names_.clear();
+    seq_starts_.clear();
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+
+        if (line[0] == '>') {
+            if (!names_.empty()) seq_.push_back('N');
+            seq_starts_.push_back(seq_.size());
+            names_.push_back(line.substr(1));
+
+        } else if (names_.empty()) {
+            if (line.empty()) continue;
+            std::cerr << "Error: \"" << fname << "\" is not a FASTA file\n";
+            return false;
+
+        } else {
+            seq_.append(line);
+        }
+    }
+
+    if (names_.empty()) {
+        std::cerr << "Error: no sequences in \"" << fname << "\"\n";
+        return false;
+    }
+
+    //End of the last sequence, as if followed by a separator
+    seq_starts_.push_back(seq_.size() + 1);
+
+    count_kmers();
+    return true;
+}
+
+bool KmerMasker::write_fasta(const std::string &fname) const {
+    std::ofstream out(fname);
+    if (!out.is_open()) {
+        std::cerr << "Error: failed to open \"" << fname << "\"\n";
+        return false;
+    }
+
+    for (u32 i = 0; i < names_.size(); i++) {
+        u64 st = seq_starts_[i], len = seq_starts_[i+1] - 1 - st;
+        out << ">" << names_[i] << "\n";
+        out.write(seq_.data() + st, len);
+        out << "\n";
+    }
+
+    return out.good();
+}
+
+//Calls fn(start, kmer) for each k-mer starting in [st, en) 
+//which has only ACGT bases
+template <typename F>
+void KmerMasker::for_windows(u64 st, u64 en, F fn) const {
+    u64 end = std::min<u64>(en + k_ - 1, seq_.size());
+    u32 kmer = 0, run = 0;
+
+    for (u64 i = st; i < end; i++) {
+        u8 b = base_byte(seq_[i]);
+        if (b >= BASE_COUNT) {
+            run = 0;
+            continue;
+        }
+
+        kmer = ((kmer << 2) | b) & kmer_mask_;
+        if (++run >= k_) fn(i + 1 - k_, kmer);
+    }
+}
+
+//Splits sequence into one section per thread, calls fn(thread, st, en)
+template <typename F>
+void KmerMasker::run_threads(F fn) const {
+    u64 n = seq_.size();
+
+    std::vector<std::thread> workers;
+    for (u16 t = 0; t < threads_; t++) {
+        workers.emplace_back(fn, t, n * t / threads_, n * (t+1) / threads_);
+    }
+    for (auto &w : workers) w.join();
+}
+
+void KmerMasker::count_kmers() {
+    counts_.assign(kmer_mask_ + 1, 0);
+
+    run_threads([this](u16 t, u64 st, u64 en) {
+        for_windows(st, en, [this](u64 s, u32 kmer) {
+            __atomic_fetch_add(&counts_[kmer], 1, __ATOMIC_RELAXED);
+        });
+    });
+}
+
+u64 KmerMasker::mask_top() {
+    if (counts_.empty()) return 0;
+
+    u32 top = std::max_element(counts_.begin(), counts_.end()) - counts_.begin();
+    if (counts_[top] <= 1) return 0;
+
+    std::vector< std::vector<u64> > thread_occs(threads_);
+    run_threads([&](u16 t, u64 st, u64 en) {
+        for_windows(st, en, [&](u64 s, u32 kmer) {
+            if (kmer == top) thread_occs[t].push_back(s);
+        });
+    });
+
+    //Occurrences which overlap or touch the previous one extend its range
+    std::vector< std::pair<u64, u64> > ranges;
+    u64 occs = 0;
+    for (auto &o : thread_occs) {
+        for (u64 s : o) {
+            if (ranges.empty() || s > ranges.back().second) {
+                ranges.push_back({s, s + k_});
+            } else {
+                ranges.back().second = s + k_;
+            }
+        }
+        occs += o.size();
+    }
+
+    //Removes each counted k-mer overlapping a masked base once, 
+    //including ones which overlap two ranges
+    u64 next_st = 0;
+    for (auto &r : ranges) {
+        u64 st = std::max(next_st, r.first + 1 - std::min<u64>(r.first + 1, k_));
+        for_windows(st, r.second, [this](u64 s, u32 kmer) {
+            counts_[kmer]--;
+        });
+        next_st = r.second;
+    }
+
+    for (auto &r : ranges) {
+        std::fill(seq_.begin() + r.first, seq_.begin() + r.second, 'N');
+    }
+
+    std::cerr << "masked " << occs << " occurrences of " 
+              << kmer_to_str(top) << "\n";
+
+    return occs;
+}
+
+u64 KmerMasker::mask(u32 iters) {
+    u64 total = 0;
+    for (u32 i = 0; i < iters; i++) {
+        std::cerr << "Iteration " << i << ": ";
+        u64 occs = mask_top();
+        if (occs == 0) {
+            std::cerr << "no repeated k-mers left\n";
+            break;
+        }
+        total += occs;
+    }
+    return total;
+}
+
+u32 KmerMasker::get_count(const std::string &kmer) const {
+    if (kmer.size() != k_) return 0;
+
+    u32 code = 0;
+    for (char c : kmer) {
+        u8 b = base_byte(c);
+        if (b >= BASE_COUNT) return 0;
+        code = (code << 2) | b;
+    }
+
+    return counts_[code];
+}
+
+std::string KmerMasker::kmer_to_str(u32 kmer) const {
+    std::string s(k_, 'N');
+    for (u32 i = 0; i < k_; i++) {
+        s[k_-i-1] = BASE_CHARS[(kmer >> (2*i)) & 3];
+    }
+    return s;
+}
@@ -0,0 +1,103 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _INCL_KMER_MASKER
+#define _INCL_KMER_MASKER
+
+#include <string>
+#include <vector>
+#include "util.hpp"
+
+#ifdef PYBIND
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#endif
+
+//Masks high-frequency k-mers of a reference with Ns, replacing 
+//masking/mask_internal.sh. Each iteration masks every occurrence of the
+//most frequent k-mer, including overlapping ones, as mask_kmers.py does.
+//
+//K-mers are counted once, by all threads into a shared table. Masking 
+//only decrements the counts of k-mers overlapping masked bases, which is
+//what a recount would change. K-mers with non-ACGT bases aren't counted
+class KmerMasker {
+    public:
+
+    //Counts are a dense table of 4^k entries
+    static const u32 MAX_K = 12;
+
+    KmerMasker(u32 k, u16 threads=1);
+
+    bool load_fasta(const std::string &fname);
+
+    //Writes each sequence on one line, case kept for unmasked bases
+    bool write_fasta(const std::string &fname) const;
+
+    //Masks the most frequent k-mer if it occurs more than once
+    //Returns number of occurrences masked, or 0 if none were
+    u64 mask_top();
+
+    //Runs mask_top() up to iters times, returns total occurrences masked
+    u64 mask(u32 iters);
+
+    u32 get_count(const std::string &kmer) const;
+
+    #ifdef PYBIND
+
+    #define PY_MASKER_METH(P) c.def(#P, &KmerMasker::P);
+
+    static void pybind_defs(pybind11::class_<KmerMasker> &c) {
+        c.def(pybind11::init<u32, u16>(), 
+              pybind11::arg("k"), pybind11::arg("threads")=1);
+        PY_MASKER_METH(load_fasta);
+        PY_MASKER_METH(write_fasta);
+        PY_MASKER_METH(mask_top);
+        PY_MASKER_METH(mask);
+        PY_MASKER_METH(get_count);
+    }
+
+    #endif
+
+    private:
+    template <typename F>
+    void for_windows(u64 st, u64 en, F fn) const;
+
+    template <typename F>
+    void run_threads(F fn) const;
+
+    void count_kmers();
+    std::string kmer_to_str(u32 kmer) const;
+
+    u32 k_;
+    u16 threads_;
+    u32 kmer_mask_;
+
+    //Sequences joined by single Ns, so no k-mer spans two
+    std::string seq_;
+    std::vector<std::string> names_;
+    std::vector<u64> seq_starts_;
+
+    std::vector<u32> counts_;
+};
+
+#endif
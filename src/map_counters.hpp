@@ -0,0 +1,122 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _INCL_MAP_COUNTERS
+#define _INCL_MAP_COUNTERS
+
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include "read_buffer.hpp"
+#include "util.hpp"
+
+//Counts of mapping work, only collected if compiled with -DMAP_COUNTERS
+//(e.g. "make FLAGS=-DMAP_COUNTERS"). Otherwise the COUNT_* macros are
+//empty and no tags or summaries are output.
+//Counts for each read are output as PAF tags, and summed per mapping
+//thread into a summary printed when the pool stops
+#ifdef MAP_COUNTERS
+#define COUNT_ADD(C, T, N) (C).add(MapCounters::T, N)
+#define COUNT_MAX(C, T, N) (C).set_max(MapCounters::T, N)
+#else
+#define COUNT_ADD(C, T, N)
+#define COUNT_MAX(C, T, N)
+#endif
+
+class MapCounters {
+    public:
+
+    enum Counter {
+        READS,      //reads finished (only set in summaries)
+        EVENTS,     //events mapped
+        PATHS,      //paths created or extended
+        RANKS,      //FM index neighbor (rank) queries
+        SA_LOOKUPS, //suffix array lookups
+        SEEDS,      //paths checked for seeds
+        CLUSTERS,   //seed clusters when read finished
+        MAX_PATHS,  //most paths alive after any event
+        NUM
+    };
+
+    MapCounters() {
+        reset();
+    }
+
+    void reset() {
+        std::fill(counts_, counts_ + NUM, 0);
+    }
+
+    void add(Counter c, u64 n = 1) {
+        counts_[c] += n;
+    }
+
+    void set_max(Counter c, u64 n) {
+        counts_[c] = std::max(counts_[c], n);
+    }
+
+    u64 get(Counter c) const {
+        return counts_[c];
+    }
+
+    //Sums all counts, except maximums
+    void merge(const MapCounters &c) {
+        for (u8 i = 0; i < NUM; i++) {
+            if (i == MAX_PATHS) set_max(MAX_PATHS, c.counts_[i]);
+            else counts_[i] += c.counts_[i];
+        }
+    }
+
+    void set_tags(Paf &p) const {
+        p.set_int(Paf::Tag::EVENTS,     counts_[EVENTS]);
+        p.set_int(Paf::Tag::PATHS,      counts_[PATHS]);
+        p.set_int(Paf::Tag::RANKS,      counts_[RANKS]);
+        p.set_int(Paf::Tag::SA_LOOKUPS, counts_[SA_LOOKUPS]);
+        p.set_int(Paf::Tag::SEEDS,      counts_[SEEDS]);
+        p.set_int(Paf::Tag::CLUSTERS,   counts_[CLUSTERS]);
+        p.set_int(Paf::Tag::MAX_PATHS,  counts_[MAX_PATHS]);
+    }
+
+    //Prints one summary line with totals and means per read
+    void print(std::ostream &out, const std::string &label) const {
+        static const char *NAMES[NUM] = {
+            "reads", "events", "paths", "ranks", 
+            "sa_lookups", "seeds", "clusters", "max_paths"
+        };
+
+        u64 reads = std::max<u64>(counts_[READS], 1);
+
+        out << "#counters " << label;
+        for (u8 i = 0; i < NUM; i++) {
+            out << " " << NAMES[i] << "=" << counts_[i];
+            if (i != READS && i != MAX_PATHS) {
+                out << " (" << (counts_[i] / reads) << "/read)";
+            }
+        }
+        out << "\n";
+    }
+
+    private:
+    u64 counts_[NUM];
+};
+
+#endif
@@ -0,0 +1,269 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <chrono>
+#include <algorithm>
+#include <stdlib.h>
+#include "map_engine.hpp"
+
+MapEngine::MapEngine(Conf &conf) :
+    pool_count_(0),
+    stopped_(false) {
+
+    threads_.reserve(conf.threads);
+    for (u16 t = 0; t < conf.threads; t++) {
+        threads_.emplace_back(conf.interleave_reads);
+    }
+
+    std::vector<u16> cpus = parse_cpu_list(conf.cpu_set);
+
+    for (u16 t = 0; t < threads_.size(); t++) {
+        if (!cpus.empty()) threads_[t].set_cpu(cpus[t % cpus.size()]);
+        threads_[t].start();
+    }
+}
+
+MapEngine::~MapEngine() {
+    stop();
+}
+
+u16 MapEngine::add_pool() {
+    std::lock_guard<std::mutex> lock(pools_mtx_);
+
+    for (MapperThread &t : threads_) {
+        t.out_mtx_.lock();
+        t.out_mappers_.resize(pool_count_+1);
+        t.out_mtx_.unlock();
+    }
+
+    return pool_count_++;
+}
+
+void MapEngine::add_mappers(u16 pool, const std::vector<Mapper *> &mappers) {
+    if (mappers.empty() || threads_.empty()) return;
+
+    std::lock_guard<std::mutex> lock(pools_mtx_);
+
+    std::vector<u32> read_counts(threads_.size());
+    for (u16 t = 0; t < threads_.size(); t++) {
+        read_counts[t] = threads_[t].read_count();
+    }
+
+    //Random start so ties aren't always broken towards thread 0
+    u16 st = (u16) rand();
+
+    std::vector< std::vector<PoolMapper> > assigned(threads_.size());
+    for (Mapper *m : mappers) {
+        u16 min_t = st % threads_.size();
+        for (u16 i = 1; i < threads_.size(); i++) {
+            u16 t = (st+i) % threads_.size();
+            if (read_counts[t] < read_counts[min_t]) min_t = t;
+        }
+
+        assigned[min_t].emplace_back(pool, m);
+        read_counts[min_t]++;
+    }
+
+    for (u16 t = 0; t < threads_.size(); t++) {
+        if (assigned[t].empty()) continue;
+
+        threads_[t].in_mtx_.lock();
+        threads_[t].in_mappers_.insert(threads_[t].in_mappers_.end(),
+                                       assigned[t].begin(),
+                                       assigned[t].end());
+        threads_[t].in_mtx_.unlock();
+    }
+
+    #ifdef DEBUG_THREADS
+    std::cout << "#fill_threads " << pool;
+    for (u32 c : read_counts) std::cout << " " << c;
+    std::cout << "\n";
+    std::cout.flush();
+    #endif
+}
+
+void MapEngine::get_finished(u16 pool, std::vector<Mapper *> &out) {
+    for (MapperThread &t : threads_) {
+        t.out_mtx_.lock();
+        if (pool < t.out_mappers_.size()) {
+            std::vector<Mapper *> &finished = t.out_mappers_[pool];
+            out.insert(out.end(), finished.begin(), finished.end());
+            finished.clear();
+        }
+        t.out_mtx_.unlock();
+    }
+}
+
+u16 MapEngine::thread_count() const {
+    return threads_.size();
+}
+
+u16 MapEngine::pool_count() const {
+    return pool_count_;
+}
+
+void MapEngine::stop() {
+    if (!stopped_) {
+        stopped_ = true;
+        for (MapperThread &t : threads_) {
+            t.running_ = false;
+            t.thread_.join();
+        }
+
+        #ifdef MAP_COUNTERS
+        MapCounters total;
+        for (MapperThread &t : threads_) {
+            t.counters_.print(std::cerr, "thread" + std::to_string(t.tid_));
+            total.merge(t.counters_);
+        }
+        total.print(std::cerr, "total");
+        #endif
+    }
+}
+
+u16 MapEngine::MapperThread::num_threads = 0;
+
+MapEngine::MapperThread::MapperThread(u16 group_size)
+    : tid_(num_threads++),
+      cpu_(-1),
+      numa_node_(0),
+      running_(true),
+      group_size_(group_size > 0 ? group_size : 1) {
+    group_.reserve(group_size_);
+}
+
+MapEngine::MapperThread::MapperThread(MapperThread &&mt) 
+    : tid_(mt.tid_),
+      cpu_(mt.cpu_),
+      numa_node_(mt.numa_node_),
+      running_(mt.running_), 
+      group_size_(mt.group_size_),
+      thread_(std::move(mt.thread_)) {
+    group_.reserve(group_size_);
+}
+
+void MapEngine::MapperThread::set_cpu(u16 cpu) {
+    cpu_ = cpu;
+    numa_node_ = numa_cpu_node(cpu);
+}
+
+void MapEngine::MapperThread::start() {
+    thread_ = std::thread(&MapEngine::MapperThread::run, this);
+
+    if (cpu_ >= 0 && !pin_thread(thread_, {(u16) cpu_})) {
+        std::cerr << "Warning: failed to pin mapper thread " 
+                  << tid_ << " to CPU " << cpu_ << "\n";
+    }
+}
+
+u16 MapEngine::MapperThread::read_count() const {
+    return in_mappers_.size() + active_mappers_.size();
+}
+
+void MapEngine::MapperThread::run() {
+
+    while (running_) {
+        if (read_count() == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            continue;
+        }
+
+        //Read inputs (pop, lock, and swap it)
+        if (!in_mappers_.empty()) {
+
+            in_mtx_.lock();
+            in_tmp_.swap(in_mappers_);
+            in_mtx_.unlock();
+
+            for (auto &pm : in_tmp_) {
+                pm.second->set_numa_node(numa_node_);
+                active_mappers_.push_back(pm);
+            }
+
+            in_tmp_.clear(); //(pop)
+        }
+
+        //Map chunks
+        if (group_size_ == 1) {
+            for (u32 i = 0; i < active_mappers_.size() && running_; i++) {
+                Mapper *m = active_mappers_[i].second;
+
+                m->process_chunk();
+
+                if (m->map_chunk()) {
+                    out_tmp_.push_back(i);
+                }
+            }
+
+        //Map groups of reads in lockstep
+        } else {
+            for (u32 i = 0; i < active_mappers_.size() && running_; 
+                 i += group_size_) {
+
+                u32 n = std::min<u32>(group_size_, active_mappers_.size() - i);
+
+                group_.clear();
+                for (u32 j = i; j < i+n; j++) {
+                    Mapper *m = active_mappers_[j].second;
+                    m->process_chunk();
+                    group_.push_back(m);
+                }
+
+                Mapper::map_chunks(group_, group_finished_);
+
+                for (u32 j = 0; j < n; j++) {
+                    if (group_finished_[j]) out_tmp_.push_back(i+j);
+                }
+            }
+        }
+
+        //Add finished to output of the pool they came from
+        if (!out_tmp_.empty()) {
+
+            out_mtx_.lock();
+            for (auto i : out_tmp_) {
+                PoolMapper &pm = active_mappers_[i];
+                out_mappers_[pm.first].push_back(pm.second);
+
+                #ifdef MAP_COUNTERS
+                counters_.merge(pm.second->get_counters());
+                #endif
+            }
+            out_mtx_.unlock();
+
+            std::sort(out_tmp_.begin(), out_tmp_.end(),
+                      [](u32 a, u32 b) { return a > b; });
+            for (auto i : out_tmp_) {
+                active_mappers_[i] = active_mappers_.back();
+                active_mappers_.pop_back();
+            }
+            out_tmp_.clear();
+        }
+    }
+
+    active_mappers_.clear();
+
+    in_mtx_.lock();
+    in_mappers_.clear();
+    in_mtx_.unlock();
+}
@@ -0,0 +1,124 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _INCL_MAP_ENGINE
+#define _INCL_MAP_ENGINE
+
+#include <thread>
+#include <mutex>
+#include <vector>
+#include "mapper.hpp"
+#include "conf.hpp"
+
+//Pool of mapping threads which can be shared by several RealtimePools
+//(e.g. one per flow cell). The index and model are static members of
+//Mapper, so they are loaded once no matter how many pools are attached.
+//Each pool owns its mappers and hands them to the engine to be mapped,
+//threads are filled least-loaded first across all pools.
+class MapEngine {
+    public:
+
+    MapEngine(Conf &conf);
+    ~MapEngine();
+
+    //Registers a pool, returns ID used to route its finished mappers
+    u16 add_pool();
+
+    //Assigns mappers to the least loaded threads
+    void add_mappers(u16 pool, const std::vector<Mapper *> &mappers);
+
+    //Appends mappers from a pool which are done mapping to "out"
+    void get_finished(u16 pool, std::vector<Mapper *> &out);
+
+    u16 thread_count() const;
+    u16 pool_count() const;
+
+    bool is_stopped() const {return stopped_;}
+    void stop();
+
+    #ifdef PYBIND
+    #define PY_ENGINE_METH(P) c.def(#P, &MapEngine::P);
+
+    static void pybind_defs(pybind11::class_<MapEngine> &c) {
+        c.def(pybind11::init<Conf &>());
+        PY_ENGINE_METH(thread_count);
+        PY_ENGINE_METH(pool_count);
+        PY_ENGINE_METH(is_stopped);
+        PY_ENGINE_METH(stop);
+    }
+    #endif
+
+    private:
+
+    //Mapper tagged with the ID of the pool it belongs to
+    using PoolMapper = std::pair<u16, Mapper *>;
+
+    class MapperThread {
+        public:
+        MapperThread(u16 group_size);
+        MapperThread(MapperThread &&mt);
+
+        void start();
+        void set_cpu(u16 cpu);
+
+        void run();
+
+        u16 read_count() const;
+
+        static u16 num_threads;
+        u16 tid_;
+
+        //CPU thread is pinned to (-1 if unpinned) and its NUMA node
+        i32 cpu_;
+        u16 numa_node_;
+
+        bool running_;
+
+        //Number of mappers interleaved by Mapper::map_chunks
+        u16 group_size_;
+        std::vector<Mapper *> group_;
+        std::vector<bool> group_finished_;
+
+        //Mappers assigned to thread
+        std::vector<PoolMapper> in_mappers_, in_tmp_, active_mappers_;
+
+        //Finished mappers for each pool, indexed by pool ID
+        std::vector< std::vector<Mapper *> > out_mappers_;
+        std::vector<u32> out_tmp_;
+
+        std::mutex in_mtx_, out_mtx_;
+
+        std::thread thread_;
+
+        //Summed over all reads finished by this thread
+        MapCounters counters_;
+    };
+
+    std::vector<MapperThread> threads_;
+    u16 pool_count_;
+    bool stopped_;
+
+    std::mutex pools_mtx_;
+};
+
+#endif
@@ -26,132 +26,140 @@
 #include "map_pool.hpp"
 
 MapPool::MapPool(Conf &conf)
-    : fast5s_(conf.fast5_prms) {
-
-    threads_ = std::vector<MapperThread>(conf.threads);
+    : fast5s_(conf.fast5_prms),
+      reads_(2 * conf.threads),
+      pafs_(conf.fast5_prms.max_buffer),
+      started_(false),
+      stopped_(false) {
+
+    threads_.reserve(conf.threads);
+    for (u16 i = 0; i < conf.threads; i++) {
+        threads_.emplace_back(*this);
+    }
 
-    //fast5s_.fill_buffer();
+    std::vector<u16> cpus = parse_cpu_list(conf.cpu_set);
 
     for (u32 i = 0; i < threads_.size(); i++) {
-        //if (!fast5s_.empty()) {
-        //    ReadBuffer r = fast5s_.pop_read();
-        //    threads_[i].next_read_.swap(r);
-        //    threads_[i].in_buffered_ = true;
-        //}
+        if (!cpus.empty()) threads_[i].set_cpu(cpus[i % cpus.size()]);
         threads_[i].start();
     }
 }
 
+MapPool::~MapPool() {
+    stop();
+}
+
 std::vector<Paf> MapPool::update() {
     std::vector<Paf> ret;
 
-    fast5s_.fill_buffer();
-
-    for (u32 i = 0; i < threads_.size(); i++) {
-        if (threads_[i].out_buffered_) {
-            ret.push_back(threads_[i].paf_out_);
-            threads_[i].out_buffered_ = false;
-        }
-
-
-        if (!threads_[i].in_buffered_) {
-            if (fast5s_.empty()) { 
-                threads_[i].finished_ = true;
-            } else {
-                ReadBuffer r = fast5s_.pop_read();
-                threads_[i].next_read_.swap(r);
-                threads_[i].in_buffered_ = true;
-            }
-        }
+    //Start reading once all fast5s have been added
+    if (!started_) {
+        started_ = true;
+        loader_ = std::thread(&MapPool::load_reads, this);
     }
 
+    pafs_.pop_all(ret, UPDATE_WAIT);
+
     return ret;
 }
 
+void MapPool::load_reads() {
+    while (!stopped_) {
+        fast5s_.fill_buffer();
+        if (fast5s_.empty()) break;
+
+        if (!reads_.push(fast5s_.pop_read())) break;
+    }
+
+    //Workers exit once remaining reads are mapped
+    reads_.close();
+}
+
 void MapPool::add_fast5(const std::string &fast5_name) {
+    if (started_) {
+        std::cerr << "Error: can't add fast5s after mapping has started\n";
+        return;
+    }
     fast5s_.add_fast5(fast5_name);
 }
 
-
 bool MapPool::running() {
+    if (!started_) return true;
+
     for (u16 i = 0; i < threads_.size(); i++) {
         if (threads_[i].running_) return true;
     }
-    return false;
+
+    //Checked after threads, which push their last PAF before ending
+    return !pafs_.empty();
 }
 
 void MapPool::stop() {
-    #ifdef FM_PROFILER
-    FMProfiler prof_combined;
-    #endif
+    if (stopped_.exchange(true)) return;
+
+    reads_.close();
+    pafs_.close();
 
-    //reads_.clear();
     for (auto &t : threads_) {
-        t.stopped_ = true;
         t.mapper_.request_reset();
         t.thread_.join();
-
-        #ifdef FM_PROFILER
-        prof_combined.combine(t.mapper_.fm_profiler_);
-        #endif
     }
 
-    #ifdef FM_PROFILER
-    prof_combined.write("query_counts.bed");
+    if (loader_.joinable()) loader_.join();
+
+    #ifdef MAP_COUNTERS
+    MapCounters total;
+    for (auto &t : threads_) {
+        t.counters_.print(std::cerr, "thread" + std::to_string(t.tid_));
+        total.merge(t.counters_);
+    }
+    total.print(std::cerr, "total");
     #endif
 }
 
 u16 MapPool::MapperThread::THREAD_COUNT = 0;
 
-MapPool::MapperThread::MapperThread()
+MapPool::MapperThread::MapperThread(MapPool &pool)
     : tid_(THREAD_COUNT++),
+      cpu_(-1),
       running_(true),
-      stopped_(false),
-      finished_(false),
-      in_buffered_(false),
-      out_buffered_(false) {
-    
-}
+      pool_(pool) {}
 
 MapPool::MapperThread::MapperThread(MapperThread &&mt) 
     : tid_(mt.tid_),
-      running_(mt.running_),
-      stopped_(mt.stopped_),                                             
-      finished_(mt.finished_),                                             
-      in_buffered_(mt.in_buffered_), 
-      out_buffered_(mt.in_buffered_), 
+      cpu_(mt.cpu_),
+      running_(mt.running_.load()),
+      pool_(mt.pool_),
       mapper_(),
       thread_(std::move(mt.thread_)) {}
 
+void MapPool::MapperThread::set_cpu(u16 cpu) {
+    cpu_ = cpu;
+    mapper_.set_numa_node(numa_cpu_node(cpu));
+}
+
 void MapPool::MapperThread::start() {
     thread_ = std::thread(&MapPool::MapperThread::run, this);
+
+    if (cpu_ >= 0 && !pin_thread(thread_, {(u16) cpu_})) {
+        std::cerr << "Warning: failed to pin mapper thread " 
+                  << tid_ << " to CPU " << cpu_ << "\n";
+    }
 }
 
 void MapPool::MapperThread::run() {
-    running_ = true;
-
-    while (!(finished_ || stopped_)) {
-        while (!in_buffered_ && !(stopped_ || finished_)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        }
+    ReadBuffer read;
 
-        if (finished_ || stopped_) break;
+    while (pool_.reads_.pop(read)) {
+        mapper_.new_read(read);
 
-        mapper_.new_read(next_read_);
-        in_buffered_ = false;
+        Paf paf = mapper_.map_read();
 
-        Paf p = mapper_.map_read();
-
-        while (out_buffered_ && !stopped_) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        }
-
-        paf_out_ = p;
-        out_buffered_ = !stopped_;
-    }
+        #ifdef MAP_COUNTERS
+        counters_.merge(mapper_.get_counters());
+        #endif
 
-    while (out_buffered_ && !stopped_) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        if (!pool_.pafs_.push(std::move(paf))) break;
     }
 
     running_ = false;
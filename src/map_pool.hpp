@@ -25,16 +25,20 @@
 #define _INCL_MAP_POOL
 
 #include <thread>
+#include <atomic>
 #include <vector>
 #include <deque>
 #include <unordered_set>
 #include "conf.hpp"
+#include "bounded_queue.hpp"
 
 class MapPool {
     public:
 
     MapPool(Conf &conf);
+    ~MapPool();
 
+    //Returns finished alignments, waiting up to 100ms for the first
     std::vector<Paf> update();
 
     bool running();
@@ -46,7 +50,8 @@ class MapPool {
 
     static void pybind_defs(pybind11::class_<MapPool> &c) {
         c.def(pybind11::init<Conf &>());
-        PY_MAP_POOL_METH(update);
+        c.def("update", &MapPool::update, 
+              pybind11::call_guard<pybind11::gil_scoped_release>());
         PY_MAP_POOL_METH(running);
         PY_MAP_POOL_METH(add_fast5);
         PY_MAP_POOL_METH(stop);
@@ -55,33 +60,48 @@ class MapPool {
     #endif
 
     private:
+    static const u32 UPDATE_WAIT = 100;
+
+    //Fills read queue from fast5s_ until reads run out or pool stops
+    void load_reads();
+
     Fast5Reader fast5s_;
 
+    //Reads waiting to be mapped and alignments waiting to be output
+    BoundedQueue<ReadBuffer> reads_;
+    BoundedQueue<Paf> pafs_;
+
+    std::thread loader_;
+    bool started_;
+
+    //Read by the loader thread
+    std::atomic<bool> stopped_;
+
     class MapperThread {
         public:
-        MapperThread();
+        MapperThread(MapPool &pool);
         MapperThread(MapperThread &&mt);
 
         void start();
+        void set_cpu(u16 cpu);
         void run();
 
         static u16 THREAD_COUNT;
 
         u16 tid_;
 
-        //running: run method has not ended
-        //stopped: force stopped, like by keyboard interrupt
-        //finished: no more reads left to process
-        bool running_, stopped_, finished_, 
-             in_buffered_, out_buffered_;
+        //CPU thread is pinned to, -1 if unpinned
+        i32 cpu_;
+
+        //running: run method has not ended, read by the pool
+        std::atomic<bool> running_;
 
+        MapPool &pool_;
         Mapper mapper_;
         std::thread thread_;
 
-        ReadBuffer next_read_;
-        Paf paf_out_;
-
-        std::mutex in_mtx_, out_mtx_;
+        //Summed over all reads mapped by this thread
+        MapCounters counters_;
     };
 
     std::vector<MapperThread> threads_;
@@ -35,12 +35,21 @@ Mapper::Params Mapper::PRMS {
     max_events      : 30000,
     max_stay_frac   : 0.5,
     min_seed_prob   : -3.75,
+    prob_lut_bins   : 0,
+    sketch_events   : 0,
+    sketch_margin   : 3,
+    sketch_prob     : -3.5,
     evt_batch_size  : 5,
     evt_timeout     : 10.0,
     chunk_timeout   : 4000.0,
     bwa_prefix      : "",
     idx_preset      : "default",
     model_path      : "",
+    extra_prefixes  : {},
+    extra_presets   : {},
+    extra_roles     : {},
+    map_index       : -1,
+    numa_index      : NumaIndex::NONE,
     seed_prms       : SeedTracker::PRMS_DEF,
     norm_prms       : Normalizer::PRMS_DEF,
     event_prms      : EventDetector::PRMS_DEF,
@@ -51,10 +60,17 @@ Mapper::Params Mapper::PRMS {
     #endif
 };
 
-BwaIndex<KLEN> Mapper::fmi;
-std::vector<float> Mapper::prob_threshes_;
+Mapper::Params Mapper::loaded_prms_;
 
+std::vector<Mapper::RefIndex> Mapper::indexes_;
+
+SignalSketch Mapper::sketch;
+
+#if KMER_LEN == 5
 PoreModel<KLEN> Mapper::model = pmodel_r94_complement;
+#else
+PoreModel<KLEN> Mapper::model;
+#endif
 
 const std::array<u8,Mapper::EVENT_TYPES.size()> Mapper::EVENT_TYPES = {
     Mapper::EVENT_STAY,
@@ -67,8 +83,8 @@ Mapper::Mapper() :
     evdt_(PRMS.event_prms),
     evt_prof_(PRMS.evt_prof_prms),
     norm_(PRMS.norm_prms),
-    seed_tracker_(PRMS.seed_prms),
-    state_(State::INACTIVE) {
+    state_(State::INACTIVE),
+    counters_ended_(false) {
 
     load_static();
 
@@ -77,19 +93,20 @@ Mapper::Mapper() :
     }
     PATH_TAIL_MOVE = 1 << (PRMS.seed_len-1);
 
-    kmer_probs_ = std::vector<float>(kmer_count<KLEN>());
-
-    PathBuffer::reset_count();//TODO is there a better way?
-    prev_paths_ = std::vector<PathBuffer>(PRMS.max_paths);
+    kmer_probs_ = std::vector<KmerProb>(kmer_count<KLEN>(), {0, 0});
+    prob_evt_ = 0;
+    prob_row_ = NULL;
 
-    PathBuffer::reset_count();
-    next_paths_ = std::vector<PathBuffer>(PRMS.max_paths);
-
-    sources_added_ = std::vector<bool>(kmer_count<KLEN>(), false);
+    //Reserved so path buffers are never copied by reallocation
+    searches_.reserve(indexes_.size());
+    for (u16 i = 0; i < indexes_.size(); i++) {
+        searches_.emplace_back(i);
+    }
 
-    prev_size_ = 0;
     event_i_ = 0;
-    seed_tracker_.reset();
+    sketch_replay_ = 0;
+    sketch_checked_ = true;
+    set_map_index(PRMS.map_index);
 
     norm_.set_target(model.get_means_mean(), model.get_means_stdv());
 }
@@ -99,75 +116,339 @@ Mapper::Mapper(const Mapper &m) : Mapper() {}
 Mapper::~Mapper() {
     dbg_close_all();
 
+    for (IndexSearch &s : searches_) {
+        s.free_buffers();
+    }
+}
+
+Mapper::IndexSearch::IndexSearch(u16 idx) :
+    idx_(idx),
+    active_(true),
+    index_(&indexes_[idx]),
+    fmi_(&indexes_[idx].fmi_),
+    seed_tracker_(PRMS.seed_prms),
+    coord32_(fmi_->fits_u32()) {
+
+    if (coord32_) {
+        PathBuffer<u32>::reset_count();//TODO is there a better way?
+        prev_paths32_ = std::vector< PathBuffer<u32> >(PRMS.max_paths);
+
+        PathBuffer<u32>::reset_count();
+        next_paths32_ = std::vector< PathBuffer<u32> >(PRMS.max_paths);
+    } else {
+        PathBuffer<u64>::reset_count();
+        prev_paths_ = std::vector< PathBuffer<u64> >(PRMS.max_paths);
+
+        PathBuffer<u64>::reset_count();
+        next_paths_ = std::vector< PathBuffer<u64> >(PRMS.max_paths);
+    }
+
+    sources_added_ = std::vector<bool>(kmer_count<KLEN>(), false);
+
+    reset();
+}
+
+void Mapper::IndexSearch::reset() {
+    prev_size_ = 0;
+    seed_tracker_.reset();
+
+    //Preset can't change mid-read, so thresholds stay consistent
+    u32 p = index_->get_active_preset();
+    preset_ = &index_->presets_.get(p);
+    source_win_ = index_->source_wins_[p];
+}
+
+void Mapper::IndexSearch::free_buffers() {
     for (u32 i = 0; i < next_paths_.size(); i++) {
         next_paths_[i].free_buffers();
         prev_paths_[i].free_buffers();
     }
+    for (u32 i = 0; i < next_paths32_.size(); i++) {
+        next_paths32_[i].free_buffers();
+        prev_paths32_[i].free_buffers();
+    }
 }
 
+void Mapper::set_numa_node(u16 node) {
+    for (IndexSearch &s : searches_) {
+        s.fmi_ = s.index_->get_fmi(node);
+    }
+}
+
+void Mapper::set_map_index(i32 idx) {
+    if (idx >= (i32) searches_.size()) {
+        std::cerr << "Error: map_index " << idx << " out of range, " 
+                  << searches_.size() << " indexes loaded\n";
+        idx = -1;
+    }
+
+    map_index_ = idx;
+    for (IndexSearch &s : searches_) {
+        s.active_ = idx < 0 || s.idx_ == idx;
+    }
+}
 
 void Mapper::load_static() {
 
-    if (fmi.is_loaded()) return;
+    if (!indexes_.empty()) return;
 
     if (!PRMS.model_path.empty()) {
         model = PoreModel<KLEN>(PRMS.model_path, true);
     }
 
-    fmi.load_index(PRMS.bwa_prefix);
-    if (!fmi.is_loaded()) {
-        std::cerr << "Error: failed to load BWA index\n";
+    if (!model.is_loaded()) {
+        std::cerr << "Error: no pore model loaded, model_path must be "
+                  << "specified for " << KLEN << "-mers\n";
         abort();
     }
 
-    std::ifstream param_file(PRMS.bwa_prefix + INDEX_SUFF);
-    if (!param_file.is_open()) {
-        std::cerr << "Error: failed to load uncalled index\n";
-        abort();
+    add_index(PRMS.bwa_prefix, PRMS.idx_preset);
+
+    for (u16 i = 0; i < PRMS.extra_prefixes.size(); i++) {
+        bool host = true;
+        if (i < PRMS.extra_roles.size()) {
+            const std::string &role = PRMS.extra_roles[i];
+            if (role == "target") {
+                host = false;
+            } else if (role != "host") {
+                std::cerr << "Error: index role must be \"host\" or "
+                          << "\"target\", not \"" << role << "\"\n";
+                abort();
+            }
+        }
+
+        if (i < PRMS.extra_presets.size()) {
+            add_index(PRMS.extra_prefixes[i], PRMS.extra_presets[i], host);
+        } else {
+            add_index(PRMS.extra_prefixes[i], PRMS.idx_preset, host);
+        }
+    }
+
+    if (PRMS.prob_lut_bins > 0) {
+        load_prob_lut();
     }
 
-    std::string param_line;
+    if (PRMS.sketch_events > 0) {
+        load_sketch();
+    }
 
-    char *idx_preset_c = (char *) PRMS.idx_preset.c_str();
-    prob_threshes_.resize(64);
+    loaded_prms_ = PRMS;
+}
 
-    //TODO: clean up parser
-    //maybe use toml?
-    //try making backwards compatible?
-    //definitely more error checking
-    while (getline(param_file, param_line)) {
-        char *param_name = strtok((char *) param_line.c_str(), "\t");
-        char *fn_str = strtok(NULL, "\t");
-        //char *path_str = strtok(NULL, "\t");
-        if ( !PRMS.idx_preset.empty() && strcmp(param_name, idx_preset_c) ) {
-                continue;
+bool Mapper::check_static() {
+    if (indexes_.empty()) return true;
+
+    #define CHECK_PRM(P) \
+        if (!(PRMS.P == loaded_prms_.P)) { \
+            std::cerr << "Error: mapper parameter " #P " differs from " \
+                      << "the one the index was loaded with. Mapping " \
+                      << "parameters are shared by all pools in a " \
+                      << "process\n"; \
+            return false; \
         }
 
-        u8 fmbin = prob_threshes_.size() - 1;
-        char *prob_str;
-        while ( (prob_str = strtok(fn_str, ",")) != NULL ) {
-            fn_str = NULL;
-            prob_threshes_[fmbin] = atof(prob_str);
-            fmbin--;
+    CHECK_PRM(seed_len)
+    CHECK_PRM(min_rep_len)
+    CHECK_PRM(max_rep_copy)
+    CHECK_PRM(max_paths)
+    CHECK_PRM(max_consec_stay)
+    CHECK_PRM(max_events)
+    CHECK_PRM(max_stay_frac)
+    CHECK_PRM(min_seed_prob)
+    CHECK_PRM(prob_lut_bins)
+    CHECK_PRM(sketch_events)
+    CHECK_PRM(sketch_margin)
+    CHECK_PRM(sketch_prob)
+    CHECK_PRM(evt_batch_size)
+    CHECK_PRM(evt_timeout)
+    CHECK_PRM(chunk_timeout)
+    CHECK_PRM(bwa_prefix)
+    CHECK_PRM(idx_preset)
+    CHECK_PRM(model_path)
+    CHECK_PRM(extra_prefixes)
+    CHECK_PRM(extra_presets)
+    CHECK_PRM(extra_roles)
+    CHECK_PRM(map_index)
+    CHECK_PRM(numa_index)
+
+    #undef CHECK_PRM
+
+    return true;
+}
+
+//Built by "uncalled index --sketch" for bwa_prefix only
+//Mapping continues without the prefilter if it can't be used
+void Mapper::load_sketch() {
+    std::string fname = PRMS.bwa_prefix + SKETCH_SUFF;
+    if (!sketch.load(fname)) {
+        std::cerr << "Warning: sketch prefilter disabled\n";
+        return;
+    }
+
+    if (sketch.get_window_len() < KLEN) {
+        std::cerr << "Warning: \"" << fname << "\" windows are shorter than "
+                  << "the model's k-mers, sketch prefilter disabled\n";
+        sketch = SignalSketch();
+        return;
+    }
+
+    sketch.init_scoring(model, PRMS.sketch_prob, PRMS.max_consec_stay);
+}
+
+//Probabilities below every index's thresholds are never used,
+//so the table only needs to cover levels where some k-mer passes
+void Mapper::load_prob_lut() {
+    float min_prob = 0;
+    for (const RefIndex &idx : indexes_) {
+        for (u32 i = 0; i < idx.presets_.size(); i++) {
+            for (float p : idx.presets_.get(i).threshes) {
+                min_prob = std::min(min_prob, p);
+            }
         }
+    }
+
+    model.init_prob_lut(PRMS.prob_lut_bins, model.get_window(min_prob));
+}
+
+//Must be called before any mappers are constructed
+u16 Mapper::add_index(const std::string &prefix, const std::string &preset,
+                      bool host) {
+    indexes_.emplace_back(prefix, preset, host);
+    indexes_.back().load();
+    return indexes_.size() - 1;
+}
+
+u16 Mapper::index_count() {
+    return indexes_.size();
+}
+
+bool Mapper::set_preset(const std::string &name, u16 index) {
+    if (index >= indexes_.size()) {
+        std::cerr << "Warning: can't set preset of index " << index 
+                  << ", only " << indexes_.size() << " loaded\n";
+        return false;
+    }
+    return indexes_[index].set_preset(name);
+}
+
+Mapper::RefIndex::RefIndex(const std::string &prefix, 
+                           const std::string &preset,
+                           bool host) :
+    prefix_(prefix),
+    preset_(preset),
+    host_(host) {}
+
+void Mapper::RefIndex::load() {
+    load_fmi();
+    if (!fmi_.is_loaded()) {
+        std::cerr << "Error: failed to load BWA index \"" << prefix_ << "\"\n";
+        abort();
+    }
+
+    load_presets();
+
+    for (auto &seq : fmi_.get_seqs()) {
+        ref_ids_.push_back(Paf::intern(seq.first));
+    }
+}
+
+BwaIndex<KLEN> *Mapper::RefIndex::get_fmi(u16 node) {
+    if (node > 0 && node <= node_fmis_.size()) {
+        return &node_fmis_[node-1];
+    }
+    return &fmi_;
+}
+
+void Mapper::RefIndex::load_fmi() {
+    u16 nodes = numa_node_count();
+
+    switch (PRMS.numa_index) {
 
-        for (;fmbin < prob_threshes_.size(); fmbin--) {
-            prob_threshes_[fmbin] = prob_threshes_[fmbin+1];
+    case NumaIndex::INTERLEAVE:
+        if (nodes > 1 && !numa_interleave(true)) {
+            std::cerr << "Warning: failed to interleave index memory\n";
         }
+        fmi_.load_index(prefix_);
+        numa_interleave(false);
+        break;
+
+    case NumaIndex::REPLICATE: {
+        //Node 0's copy is fmi_, which unpinned mappers also share
+        node_fmis_.resize(nodes - 1);
+
+        //Each replica is read by a thread pinned to its node, 
+        //so first-touch allocation keeps it in local memory
+        std::vector<std::thread> loaders;
+        for (u16 n = 0; n < nodes; n++) {
+            BwaIndex<KLEN> *fmi = n == 0 ? &fmi_ : &node_fmis_[n-1];
+            loaders.emplace_back([this, n, fmi]() {
+                if (!pin_this_thread(numa_node_cpus(n))) {
+                    std::cerr << "Warning: failed to pin index loader "
+                              << "to NUMA node " << n << "\n";
+                }
+                fmi->load_index(prefix_);
+            });
+        }
+        for (auto &t : loaders) t.join();
+        break;
+    }
+
+    default:
+        fmi_.load_index(prefix_);
+        break;
+    }
+}
+
+void Mapper::RefIndex::load_presets() {
+    if (!presets_.load(prefix_ + INDEX_SUFF)) {
+        std::cerr << "Error: failed to load uncalled index \"" 
+                  << prefix_ << INDEX_SUFF << "\"\n";
+        abort();
     }
 
+    for (u32 i = 0; i < presets_.size(); i++) {
+        source_wins_.push_back(model.get_window(presets_.get(i).source_prob));
+    }
+
+    //First preset is used if none is specified
+    active_preset_ = 0;
+    if (!preset_.empty() && !set_preset(preset_)) {
+        abort();
+    }
+}
+
+bool Mapper::RefIndex::set_preset(const std::string &name) {
+    i32 i = presets_.find(name);
+    if (i < 0) {
+        std::cerr << "Error: index \"" << prefix_ << "\" has no preset \"" 
+                  << name << "\", options are:";
+        for (auto &n : presets_.get_names()) std::cerr << " " << n;
+        std::cerr << "\n";
+        return false;
+    }
+
+    __atomic_store_n(&active_preset_, i, __ATOMIC_RELEASE);
+    return true;
+}
+
+u32 Mapper::RefIndex::get_active_preset() const {
+    return __atomic_load_n(&active_preset_, __ATOMIC_ACQUIRE);
 }
 
 inline u64 Mapper::get_fm_bin(u64 fmlen) {
     return __builtin_clzll(fmlen);
 }
 
-float Mapper::get_prob_thresh(u64 fmlen) const {
-    return prob_threshes_[get_fm_bin(fmlen)];
+float Mapper::IndexSearch::get_prob_thresh(u64 fmlen) const {
+    return preset_->threshes[get_fm_bin(fmlen)];
+}
+
+float Mapper::IndexSearch::get_source_prob() const {
+    return preset_->source_prob;
 }
 
-float Mapper::get_source_prob() const {
-    return prob_threshes_.front();
+float Mapper::IndexSearch::get_source_win() const {
+    return source_win_;
 }
 
 u16 Mapper::get_max_events() const {
@@ -190,15 +471,39 @@ Paf Mapper::map_read() {
 
     map_timer_.reset();
 
-    norm_.set_signal(evdt_.get_means(read_.full_signal_));
-
-    while (!map_next()) {}
+    if (read_.is_streamed()) {
+        map_stream();
+    } else {
+        norm_.set_signal(evdt_.get_means(read_.full_signal_));
+        while (!map_next()) {}
+    }
 
     read_.loc_.set_float(Paf::Tag::MAP_TIME, map_timer_.get());
 
     return read_.loc_;
 }
 
+//Loads, event detects, and maps a streamed read one chunk at a time
+//Stops reading signal as soon as the read is mapped or fails
+void Mapper::map_stream() {
+    norm_.reset();
+
+    bool done = false;
+    while (!done && read_.load_chunk()) {
+        process_chunk();
+        while (!done && has_events()) {
+            done = map_next();
+        }
+    }
+
+    if (!done) {
+        state_ = State::FAILURE;
+        end_counters();
+    }
+
+    read_.close_signal();
+}
+
 void Mapper::new_read(ReadBuffer &r) {
     read_.clear();//TODO: probably shouldn't auto erase previous read
     read_.swap(r);
@@ -217,15 +522,25 @@ void Mapper::new_read(Chunk &chunk) {
 }
 
 void Mapper::reset() {
-    prev_size_ = 0;
+    for (IndexSearch &s : searches_) {
+        s.reset();
+    }
+
     event_i_ = 0;
     reset_ = false;
     last_chunk_ = false;
     state_ = State::MAPPING;
+
+    sketch_scorer_.reset();
+    sketch_events_.clear();
+    sketch_replay_ = 0;
+    sketch_checked_ = !sketch.is_scoring();
+
+    counters_.reset();
+    counters_ended_ = false;
     norm_.skip_unread();
     //norm_.reset();
 
-    seed_tracker_.reset();
     evdt_.reset();
     evt_prof_.reset();
 
@@ -255,7 +570,9 @@ bool Mapper::finished() const {
 
 void Mapper::skip_events(u32 n) {
     event_i_ += n;
-    prev_size_ = 0;
+    for (IndexSearch &s : searches_) {
+        s.prev_size_ = 0;
+    }
 }
 
 void Mapper::request_reset() {
@@ -369,17 +686,72 @@ u16 Mapper::process_chunk() {
 void Mapper::set_failed() {
     state_ = State::FAILURE;
     reset_ = false;
+    end_counters();
 
     read_.loc_.set_float(Paf::Tag::MAP_TIME, map_time_);
     read_.loc_.set_float(Paf::Tag::WAIT_TIME, wait_time_);
 }
 
 bool Mapper::chunk_mapped() {
-    return read_.chunk_processed_ && norm_.empty();
+    return read_.chunk_processed_ && !has_events();
+}
+
+bool Mapper::is_waiting() const {
+    return state_ == State::MAPPING && 
+           read_.chunk_processed_ && 
+           !has_events() &&
+           batch_left_ == 0;
 }
 
 bool Mapper::map_chunk() {
+    if (start_batch()) return true;
+
+    while (batch_left_ > 0) {
+        if (map_batch_event()) return true;
+    }
+
+    return false;
+}
+
+void Mapper::map_chunks(const std::vector<Mapper *> &mappers, 
+                        std::vector<bool> &finished) {
+
+    finished.assign(mappers.size(), false);
+
+    u32 pending = 0;
+    for (u32 i = 0; i < mappers.size(); i++) {
+        Mapper &m = *mappers[i];
+
+        if (m.start_batch()) {
+            finished[i] = true;
+        } else if (m.batch_left_ > 0) {
+
+            //Mapper timers run while the whole group is mapping
+            m.batch_tlimit_ *= mappers.size();
+            pending++;
+        }
+    }
+
+    while (pending > 0) {
+        for (Mapper *m : mappers) {
+            if (m->batch_left_ > 0) m->prefetch();
+        }
+
+        for (u32 i = 0; i < mappers.size(); i++) {
+            Mapper &m = *mappers[i];
+            if (m.batch_left_ == 0) continue;
+
+            finished[i] = m.map_batch_event();
+            pending -= (m.batch_left_ == 0);
+        }
+    }
+}
+
+//Checks for timeouts and sets up the next batch of events
+//Returns true if the read is finished
+bool Mapper::start_batch() {
     wait_time_ += map_timer_.lap();
+    batch_left_ = 0;
 
     if (reset_ || 
         chunk_timer_.get() > PRMS.chunk_timeout ||
@@ -389,13 +761,13 @@ bool Mapper::map_chunk() {
         read_.loc_.set_ended();
         return true;
 
-    } else if (norm_.empty() && 
+    } else if (!has_events() && 
                read_.chunk_processed_ && 
                read_.chunks_maxed()) {
 
         chunk_mtx_.lock();
 
-        if (norm_.empty() && read_.chunk_processed_) {
+        if (!has_events() && read_.chunk_processed_) {
             set_failed();
             chunk_mtx_.unlock();
             return true;
@@ -404,93 +776,226 @@ bool Mapper::map_chunk() {
         chunk_mtx_.unlock();
     }
 
-    if (norm_.empty()) {
+    if (!has_events()) {
         return false;
     }
 
+    batch_left_ = get_max_events();
+    batch_tlimit_ = PRMS.evt_timeout * batch_left_;
 
-    u16 nevents = get_max_events();
-    float tlimit = PRMS.evt_timeout * nevents;
-
-    for (u16 i = 0; i < nevents && !norm_.empty(); i++) {
-        if (map_next()) {
-            read_.loc_.set_float(Paf::Tag::MAP_TIME, map_time_+map_timer_.get());
-            read_.loc_.set_float(Paf::Tag::WAIT_TIME, wait_time_);
-            norm_.skip_unread();
-            return true;
-        }
+    return false;
+}
 
-        if (map_timer_.get() > tlimit) {
-            break;
-        }
+//Maps one event of the current batch
+//Returns true if the read is finished
+bool Mapper::map_batch_event() {
+    if (map_next()) {
+        read_.loc_.set_float(Paf::Tag::MAP_TIME, map_time_+map_timer_.get());
+        read_.loc_.set_float(Paf::Tag::WAIT_TIME, wait_time_);
+        norm_.skip_unread();
+        batch_left_ = 0;
+        return true;
     }
 
-    map_time_ += map_timer_.lap();
+    if (--batch_left_ == 0 || 
+        !has_events() || 
+        map_timer_.get() > batch_tlimit_) {
+
+        batch_left_ = 0;
+        map_time_ += map_timer_.lap();
+    }
 
     return false;
 }
 
+//Prefetches FM index blocks needed to extend current paths
+void Mapper::prefetch() const {
+    for (const IndexSearch &s : searches_) {
+        if (!s.active_) continue;
+
+        for (u32 i = 0; i < s.prev_size_; i++) {
+            if (s.coord32_) {
+                if (s.prev_paths32_[i].is_valid()) {
+                    s.fmi_->prefetch_neighbors(s.prev_paths32_[i].fm_range_);
+                }
+            } else if (s.prev_paths_[i].is_valid()) {
+                s.fmi_->prefetch_neighbors(s.prev_paths_[i].fm_range_);
+            }
+        }
+    }
+}
+
+bool Mapper::has_events() const {
+    return !norm_.empty() || 
+           (sketch_checked_ && sketch_replay_ < sketch_events_.size());
+}
+
 bool Mapper::map_next() {
-    if (norm_.empty() || reset_ || event_i_ >= PRMS.max_events) {
+    if (!has_events() || reset_ || event_i_ >= PRMS.max_events) {
+        state_ = State::FAILURE;
+        end_counters();
+        return true;
+    }
+
+    //Events held back by the sketch are mapped before new ones, one
+    //per call like any other event so batches still apply
+    if (sketch_checked_ && sketch_replay_ < sketch_events_.size()) {
+        event_ = sketch_events_[sketch_replay_++];
+        return map_event();
+    }
+
+    event_ = norm_.pop();
+    COUNT_ADD(counters_, EVENTS, 1);
+
+    //Prefilter, reads which clearly don't match the target are ended
+    //before paying for any FM index search
+    if (!sketch_checked_) {
+        return sketch_next();
+    }
+
+    return map_event();
+}
+
+//Scores the popped event against the sketch, holding it back from the 
+//FM search. Once any path comes within sketch_margin bases of a hit the
+//read can't be ended, so its held back events are mapped as if they
+//weren't and it maps the same as without the prefilter. Only reads 
+//with no such path after sketch_events are ended.
+//Returns true if the read is finished
+bool Mapper::sketch_next() {
+    sketch_scorer_.add(sketch, event_);
+    sketch_events_.push_back(event_);
+
+    if (sketch_scorer_.longest_ + PRMS.sketch_margin >= sketch.get_path_len()) {
+        sketch_checked_ = true;
+        return false;
+    }
+
+    if (sketch_events_.size() >= PRMS.sketch_events) {
         state_ = State::FAILURE;
+        end_counters();
+        return true;
+    }
+
+    return false;
+}
+
+//Searches every index with event_
+//Returns true if the read is finished
+bool Mapper::map_event() {
+    //Invalidates all k-mer probabilities, clearing them if the
+    //counter wraps around
+    if (++prob_evt_ == 0) {
+        for (KmerProb &p : kmer_probs_) p.evt = 0;
+        prob_evt_ = 1;
+    }
+
+    prob_row_ = model.has_prob_lut() ? model.get_prob_row(event_) : NULL;
+
+    //Indexes are searched in lockstep, one event at a time
+    //Stop at the first one with a confident mapping
+    for (IndexSearch &s : searches_) {
+        if (!s.active_ || !search_next(s)) continue;
+
+        SeedCluster sc = s.seed_tracker_.get_final();
+
+        #ifdef DEBUG_CONFIDENCE
+        if (!confident_mapped_) {
+            read_.loc_.set_int(Paf::Tag::CONFIDENT_EVENT, evt_prof_.mask_idx_map_[event_i_]);
+            confident_mapped_ = true;
+            #endif
+
+            
+            #ifdef DEBUG_SEEDS
+            read_.loc_.set_int(Paf::Tag::SEED_CLUSTER, sc.id_);
+            #endif
+
+
+        #ifdef DEBUG_CONFIDENCE
+        }
+        #else
+
+        set_ref_loc(s, sc);
+        if (searches_.size() > 1) {
+            read_.loc_.set_int(Paf::Tag::INDEX, s.idx_);
+        }
+        if (s.index_->host_) {
+            read_.loc_.set_int(Paf::Tag::HOST, 1);
+        }
+        state_ = State::SUCCESS;
+        end_counters();
         return true;
+        #endif
     }
 
+    //dbg_conf_out();
 
-    float event = norm_.pop();
+    //Update event index
+    event_i_++;
+
+    return false;
+}
 
-    //TODO: store kmer_probs_ in static array
-    for (u16 kmer = 0; kmer < kmer_probs_.size(); kmer++) {
-        kmer_probs_[kmer] = model.match_prob(event, kmer);
+bool Mapper::search_next(IndexSearch &s) {
+    if (s.coord32_) {
+        return search_paths(s, s.prev_paths32_, s.next_paths32_);
     }
+    return search_paths(s, s.prev_paths_, s.next_paths_);
+}
+
+template <typename FmCoord>
+bool Mapper::search_paths(IndexSearch &s, 
+                          std::vector< PathBuffer<FmCoord> > &prev_paths,
+                          std::vector< PathBuffer<FmCoord> > &next_paths) {
+    typedef typename PathBuffer<FmCoord>::FmRange FmRange;
 
-    Range prev_range;
-    u16 prev_kmer;
+    u32 prev_kmer;
     float evpr_thresh;
     bool child_found;
 
-    auto next_path = next_paths_.begin();
+    auto next_path = next_paths.begin();
 
     //Find neighbors of previous nodes
-    for (u32 pi = 0; pi < prev_size_; pi++) {
-        if (!prev_paths_[pi].is_valid()) {
+    for (u32 pi = 0; pi < s.prev_size_; pi++) {
+        if (!prev_paths[pi].is_valid()) {
             continue;
         }
 
         child_found = false;
 
-        PathBuffer &prev_path = prev_paths_[pi];
-        Range &prev_range = prev_path.fm_range_;
+        PathBuffer<FmCoord> &prev_path = prev_paths[pi];
+        FmRange &prev_range = prev_path.fm_range_;
         prev_kmer = prev_path.kmer_;
 
-        evpr_thresh = get_prob_thresh(prev_range.length());
+        evpr_thresh = s.get_prob_thresh(prev_range.length());
 
         //evpr_thresh = PRMS.get_path_thresh(prev_path.total_move_len_);
 
         if (prev_path.consec_stays_ < PRMS.max_consec_stay && 
-            kmer_probs_[prev_kmer] >= evpr_thresh) {
+            kmer_prob(prev_kmer) >= evpr_thresh) {
 
             next_path->make_child(prev_path, 
                                   prev_range,
                                   prev_kmer, 
-                                  kmer_probs_[prev_kmer], 
+                                  kmer_prob(prev_kmer), 
                                   EVENT_STAY);
             child_found = true;
 
-            if (++next_path == next_paths_.end()) {
+            if (++next_path == next_paths.end()) {
                 break;
             }
         }
 
         //Add all the neighbors
         for (u8 b = 0; b < BASE_COUNT; b++) {
-            u16 next_kmer = kmer_neighbor<KLEN>(prev_kmer, b);
+            u32 next_kmer = kmer_neighbor<KLEN>(prev_kmer, b);
 
-            if (kmer_probs_[next_kmer] < evpr_thresh) {
+            if (kmer_prob(next_kmer) < evpr_thresh) {
                 continue;
             }
 
-            Range next_range = fmi.get_neighbor(prev_range, b);
+            FmRange next_range = s.fmi_->get_neighbor(prev_range, b);
+            COUNT_ADD(counters_, RANKS, 1);
 
             if (!next_range.is_valid()) {
                 continue;
@@ -499,12 +1004,12 @@ bool Mapper::map_next() {
             next_path->make_child(prev_path, 
                                   next_range,
                                   next_kmer, 
-                                  kmer_probs_[next_kmer], 
+                                  kmer_prob(next_kmer), 
                                   EVENT_MOVE);
 
             child_found = true;
 
-            if (++next_path == next_paths_.end()) {
+            if (++next_path == next_paths.end()) {
                 break;
             }
         }
@@ -514,77 +1019,78 @@ bool Mapper::map_next() {
 
             //Add seeds for non-extended paths
             //Extended paths will be updated after sources filled in
-            update_seeds(prev_path, true);
+            update_seeds(s, prev_path, true);
 
         }
 
-        if (next_path == next_paths_.end()) {
+        if (next_path == next_paths.end()) {
             break;
         }
     }
 
     //Create sources between gaps
-    if (next_path != next_paths_.begin()) {
+    if (next_path != next_paths.begin()) {
 
-        u32 next_size = next_path - next_paths_.begin();
+        u32 next_size = next_path - next_paths.begin();
 
-        pdqsort(next_paths_.begin(), next_path);
-        //std::sort(next_paths_.begin(), next_path);
+        pdqsort(next_paths.begin(), next_path);
+        //std::sort(next_paths.begin(), next_path);
 
-        u16 source_kmer;
-        prev_kmer = kmer_probs_.size(); 
+        u32 source_kmer;
+        prev_kmer = kmer_count<KLEN>(); 
 
-        Range unchecked_range, source_range;
+        FmRange unchecked_range, source_range;
 
         for (u32 i = 0; i < next_size; i++) {
-            source_kmer = next_paths_[i].kmer_;
+            source_kmer = next_paths[i].kmer_;
 
             //Add source for beginning of kmer range
             if (source_kmer != prev_kmer &&
-                next_path != next_paths_.end() &&
-                kmer_probs_[source_kmer] >= get_source_prob()) {
+                next_path != next_paths.end() &&
+                kmer_prob(source_kmer) >= s.get_source_prob()) {
 
-                sources_added_[source_kmer] = true;
+                s.sources_added_[source_kmer] = true;
+                s.sources_list_.push_back(source_kmer);
 
-                source_range = Range(fmi.get_kmer_range(source_kmer).start_,
-                                     next_paths_[i].fm_range_.start_ - 1);
+                source_range = FmRange(s.fmi_->get_kmer_range(source_kmer).start_,
+                                       next_paths[i].fm_range_.start_ - 1);
 
                 if (source_range.is_valid()) {
                     next_path->make_source(source_range,
                                            source_kmer,
-                                           kmer_probs_[source_kmer]);
+                                           kmer_prob(source_kmer));
                     next_path++;
                 }                                    
 
-                unchecked_range = Range(next_paths_[i].fm_range_.end_ + 1,
-                                        fmi.get_kmer_range(source_kmer).end_);
+                unchecked_range = FmRange(next_paths[i].fm_range_.end_ + 1,
+                                          s.fmi_->get_kmer_range(source_kmer).end_);
             }
 
             prev_kmer = source_kmer;
 
-            //Range next_range = next_paths_[i].fm_range_;
+            //Range next_range = next_paths[i].fm_range_;
 
             //Remove paths with duplicate ranges
             //Best path will be listed last
-            if (i < next_size - 1 && next_paths_[i].fm_range_ == next_paths_[i+1].fm_range_) {
-                next_paths_[i].invalidate();
+            if (i < next_size - 1 && next_paths[i].fm_range_ == next_paths[i+1].fm_range_) {
+                next_paths[i].invalidate();
                 continue;
             }
 
             //Start source after current path
             //TODO: check if theres space for a source here, instead of after extra work?
-            if (next_path != next_paths_.end() &&
-                kmer_probs_[source_kmer] >= get_source_prob()) {
+            if (next_path != next_paths.end() &&
+                kmer_prob(source_kmer) >= s.get_source_prob()) {
                 
                 source_range = unchecked_range;
                 
                 //Between this and next path ranges
-                if (i < next_size - 1 && source_kmer == next_paths_[i+1].kmer_) {
+                if (i < next_size - 1 && source_kmer == next_paths[i+1].kmer_) {
 
-                    source_range.end_ = next_paths_[i+1].fm_range_.start_ - 1;
+                    source_range.end_ = next_paths[i+1].fm_range_.start_ - 1;
 
-                    if (unchecked_range.start_ <= next_paths_[i+1].fm_range_.end_) {
-                        unchecked_range.start_ = next_paths_[i+1].fm_range_.end_ + 1;
+                    if (unchecked_range.start_ <= next_paths[i+1].fm_range_.end_) {
+                        unchecked_range.start_ = next_paths[i+1].fm_range_.end_ + 1;
                     }
                 }
 
@@ -593,95 +1099,87 @@ bool Mapper::map_next() {
 
                     next_path->make_source(source_range,
                                            source_kmer,
-                                           kmer_probs_[source_kmer]);
+                                           kmer_prob(source_kmer));
                     next_path++;
                 }
             }
 
-            update_seeds(next_paths_[i], false);
+            update_seeds(s, next_paths[i], false);
         }
     }
 
-    for (u16 kmer = 0; 
-         kmer < kmer_probs_.size() && 
-            next_path != next_paths_.end(); 
-         kmer++) {
+    //Add sources for whole ranges of k-mers that match the event,
+    //only checking k-mers with means close enough to pass. Window is
+    //sorted by mean, so re-sort by k-mer to keep the same sources as a
+    //full scan when max_paths is reached
+    float src_prob = s.get_source_prob();
+    auto sorted = model.get_sorted_range(event_, s.get_source_win());
 
-        Range next_range = fmi.get_kmer_range(kmer);
+    s.window_kmers_.clear();
+    for (u32 i = sorted.first; 
+         i < sorted.second && next_path != next_paths.end(); 
+         i++) {
 
-        if (!sources_added_[kmer] && 
-            kmer_probs_[kmer] >= get_source_prob() &&
-            next_path != next_paths_.end() &&
-            next_range.is_valid()) {
-
-            //TODO: don't write to prob buffer here to speed up source loop
-            next_path->make_source(next_range, kmer, kmer_probs_[kmer]);
-            next_path++;
+        u32 kmer = model.get_sorted_kmer(i);
 
-        } else {
-            sources_added_[kmer] = false;
+        if (!s.sources_added_[kmer] && kmer_prob(kmer) >= src_prob) {
+            s.window_kmers_.push_back(kmer);
         }
     }
+    pdqsort(s.window_kmers_.begin(), s.window_kmers_.end());
 
-    prev_size_ = next_path - next_paths_.begin();
-    prev_paths_.swap(next_paths_);
-
-    dbg_paths_out();
-
-    SeedCluster sc = seed_tracker_.get_final();
+    for (u32 kmer : s.window_kmers_) {
+        if (next_path == next_paths.end()) break;
 
-    if (sc.is_valid()) {
+        FmRange next_range(s.fmi_->get_kmer_range(kmer));
 
-        #ifdef DEBUG_CONFIDENCE
-        if (!confident_mapped_) {
-            read_.loc_.set_int(Paf::Tag::CONFIDENT_EVENT, evt_prof_.mask_idx_map_[event_i_]);
-            confident_mapped_ = true;
-            #endif
-
-            
-            #ifdef DEBUG_SEEDS
-            read_.loc_.set_int(Paf::Tag::SEED_CLUSTER, sc.id_);
-            #endif
-
-
-        #ifdef DEBUG_CONFIDENCE
+        if (next_range.is_valid()) {
+            //TODO: don't write to prob buffer here to speed up source loop
+            next_path->make_source(next_range, kmer, kmer_prob(kmer));
+            next_path++;
         }
-        #else
+    }
 
-        set_ref_loc(sc);
-        state_ = State::SUCCESS;
-        return true;
-        #endif
+    for (u32 kmer : s.sources_list_) {
+        s.sources_added_[kmer] = false;
     }
+    s.sources_list_.clear();
 
-    //dbg_conf_out();
+    s.prev_size_ = next_path - next_paths.begin();
+    prev_paths.swap(next_paths);
 
-    //Update event index
-    event_i_++;
+    COUNT_ADD(counters_, PATHS, s.prev_size_);
+    COUNT_MAX(counters_, MAX_PATHS, s.prev_size_);
 
-    return false;
+    dbg_paths_out(s, prev_paths);
+
+    return s.seed_tracker_.get_final().is_valid();
 }
 
-void Mapper::update_seeds(PathBuffer &path, bool path_ended) {
+template <typename FmCoord>
+void Mapper::update_seeds(IndexSearch &search, PathBuffer<FmCoord> &path, 
+                          bool path_ended) {
 
     if (!path.is_seed_valid(path_ended)) return;
 
     //TODO: store actual SA coords?
     //avoid checking multiple times!
     path.sa_checked_ = true;
+    COUNT_ADD(counters_, SEEDS, 1);
 
     for (u64 s = path.fm_range_.start_; s <= path.fm_range_.end_; s++) {
 
         //TODO: store in buffer, replace sa_checked
         //
         //Reverse the reference coords so they both go L->R
-        u64 sa_end = fmi.size() - fmi.sa(s);
+        u64 sa_end = search.fmi_->size() - search.fmi_->sa(s);
+        COUNT_ADD(counters_, SA_LOOKUPS, 1);
 
         u32 ref_len = path.move_count() + KLEN - 1;
         u64 sa_start = sa_end - ref_len + 1;
 
         //Add seed and store updated seed cluster
-        auto clust = seed_tracker_.add_seed(
+        auto clust = search.seed_tracker_.add_seed(
             sa_end, 
             path.move_count(), 
             event_i_ - path_ended
@@ -689,6 +1187,7 @@ void Mapper::update_seeds(PathBuffer &path, bool path_ended) {
 
         #ifdef DEBUG_SEEDS
         dbg_seeds_out(
+            search,
             path, 
             clust.id_, 
             event_i_ - path_ended, 
@@ -705,50 +1204,71 @@ u32 Mapper::event_to_bp(u32 evt_i, bool last) const {
     return (evt_i * evdt_.mean_event_len() * ReadBuffer::PRMS.bp_per_samp()) + last*(KLEN - 1);
 }                  
 
-void Mapper::set_ref_loc(const SeedCluster &seeds) {
-    bool fwd = seeds.ref_st_ < fmi.size() / 2;
+void Mapper::set_ref_loc(const IndexSearch &s, const SeedCluster &seeds) {
+    bool fwd = seeds.ref_st_ < s.fmi_->size() / 2;
 
     u64 sa_st;
     if (fwd) sa_st = seeds.ref_st_;
-    else      sa_st = fmi.size() - (seeds.ref_en_.end_ + KLEN - 1);
+    else      sa_st = s.fmi_->size() - (seeds.ref_en_.end_ + KLEN - 1);
     
-    std::string rf_name;
+    i32 rid;
     u64 rd_st = event_to_bp(seeds.evt_st_ - PRMS.seed_len),
         rd_en = event_to_bp(seeds.evt_en_, true),
         rd_len = event_to_bp(event_i_, true),
         rf_st = 0,
-        rf_len = fmi.translate_loc(sa_st, rf_name, rf_st), //sets rf_st
+        rf_len = s.fmi_->translate_rid(sa_st, rid, rf_st), //sets rid, rf_st
         rf_en = rf_st + (seeds.ref_en_.end_ - seeds.ref_st_ + KLEN);
 
+    //Only happens if the index is corrupted, leave read unmapped
+    if (rid < 0) {
+        std::cerr << "Error: invalid reference location " << sa_st << "\n";
+        return;
+    }
+
     u16 match_count = seeds.total_len_ + KLEN - 1;
 
     read_.loc_.set_read_len(rd_len);
-    read_.loc_.set_mapped(rd_st, rd_en, rf_name, rf_st, rf_en, rf_len, fwd, match_count);
+    read_.loc_.set_mapped(rd_st, rd_en, s.index_->ref_ids_[rid], 
+                          rf_st, rf_en, rf_len, fwd, match_count);
 
 }
 
+void Mapper::end_counters() {
+    #ifdef MAP_COUNTERS
+    if (counters_ended_) return;
+    counters_ended_ = true;
+
+    for (const IndexSearch &s : searches_) {
+        counters_.add(MapCounters::CLUSTERS, 
+                      s.seed_tracker_.seed_clusters_.size());
+    }
+    counters_.add(MapCounters::READS);
+    counters_.set_tags(read_.loc_);
+    #endif
+}
+
 #ifdef DEBUG_OUT
-u32 Mapper::PathBuffer::count_ = 0;
+template <typename FmCoord>
+u32 Mapper::PathBuffer<FmCoord>::count_ = 0;
 #endif
 
-Mapper::PathBuffer::PathBuffer()
-    : length_(0),
-      prob_sums_(new float[PRMS.seed_len+1]) {
+template <typename FmCoord>
+Mapper::PathBuffer<FmCoord>::PathBuffer()
+    : prob_sums_(new float[PRMS.seed_len+1]),
+      length_(0) {
 
     #ifdef DEBUG_OUT
     id_ = count_++;
     #endif
 }
 
-Mapper::PathBuffer::PathBuffer(const PathBuffer &p) {
-    std::memcpy(this, &p, sizeof(PathBuffer));
-}
-
-void Mapper::PathBuffer::free_buffers() {
+template <typename FmCoord>
+void Mapper::PathBuffer<FmCoord>::free_buffers() {
     delete[] prob_sums_;
 }
 
-void Mapper::PathBuffer::make_source(Range &range, u16 kmer, float prob) {
+template <typename FmCoord>
+void Mapper::PathBuffer<FmCoord>::make_source(FmRange &range, u32 kmer, float prob) {
     length_ = 1;
     consec_stays_ = 0;
     event_moves_ = EVENT_MOVE;
@@ -772,11 +1292,12 @@ void Mapper::PathBuffer::make_source(Range &range, u16 kmer, float prob) {
 }
 
 
-void Mapper::PathBuffer::make_child(PathBuffer &p, 
-                                    Range &range,
-                                    u16 kmer, 
-                                    float prob, 
-                                    u8 move) {
+template <typename FmCoord>
+void Mapper::PathBuffer<FmCoord>::make_child(PathBuffer &p, 
+                                             FmRange &range,
+                                             u32 kmer, 
+                                             float prob, 
+                                             u8 move) {
 
     u8 stay = 1-move;
 
@@ -806,40 +1327,48 @@ void Mapper::PathBuffer::make_child(PathBuffer &p,
     #endif
 }
 
-void Mapper::PathBuffer::invalidate() {
+template <typename FmCoord>
+void Mapper::PathBuffer<FmCoord>::invalidate() {
     length_ = 0;
 }
 
-bool Mapper::PathBuffer::is_valid() const {
+template <typename FmCoord>
+bool Mapper::PathBuffer<FmCoord>::is_valid() const {
     return length_ > 0;
 }
 
-u8 Mapper::PathBuffer::stay_count() const {
+template <typename FmCoord>
+u8 Mapper::PathBuffer<FmCoord>::stay_count() const {
     return length_ - move_count();
     //return path_type_counts_[EVENT_MOVE];
 }
 
-float Mapper::PathBuffer::prob_head() const {
+template <typename FmCoord>
+float Mapper::PathBuffer<FmCoord>::prob_head() const {
     return prob_sums_[length_] - prob_sums_[length_-1];
 
 }
 
-u8 Mapper::PathBuffer::move_count() const {
+template <typename FmCoord>
+u8 Mapper::PathBuffer<FmCoord>::move_count() const {
     return __builtin_popcount(event_moves_);
     //return path_type_counts_[EVENT_MOVE];
 }
 
-u8 Mapper::PathBuffer::type_head() const {
+template <typename FmCoord>
+u8 Mapper::PathBuffer<FmCoord>::type_head() const {
     //return (event_moves_ >> (PRMS.seed_len-2)) & 1;
     return event_moves_ & 1;
 }
 
-u8 Mapper::PathBuffer::type_tail() const {
+template <typename FmCoord>
+u8 Mapper::PathBuffer<FmCoord>::type_tail() const {
     //return event_moves_ & 1;
     return (event_moves_ >> (PRMS.seed_len-2)) & 1;
 }
 
-bool Mapper::PathBuffer::is_seed_valid(bool path_ended) const {
+template <typename FmCoord>
+bool Mapper::PathBuffer<FmCoord>::is_seed_valid(bool path_ended) const {
 
     //All seeds must be same length
     //and have high probability
@@ -863,12 +1392,8 @@ bool Mapper::PathBuffer::is_seed_valid(bool path_ended) const {
 }
 
 
-bool operator< (const Mapper::PathBuffer &p1, 
-                const Mapper::PathBuffer &p2) {
-    return p1.fm_range_ < p2.fm_range_ ||
-           (p1.fm_range_ == p2.fm_range_ && 
-            p1.seed_prob_ < p2.seed_prob_);
-}
+template class Mapper::PathBuffer<u64>;
+template class Mapper::PathBuffer<u32>;
 
 void Mapper::dbg_open_all() {
     #ifdef DEBUG_OUT
@@ -988,8 +1513,10 @@ void Mapper::dbg_events_out() {
     #endif
 }
 
+template <typename FmCoord>
 void Mapper::dbg_seeds_out(
-        const PathBuffer &path, 
+        const IndexSearch &s,
+        const PathBuffer<FmCoord> &path, 
         u32 clust, 
         u32 evt_end,
         u64 sa_start, 
@@ -1001,19 +1528,19 @@ void Mapper::dbg_seeds_out(
     
     //TODO clearly deliniate fm_coord, sa_coord(fw/rv), pacseq_coord, ann_coord
 
-    bool fwd = sa_start < (fmi.size() / 2);
+    bool fwd = sa_start < (s.fmi_->size() / 2);
 
     //TODO change sa_ to clarify unstranded
     u32 sa_half;
     if (fwd) {
         sa_half = sa_start;
     } else {
-        sa_half = fmi.size() - (sa_start + ref_len - 1);
+        sa_half = s.fmi_->size() - (sa_start + ref_len - 1);
     }
 
     std::string rf_name;
     u64 ref_st = 0;
-    fmi.translate_loc(sa_half, rf_name, ref_st);
+    s.fmi_->translate_loc(sa_half, rf_name, ref_st);
 
     seeds_out_ << rf_name << "\t"
                << ref_st << "\t"
@@ -1031,10 +1558,12 @@ void Mapper::dbg_seeds_out(
 
 }
 
-void Mapper::dbg_paths_out() {
+template <typename FmCoord>
+void Mapper::dbg_paths_out(const IndexSearch &s,
+                           const std::vector< PathBuffer<FmCoord> > &paths) {
     #ifdef DEBUG_PATHS
-    for (u32 i = 0; i < prev_size_; i++) {
-        auto &p = prev_paths_[i];
+    for (u32 i = 0; i < s.prev_size_; i++) {
+        auto &p = paths[i];
 
         u32 evt = evt_prof_.mask_idx_map_[event_i_];
 
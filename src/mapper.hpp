@@ -26,15 +26,25 @@
 
 #include <iostream>
 #include <vector>
+#include <type_traits>
 #include "bwa_index.hpp"
 #include "normalizer.hpp"
 #include "event_detector.hpp"
 #include "event_profiler.hpp"
+#include "index_presets.hpp"
+#include "signal_sketch.hpp"
 #include "pore_model.hpp"
 #include "seed_tracker.hpp"
 #include "read_buffer.hpp"
+#include "map_counters.hpp"
+#include "numa.hpp"
 
-const KmerLen KLEN = KmerLen::k5;
+//K-mer length of the pore model, set with "make FLAGS=-DKMER_LEN=9"
+//Only 5-mers have a built-in model, others must specify model_path
+#ifndef KMER_LEN
+#define KMER_LEN 5
+#endif
+const KmerLen KLEN = (KmerLen) KMER_LEN;
 
 //#define DEBUG_TIME
 //#define DEBUG_SEEDS
@@ -42,6 +52,7 @@ const KmerLen KLEN = KmerLen::k5;
 //TODO define as constant somewhere
 //rematch "params" python module
 #define INDEX_SUFF ".uncl"
+#define SKETCH_SUFF ".sketch"
 
 class Mapper {
     public:
@@ -57,6 +68,20 @@ class Mapper {
         float max_stay_frac;
         float min_seed_prob;
 
+        //Event levels precomputed for k-mer match probabilities, 
+        //computed exactly if 0 (see PoreModel::init_prob_lut)
+        u32 prob_lut_bins;
+
+        //Events of each read are scored against the index's signal 
+        //sketch before the FM index is searched. The read is ended
+        //unmapped if none of its sketch paths come within sketch_margin
+        //bases of a hit within sketch_events, otherwise it's mapped as
+        //usual. K-mers match events with probability at least 
+        //sketch_prob (see SignalSketch). Disabled if sketch_events is 0
+        u32 sketch_events;
+        u32 sketch_margin;
+        float sketch_prob;
+
         //realtime only
         u16 evt_batch_size;
         float evt_timeout;
@@ -66,6 +91,20 @@ class Mapper {
         std::string idx_preset;
         std::string model_path;
 
+        //Indexes loaded in addition to bwa_prefix (e.g. host genome)
+        //Presets are matched by position, idx_preset used if missing
+        std::vector<std::string> extra_prefixes;
+        std::vector<std::string> extra_presets;
+
+        //"host" or "target" for each extra index by position, "host" if
+        //missing. Reads mapped to host indexes are always ejected
+        std::vector<std::string> extra_roles;
+
+        //Index each read is mapped to, -1 maps to all indexes at once
+        i32 map_index;
+
+        NumaIndex numa_index;
+
         SeedTracker::Params seed_prms;
         Normalizer::Params norm_prms;
         EventDetector::Params event_prms;
@@ -77,27 +116,92 @@ class Mapper {
 
     } Params;
 
+    //Shared by every Mapper in the process, as are the index and model
+    //loaded from it. All pools must be configured alike, whether or not
+    //they share a MapEngine (see check_static)
     static Params PRMS;
 
+    //Reference index plus the threshold presets from its .uncl file
+    class RefIndex {
+        public:
+        RefIndex(const std::string &prefix, const std::string &preset, 
+                 bool host=false);
+
+        void load();
+
+        //Index replica local to a NUMA node
+        BwaIndex<KLEN> *get_fmi(u16 node);
+
+        //Makes reads started after this call use another preset
+        bool set_preset(const std::string &name);
+        u32 get_active_preset() const;
+
+        std::string prefix_, preset_;
+
+        //Reads mapped here are ejected in both enrich and deplete modes
+        bool host_;
+
+        BwaIndex<KLEN> fmi_;
+
+        //Replicas for NUMA nodes after node 0, which uses fmi_
+        //Empty unless numa_index is REPLICATE
+        std::vector< BwaIndex<KLEN> > node_fmis_;
+
+        IndexPresets presets_;
+
+        //Distance from an event to the mean of any k-mer that could pass
+        //each preset's source_prob, see PoreModel::get_window
+        std::vector<float> source_wins_;
+
+        //Interned Paf ids of reference names, indexed by BWA reference id
+        std::vector<u32> ref_ids_;
+
+        private:
+        void load_fmi();
+        void load_presets();
+
+        //Only accessed atomically, may be switched while mapping
+        u32 active_preset_;
+    };
+
     //TODO PRIVATIZE
-    static BwaIndex<KLEN> fmi;
+    static std::vector<RefIndex> indexes_;
     static PoreModel<KLEN> model;
-    static std::vector<float> prob_threshes_;
+    static SignalSketch sketch;
 
     static void load_static();
+
+    //False if PRMS has changed since load_static(), e.g. a second Conf
+    //with other mapping settings was loaded for a new pool. Reports the
+    //first field that differs. Nested detector, normalizer and seed
+    //params are not compared
+    static bool check_static();
+    static u16 add_index(const std::string &prefix, const std::string &preset,
+                         bool host=false);
+    static u16 index_count();
+
+    //Switches the threshold preset of an index, see RefIndex::set_preset
+    static bool set_preset(const std::string &name, u16 index=0);
     static inline u64 get_fm_bin(u64 fmlen);
 
     enum class State { INACTIVE, MAPPING, SUCCESS, FAILURE };
 
+    //Smallest type that can store a k-mer in each path
+    typedef std::conditional<(KLEN <= KmerLen::k8), u16, u32>::type PathKmer;
+
     Mapper();
     Mapper(const Mapper &m);
 
     ~Mapper();
 
-    float get_prob_thresh(u64 fmlen) const;
-    float get_source_prob() const;
+    //Points mapper at the index replica local to a NUMA node
+    void set_numa_node(u16 node);
+
     u16 get_max_events() const;
 
+    //Restricts mapping to one index, or all if negative
+    void set_map_index(i32 idx);
+
     void new_read(ReadBuffer &r);
     void new_read(Chunk &c);
     void reset();
@@ -112,9 +216,23 @@ class Mapper {
 
     u32 events_mapped() const {return event_i_;}
 
+    //Work counts for the current read, empty unless built with MAP_COUNTERS
+    const MapCounters &get_counters() const {return counters_;}
+
     u16 process_chunk();
     bool chunk_mapped();
+
+    //Still mapping, but all signal received so far has been mapped
+    bool is_waiting() const;
     bool map_chunk();
+
+    //Same as calling map_chunk() on each mapper, but advances all of
+    //them one event at a time, prefetching every mapper's FM index
+    //lookups before any are used to hide memory latency.
+    //Sets finished[i] if mappers[i] is done mapping its read
+    static void map_chunks(const std::vector<Mapper *> &mappers, 
+                           std::vector<bool> &finished);
+
     bool is_chunk_processed() const;
     void request_reset();
     void end_reset();
@@ -136,19 +254,22 @@ class Mapper {
     static u32 PATH_MASK, PATH_TAIL_MOVE;
     //static u32 PATH_MASK;TODO popcount instead of store?
 
+    //FM index path, with 32-bit coordinates if the index fits in 32 bits
+    template <typename FmCoord>
     class PathBuffer {
         public:
 
+        typedef RangeT<FmCoord> FmRange;
+
         PathBuffer();
-        PathBuffer(const PathBuffer &p);
 
-        void make_source(Range &range, 
-                         u16 kmer, 
+        void make_source(FmRange &range, 
+                         u32 kmer, 
                          float prob);
 
         void make_child(PathBuffer &p, 
-                        Range &range, 
-                        u16 kmer, 
+                        FmRange &range, 
+                        u32 kmer, 
                         float prob, 
                         u8 event_type);
 
@@ -166,20 +287,23 @@ class Mapper {
         void free_buffers();
         void print() const;
 
-        Range fm_range_;
-        u8 length_,
-           consec_stays_;
+        //Ordered largest first so paths pack without padding
+        //(32 bytes with 32-bit coordinates, 40 with 64-bit)
+        FmRange fm_range_;
+        float *prob_sums_;
 
         //u8 stay_count_, move_count_;
         //u8 path_type_counts_[EVENT_TYPES.size()];
         u32 event_moves_;
 
+        float seed_prob_;
+
         u16 total_move_len_;
 
-        u16 kmer_;
+        PathKmer kmer_;
 
-        float seed_prob_;
-        float *prob_sums_;
+        u8 length_,
+           consec_stays_;
 
         bool sa_checked_;
 
@@ -193,55 +317,173 @@ class Mapper {
             count_ = 0;
         #endif
         }
+
+        friend bool operator< (const PathBuffer &p1, const PathBuffer &p2) {
+            return p1.fm_range_ < p2.fm_range_ ||
+                   (p1.fm_range_ == p2.fm_range_ && 
+                    p1.seed_prob_ < p2.seed_prob_);
+        }
     };
 
-    friend bool operator< (const PathBuffer &p1, const PathBuffer &p2);
+    //Microbenchmarks in bench.cpp
+    friend class MapperBench;
+
+    //Path search state for one reference index
+    class IndexSearch {
+        public:
+        IndexSearch(u16 idx);
+
+        void reset();
+        void free_buffers();
+
+        float get_prob_thresh(u64 fmlen) const;
+        float get_source_prob() const;
+        float get_source_win() const;
+
+        u16 idx_;
+        bool active_;
+        RefIndex *index_;
+        BwaIndex<KLEN> *fmi_;
+
+        //Preset that was active when the current read started
+        const IndexPresets::Preset *preset_;
+        float source_win_;
+
+        SeedTracker seed_tracker_;
+
+        //Set if index coordinates fit in 32 bits, in which case only
+        //the 32-bit path buffers are allocated and used
+        bool coord32_;
+        std::vector< PathBuffer<u64> > prev_paths_, next_paths_;
+        std::vector< PathBuffer<u32> > prev_paths32_, next_paths32_;
+        std::vector<bool> sources_added_;
+
+        //K-mers set in sources_added_, cleared after each event
+        std::vector<u32> sources_list_;
+
+        //K-mers in the source window, sorted so full-range sources are
+        //added in k-mer order
+        std::vector<u32> window_kmers_;
+        u32 prev_size_;
+    };
 
     private:
 
+    static void load_prob_lut();
+    static void load_sketch();
+
+    //PRMS as of load_static()
+    static Params loaded_prms_;
+
     bool map_next();
+    bool map_event();
+    bool sketch_next();
+
+    //True if events are left to map, from the normalizer or held back
+    //by the sketch
+    bool has_events() const;
+    void map_stream();
 
-    void update_seeds(PathBuffer &p, bool has_children);
+    //map_chunk() split into steps so mappers can be interleaved
+    bool start_batch();
+    bool map_batch_event();
+    void prefetch() const;
 
-    void set_ref_loc(const SeedCluster &seeds);
+    //Extends paths of one index by the current event
+    //Returns true if the index has a confident seed cluster
+    bool search_next(IndexSearch &s);
 
+    template <typename FmCoord>
+    bool search_paths(IndexSearch &s, 
+                      std::vector< PathBuffer<FmCoord> > &prev_paths,
+                      std::vector< PathBuffer<FmCoord> > &next_paths);
+
+    template <typename FmCoord>
+    void update_seeds(IndexSearch &s, PathBuffer<FmCoord> &p, bool has_children);
+
+    void set_ref_loc(const IndexSearch &s, const SeedCluster &seeds);
+
+    //Outputs counters as PAF tags once the read is finished
+    void end_counters();
 
     EventDetector evdt_;
     EventProfiler evt_prof_;
     Normalizer norm_;
-    SeedTracker seed_tracker_;
     ReadBuffer read_;
 
     //u16 channel_;
     //u32 read_num_;
     bool last_chunk_, reset_;//, processing_, adding_;
     State state_;
-    std::vector<float> kmer_probs_;
-    std::vector<PathBuffer> prev_paths_, next_paths_;
-    std::vector<bool> sources_added_;
-    u32 prev_size_,
-        event_i_,
+
+    //Match probabilities of k-mers to the current event, computed on 
+    //first use so the cost of each event scales with the number of 
+    //paths instead of the number of k-mers
+    typedef struct {
+        float prob;
+        u32 evt;
+    } KmerProb;
+
+    std::vector<KmerProb> kmer_probs_;
+    float event_;
+    u32 prob_evt_;
+
+    //Precomputed probabilities for the current event, if prob_lut_bins set
+    const float *prob_row_;
+
+    float kmer_prob(u32 kmer) {
+        if (prob_row_ != NULL) return prob_row_[kmer];
+
+        KmerProb &p = kmer_probs_[kmer];
+        if (p.evt != prob_evt_) {
+            p.prob = model.match_prob(event_, kmer);
+            p.evt = prob_evt_;
+        }
+        return p.prob;
+    }
+
+    //Sketch score of the current read, events held back from the FM 
+    //search until it passes, and the next of them to map after it does
+    SignalSketch::Scorer sketch_scorer_;
+    std::vector<float> sketch_events_;
+    u32 sketch_replay_;
+    bool sketch_checked_;
+
+    std::vector<IndexSearch> searches_;
+    i32 map_index_;
+    u32 event_i_,
         chunk_i_;
     Timer chunk_timer_, map_timer_;
     float map_time_, wait_time_;
 
+    //Events left to map in current batch and time limit for batch
+    u16 batch_left_;
+    float batch_tlimit_;
+
     std::mutex chunk_mtx_;
 
+    MapCounters counters_;
+    bool counters_ended_;
+
 
     //Debug output functions
     //All will be empty if no DEBUG_* macros are defined
     void dbg_open_all();
     void dbg_close_all();
 
+    template <typename FmCoord>
     void dbg_seeds_out(
-        const PathBuffer &path, 
+        const IndexSearch &s,
+        const PathBuffer<FmCoord> &path, 
         u32 clust, 
         u32 evt_end, 
         u64 sa_start, 
         u32 ref_len
     );
 
-    void dbg_paths_out();
+    template <typename FmCoord>
+    void dbg_paths_out(const IndexSearch &s,
+                       const std::vector< PathBuffer<FmCoord> > &paths);
     void dbg_events_out();
     void dbg_conf_out();
 
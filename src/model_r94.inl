@@ -1,1039 +1,1338 @@
+//Generated by uncalled_model, do not edit
+
 #ifndef _INCL_MODEL_R94
 #define _INCL_MODEL_R94
 
 #include "pore_model.hpp"
 
-const std::vector<float> model_r94_means_stdvs = {
-        85.083612,	1.517846, //AAAAA
-        76.635809,	1.705015, //AAAAC
-        83.489101,	1.537572, //AAAAG
-        75.716163,	1.542528, //AAAAT
-        87.429392,	1.962027, //AAACA
-        84.244828,	1.836131, //AAACC
-        86.305639,	1.554534, //AAACG
-        83.004043,	1.588056, //AAACT
-        82.555225,	1.461596, //AAAGA
-        78.564667,	1.427101, //AAAGC
-        81.963762,	1.409894, //AAAGG
-        76.453817,	1.487030, //AAAGT
-        81.670295,	1.980243, //AAATA
-        75.815142,	2.227696, //AAATC
-        78.830515,	1.676175, //AAATG
-        69.548817,	2.008670, //AAATT
-        106.444465,	2.191321, //AACAA
-        99.204036,	1.741661, //AACAC
-        103.855497,	2.289866, //AACAG
-        98.436037,	2.177595, //AACAT
-        106.571950,	1.882637, //AACCA
-        103.300437,	1.753323, //AACCC
-        105.238715,	1.904430, //AACCG
-        102.006200,	1.830978, //AACCT
-        101.029607,	2.247222, //AACGA
-        98.165143,	2.023168, //AACGC
-        101.415409,	2.226676, //AACGG
-        97.193286,	2.645556, //AACGT
-        99.931247,	1.698466, //AACTA
-        92.947418,	1.861358, //AACTC
-        96.889940,	1.644856, //AACTG
-        87.465428,	1.469612, //AACTT
-        78.200147,	1.829158, //AAGAA
-        68.426403,	2.144815, //AAGAC
-        77.043824,	1.828542, //AAGAG
-        68.019966,	1.854593, //AAGAT
-        85.883901,	1.877059, //AAGCA
-        82.128994,	1.706178, //AAGCC
-        83.225063,	1.560138, //AAGCG
-        80.477989,	1.421728, //AAGCT
-        76.226019,	1.833456, //AAGGA
-        72.500218,	1.676900, //AAGGC
-        77.579076,	1.687201, //AAGGG
-        70.938865,	1.760891, //AAGGT
-        75.638499,	2.048050, //AAGTA
-        69.052203,	2.421331, //AAGTC
-        71.345166,	1.996932, //AAGTG
-        63.048387,	2.356355, //AAGTT
-        109.874662,	3.162864, //AATAA
-        106.022879,	3.097662, //AATAC
-        108.351131,	3.024385, //AATAG
-        107.807108,	3.751323, //AATAT
-        118.527373,	2.972605, //AATCA
-        117.783749,	3.047684, //AATCC
-        118.492647,	3.000273, //AATCG
-        118.288404,	3.104102, //AATCT
-        106.202113,	2.994843, //AATGA
-        106.989289,	3.134146, //AATGC
-        107.698742,	2.931226, //AATGG
-        110.036033,	3.567998, //AATGT
-        105.974377,	2.180266, //AATTA
-        101.007011,	2.090218, //AATTC
-        103.624224,	2.200879, //AATTG
-        96.494614,	1.925107, //AATTT
-        91.063935,	2.709875, //ACAAA
-        82.827286,	2.161122, //ACAAC
-        89.668250,	2.817961, //ACAAG
-        81.399158,	2.248901, //ACAAT
-        93.712100,	1.224810, //ACACA
-        91.197680,	1.290436, //ACACC
-        92.814359,	1.397982, //ACACG
-        89.141968,	1.562573, //ACACT
-        85.649215,	2.601181, //ACAGA
-        82.539466,	2.082363, //ACAGC
-        85.983245,	2.501465, //ACAGG
-        78.525355,	2.406247, //ACAGT
-        87.620403,	1.952000, //ACATA
-        81.754986,	2.229315, //ACATC
-        84.716446,	2.185064, //ACATG
-        75.108519,	2.430893, //ACATT
-        102.728561,	1.630852, //ACCAA
-        95.859940,	1.463223, //ACCAC
-        100.618062,	1.842031, //ACCAG
-        94.333022,	1.799272, //ACCAT
-        101.981100,	1.449808, //ACCCA
-        98.881045,	1.401820, //ACCCC
-        100.545131,	1.431916, //ACCCG
-        97.330175,	1.447096, //ACCCT
-        96.772770,	1.820247, //ACCGA
-        93.927720,	1.580932, //ACCGC
-        97.178941,	1.748125, //ACCGG
-        91.510979,	2.134667, //ACCGT
-        96.643337,	1.774084, //ACCTA
-        91.014356,	2.162105, //ACCTC
-        93.670192,	1.638304, //ACCTG
-        85.177870,	1.913109, //ACCTT
-        83.858905,	2.367950, //ACGAA
-        74.980835,	2.003318, //ACGAC
-        82.987047,	2.412907, //ACGAG
-        73.446658,	1.858546, //ACGAT
-        89.312690,	1.442911, //ACGCA
-        86.323377,	1.527415, //ACGCC
-        87.193625,	1.581813, //ACGCG
-        83.913229,	1.560399, //ACGCT
-        82.302804,	2.441716, //ACGGA
-        79.482039,	2.031856, //ACGGC
-        84.018365,	2.352700, //ACGGG
-        76.892461,	2.460963, //ACGGT
-        80.566832,	2.144676, //ACGTA
-        74.831829,	2.495653, //ACGTC
-        76.642618,	2.220054, //ACGTG
-        68.058969,	2.473128, //ACGTT
-        108.509685,	2.640979, //ACTAA
-        104.918573,	2.582529, //ACTAC
-        106.750818,	2.516063, //ACTAG
-        105.454217,	3.038925, //ACTAT
-        113.953194,	2.427926, //ACTCA
-        112.991632,	2.470406, //ACTCC
-        113.249130,	2.498912, //ACTCG
-        112.914763,	2.722041, //ACTCT
-        103.413183,	2.505934, //ACTGA
-        102.985186,	2.565836, //ACTGC
-        104.185570,	2.473458, //ACTGG
-        103.570987,	3.112501, //ACTGT
-        102.431896,	1.860074, //ACTTA
-        97.885436,	1.792855, //ACTTC
-        100.378876,	1.888032, //ACTTG
-        93.742257,	1.897284, //ACTTT
-        78.486621,	1.677481, //AGAAA
-        69.183387,	2.181444, //AGAAC
-        76.854769,	1.595406, //AGAAG
-        68.957203,	1.951472, //AGAAT
-        84.168997,	2.485995, //AGACA
-        80.492355,	2.197200, //AGACC
-        82.888096,	1.981911, //AGACG
-        79.701281,	1.929455, //AGACT
-        77.762694,	1.417762, //AGAGA
-        72.468653,	1.590985, //AGAGC
-        77.847143,	1.358207, //AGAGG
-        71.978664,	1.457057, //AGAGT
-        77.216489,	2.586817, //AGATA
-        71.422591,	2.702412, //AGATC
-        74.323999,	2.058055, //AGATG
-        66.189140,	2.353002, //AGATT
-        104.091032,	2.217680, //AGCAA
-        96.198299,	1.729785, //AGCAC
-        101.244563,	2.293936, //AGCAG
-        95.567360,	2.053863, //AGCAT
-        104.918630,	1.965209, //AGCCA
-        101.892470,	1.763366, //AGCCC
-        103.638970,	1.934645, //AGCCG
-        100.551907,	1.857380, //AGCCT
-        99.355345,	2.248272, //AGCGA
-        95.575361,	1.869846, //AGCGC
-        99.693559,	2.163916, //AGCGG
-        95.320758,	2.467197, //AGCGT
-        98.077835,	1.801944, //AGCTA
-        91.182618,	2.012889, //AGCTC
-        95.116078,	1.678402, //AGCTG
-        86.078294,	1.518410, //AGCTT
-        71.112465,	1.833777, //AGGAA
-        60.756671,	2.325889, //AGGAC
-        69.648530,	1.861102, //AGGAG
-        61.114230,	1.922772, //AGGAT
-        82.559612,	1.896143, //AGGCA
-        78.897571,	1.710818, //AGGCC
-        80.711089,	1.575505, //AGGCG
-        77.451438,	1.474313, //AGGCT
-        72.875238,	1.702104, //AGGGA
-        67.833052,	1.768077, //AGGGC
-        74.265974,	1.512557, //AGGGG
-        67.183573,	1.634836, //AGGGT
-        72.371769,	2.386667, //AGGTA
-        65.940829,	2.691990, //AGGTC
-        68.302129,	2.132513, //AGGTG
-        60.910896,	2.621137, //AGGTT
-        106.293999,	2.967921, //AGTAA
-        100.782710,	2.663822, //AGTAC
-        104.343204,	2.779656, //AGTAG
-        102.996613,	3.770059, //AGTAT
-        114.689739,	2.788713, //AGTCA
-        113.543189,	2.926713, //AGTCC
-        114.395502,	2.905583, //AGTCG
-        113.834084,	3.023806, //AGTCT
-        103.266526,	2.865487, //AGTGA
-        103.095769,	2.925330, //AGTGC
-        104.689494,	2.854346, //AGTGG
-        106.241086,	3.386671, //AGTGT
-        102.512916,	2.404871, //AGTTA
-        96.789072,	2.217327, //AGTTC
-        100.061516,	2.364475, //AGTTG
-        92.800127,	1.913314, //AGTTT
-        92.448524,	2.424337, //ATAAA
-        84.197561,	2.309626, //ATAAC
-        91.171287,	2.478620, //ATAAG
-        83.359138,	2.479595, //ATAAT
-        94.169750,	1.320107, //ATACA
-        91.942741,	1.417739, //ATACC
-        93.017168,	1.341323, //ATACG
-        90.361582,	1.521743, //ATACT
-        89.206133,	2.323276, //ATAGA
-        86.097767,	2.289189, //ATAGC
-        89.743082,	2.340315, //ATAGG
-        83.636428,	2.723338, //ATAGT
-        89.226575,	1.882633, //ATATA
-        85.202341,	2.462911, //ATATC
-        86.841341,	2.119190, //ATATG
-        79.292839,	2.695063, //ATATT
-        103.532725,	2.080524, //ATCAA
-        97.564633,	2.101257, //ATCAC
-        102.075732,	2.400608, //ATCAG
-        95.731816,	2.473610, //ATCAT
-        102.574617,	1.632531, //ATCCA
-        100.050407,	1.608675, //ATCCC
-        101.545332,	1.827966, //ATCCG
-        98.570185,	1.915015, //ATCCT
-        99.554412,	2.591370, //ATCGA
-        96.379887,	2.485991, //ATCGC
-        99.947118,	2.512791, //ATCGG
-        92.924943,	5.740038, //ATCGT
-        97.750933,	1.860970, //ATCTA
-        93.335370,	2.329145, //ATCTC
-        95.467580,	2.032872, //ATCTG
-        87.589371,	2.374892, //ATCTT
-        85.499653,	3.075336, //ATGAA
-        76.493104,	2.535449, //ATGAC
-        85.294462,	3.174293, //ATGAG
-        75.919898,	2.693786, //ATGAT
-        92.059405,	1.482083, //ATGCA
-        89.610534,	1.665776, //ATGCC
-        90.659862,	1.674668, //ATGCG
-        87.758512,	1.839044, //ATGCT
-        87.396287,	3.229588, //ATGGA
-        84.563905,	2.830276, //ATGGC
-        88.711912,	2.988263, //ATGGG
-        82.916112,	3.422647, //ATGGT
-        85.887654,	2.229805, //ATGTA
-        82.191254,	2.831328, //ATGTC
-        83.024561,	2.655150, //ATGTG
-        76.354496,	3.040482, //ATGTT
-        106.223171,	2.163707, //ATTAA
-        101.745044,	2.019532, //ATTAC
-        104.618763,	2.041936, //ATTAG
-        101.795361,	2.505570, //ATTAT
-        109.668584,	2.198568, //ATTCA
-        108.127252,	2.171602, //ATTCC
-        109.056241,	2.226071, //ATTCG
-        108.519198,	2.264576, //ATTCT
-        101.961153,	2.113695, //ATTGA
-        100.761004,	2.066305, //ATTGC
-        102.722574,	1.986539, //ATTGG
-        101.406803,	2.510487, //ATTGT
-        100.147698,	1.708404, //ATTTA
-        95.676644,	1.569772, //ATTTC
-        98.264218,	1.623511, //ATTTG
-        91.867064,	1.513907, //ATTTT
-        85.299201,	1.517846, //CAAAA
-        76.182269,	1.705015, //CAAAC
-        83.515830,	1.537572, //CAAAG
-        75.189913,	1.542528, //CAAAT
-        88.136373,	1.962027, //CAACA
-        84.995473,	1.836131, //CAACC
-        87.006688,	1.554534, //CAACG
-        83.493372,	1.588056, //CAACT
-        82.800198,	1.461596, //CAAGA
-        78.149885,	1.427101, //CAAGC
-        82.266932,	1.409894, //CAAGG
-        75.864969,	1.487030, //CAAGT
-        81.528646,	1.980243, //CAATA
-        75.530028,	2.227696, //CAATC
-        78.684782,	1.676175, //CAATG
-        69.482536,	2.008670, //CAATT
-        105.083413,	2.191321, //CACAA
-        97.615650,	1.741661, //CACAC
-        102.177502,	2.289866, //CACAG
-        96.833636,	2.177595, //CACAT
-        105.427106,	1.882637, //CACCA
-        102.052909,	1.753323, //CACCC
-        103.922479,	1.904430, //CACCG
-        100.585286,	1.830978, //CACCT
-        98.932038,	2.247222, //CACGA
-        95.707254,	2.023168, //CACGC
-        99.142620,	2.226676, //CACGG
-        94.357861,	2.645556, //CACGT
-        98.810434,	1.698466, //CACTA
-        91.730228,	1.861358, //CACTC
-        95.288047,	1.644856, //CACTG
-        86.102083,	1.469612, //CACTT
-        76.923197,	1.829158, //CAGAA
-        67.126672,	2.144815, //CAGAC
-        75.360802,	1.828542, //CAGAG
-        66.746971,	1.854593, //CAGAT
-        85.481267,	1.877059, //CAGCA
-        81.851132,	1.706178, //CAGCC
-        83.215307,	1.560138, //CAGCG
-        80.119853,	1.421728, //CAGCT
-        75.417467,	1.833456, //CAGGA
-        71.582437,	1.676900, //CAGGC
-        76.614621,	1.687201, //CAGGG
-        70.179614,	1.760891, //CAGGT
-        75.143913,	2.048050, //CAGTA
-        68.778678,	2.421331, //CAGTC
-        71.420319,	1.996932, //CAGTG
-        62.882703,	2.356355, //CAGTT
-        107.114152,	3.162864, //CATAA
-        103.026195,	3.097662, //CATAC
-        105.114666,	3.024385, //CATAG
-        104.405725,	3.751323, //CATAT
-        116.473274,	2.972605, //CATCA
-        115.472553,	3.047684, //CATCC
-        115.908028,	3.000273, //CATCG
-        115.949399,	3.104102, //CATCT
-        103.103093,	2.994843, //CATGA
-        103.491687,	3.134146, //CATGC
-        104.304824,	2.931226, //CATGG
-        106.329565,	3.567998, //CATGT
-        102.954711,	2.180266, //CATTA
-        97.929889,	2.090218, //CATTC
-        100.481875,	2.200879, //CATTG
-        93.685052,	1.925107, //CATTT
-        90.886902,	2.709875, //CCAAA
-        82.688617,	2.161122, //CCAAC
-        89.522192,	2.817961, //CCAAG
-        81.161068,	2.248901, //CCAAT
-        94.291383,	1.224810, //CCACA
-        91.692168,	1.290436, //CCACC
-        93.168278,	1.397982, //CCACG
-        89.495678,	1.562573, //CCACT
-        85.669315,	2.601181, //CCAGA
-        82.491813,	2.082363, //CCAGC
-        85.912503,	2.501465, //CCAGG
-        78.582625,	2.406247, //CCAGT
-        87.536432,	1.952000, //CCATA
-        81.650728,	2.229315, //CCATC
-        84.608713,	2.185064, //CCATG
-        75.137628,	2.430893, //CCATT
-        103.838170,	1.630852, //CCCAA
-        96.573356,	1.463223, //CCCAC
-        101.084652,	1.842031, //CCCAG
-        95.085334,	1.799272, //CCCAT
-        103.314435,	1.449808, //CCCCA
-        99.916883,	1.401820, //CCCCC
-        101.723145,	1.431916, //CCCCG
-        98.367101,	1.447096, //CCCCT
-        97.400380,	1.820247, //CCCGA
-        94.424019,	1.580932, //CCCGC
-        97.607286,	1.748125, //CCCGG
-        92.242990,	2.134667, //CCCGT
-        97.963664,	1.774084, //CCCTA
-        92.039801,	2.162105, //CCCTC
-        94.568398,	1.638304, //CCCTG
-        86.037709,	1.913109, //CCCTT
-        83.422980,	2.367950, //CCGAA
-        74.671008,	2.003318, //CCGAC
-        82.208317,	2.412907, //CCGAG
-        73.029003,	1.858546, //CCGAT
-        90.050177,	1.442911, //CCGCA
-        87.004014,	1.527415, //CCGCC
-        87.859546,	1.581813, //CCGCG
-        84.581805,	1.560399, //CCGCT
-        82.036119,	2.441716, //CCGGA
-        79.070131,	2.031856, //CCGGC
-        83.603933,	2.352700, //CCGGG
-        76.331678,	2.460963, //CCGGT
-        80.495558,	2.144676, //CCGTA
-        74.497765,	2.495653, //CCGTC
-        76.660434,	2.220054, //CCGTG
-        67.965198,	2.473128, //CCGTT
-        110.695855,	2.640979, //CCTAA
-        107.048904,	2.582529, //CCTAC
-        108.913506,	2.516063, //CCTAG
-        107.323511,	3.038925, //CCTAT
-        116.314348,	2.427926, //CCTCA
-        115.528260,	2.470406, //CCTCC
-        115.909360,	2.498912, //CCTCG
-        115.279298,	2.722041, //CCTCT
-        105.671966,	2.505934, //CCTGA
-        105.233101,	2.565836, //CCTGC
-        106.591326,	2.473458, //CCTGG
-        105.943748,	3.112501, //CCTGT
-        104.639187,	1.860074, //CCTTA
-        99.568793,	1.792855, //CCTTC
-        102.481258,	1.888032, //CCTTG
-        95.451294,	1.897284, //CCTTT
-        79.257840,	1.677481, //CGAAA
-        69.469963,	2.181444, //CGAAC
-        77.254641,	1.595406, //CGAAG
-        68.955740,	1.951472, //CGAAT
-        85.325087,	2.485995, //CGACA
-        81.790097,	2.197200, //CGACC
-        83.926795,	1.981911, //CGACG
-        80.821263,	1.929455, //CGACT
-        78.431140,	1.417762, //CGAGA
-        73.052438,	1.590985, //CGAGC
-        78.444465,	1.358207, //CGAGG
-        72.213793,	1.457057, //CGAGT
-        77.967189,	2.586817, //CGATA
-        71.522203,	2.702412, //CGATC
-        74.643640,	2.058055, //CGATG
-        66.274033,	2.353002, //CGATT
-        104.795115,	2.217680, //CGCAA
-        96.259419,	1.729785, //CGCAC
-        101.843896,	2.293936, //CGCAG
-        95.726300,	2.053863, //CGCAT
-        105.834966,	1.965209, //CGCCA
-        102.470332,	1.763366, //CGCCC
-        104.360294,	1.934645, //CGCCG
-        101.042529,	1.857380, //CGCCT
-        99.530716,	2.248272, //CGCGA
-        95.495773,	1.869846, //CGCGC
-        99.705019,	2.163916, //CGCGG
-        94.977629,	2.467197, //CGCGT
-        98.917405,	1.801944, //CGCTA
-        91.179629,	2.012889, //CGCTC
-        95.523832,	1.678402, //CGCTG
-        86.274697,	1.518410, //CGCTT
-        71.734459,	1.833777, //CGGAA
-        61.324636,	2.325889, //CGGAC
-        70.009384,	1.861102, //CGGAG
-        61.286638,	1.922772, //CGGAT
-        84.335955,	1.896143, //CGGCA
-        80.706982,	1.710818, //CGGCC
-        82.478291,	1.575505, //CGGCG
-        78.892076,	1.474313, //CGGCT
-        74.045169,	1.702104, //CGGGA
-        69.084817,	1.768077, //CGGGC
-        75.502289,	1.512557, //CGGGG
-        68.194763,	1.634836, //CGGGT
-        73.628429,	2.386667, //CGGTA
-        67.167437,	2.691990, //CGGTC
-        69.531847,	2.132513, //CGGTG
-        61.837098,	2.621137, //CGGTT
-        106.265683,	2.967921, //CGTAA
-        100.721623,	2.663822, //CGTAC
-        104.021897,	2.779656, //CGTAG
-        102.596352,	3.770059, //CGTAT
-        115.352531,	2.788713, //CGTCA
-        114.002652,	2.926713, //CGTCC
-        114.732597,	2.905583, //CGTCG
-        114.235179,	3.023806, //CGTCT
-        102.828262,	2.865487, //CGTGA
-        102.690912,	2.925330, //CGTGC
-        104.332242,	2.854346, //CGTGG
-        105.674186,	3.386671, //CGTGT
-        102.158016,	2.404871, //CGTTA
-        96.373898,	2.217327, //CGTTC
-        99.314245,	2.364475, //CGTTG
-        92.072715,	1.913314, //CGTTT
-        92.562125,	2.424337, //CTAAA
-        84.664034,	2.309626, //CTAAC
-        91.201323,	2.478620, //CTAAG
-        83.598047,	2.479595, //CTAAT
-        94.896464,	1.320107, //CTACA
-        92.593313,	1.417739, //CTACC
-        93.701177,	1.341323, //CTACG
-        91.064522,	1.521743, //CTACT
-        89.526407,	2.323276, //CTAGA
-        86.261535,	2.289189, //CTAGC
-        89.788654,	2.340315, //CTAGG
-        83.321080,	2.723338, //CTAGT
-        89.685334,	1.882633, //CTATA
-        85.951117,	2.462911, //CTATC
-        87.376870,	2.119190, //CTATG
-        80.262479,	2.695063, //CTATT
-        102.665954,	2.080524, //CTCAA
-        97.041059,	2.101257, //CTCAC
-        100.922796,	2.400608, //CTCAG
-        95.628794,	2.473610, //CTCAT
-        101.694192,	1.632531, //CTCCA
-        99.147925,	1.608675, //CTCCC
-        100.516608,	1.827966, //CTCCG
-        97.982527,	1.915015, //CTCCT
-        98.765403,	2.591370, //CTCGA
-        95.390102,	2.485991, //CTCGC
-        98.901758,	2.512791, //CTCGG
-        92.658656,	5.740038, //CTCGT
-        97.135808,	1.860970, //CTCTA
-        93.093150,	2.329145, //CTCTC
-        94.926446,	2.032872, //CTCTG
-        87.812190,	2.374892, //CTCTT
-        84.698420,	3.075336, //CTGAA
-        76.244467,	2.535449, //CTGAC
-        84.349994,	3.174293, //CTGAG
-        75.418002,	2.693786, //CTGAT
-        91.345572,	1.482083, //CTGCA
-        88.826771,	1.665776, //CTGCC
-        90.008825,	1.674668, //CTGCG
-        87.298622,	1.839044, //CTGCT
-        86.122238,	3.229588, //CTGGA
-        82.880303,	2.830276, //CTGGC
-        87.335988,	2.988263, //CTGGG
-        81.364240,	3.422647, //CTGGT
-        84.914632,	2.229805, //CTGTA
-        81.424318,	2.831328, //CTGTC
-        82.231172,	2.655150, //CTGTG
-        75.964444,	3.040482, //CTGTT
-        104.196111,	2.163707, //CTTAA
-        100.287935,	2.019532, //CTTAC
-        102.394288,	2.041936, //CTTAG
-        100.838825,	2.505570, //CTTAT
-        107.930841,	2.198568, //CTTCA
-        106.308733,	2.171602, //CTTCC
-        107.100798,	2.226071, //CTTCG
-        107.156076,	2.264576, //CTTCT
-        99.894877,	2.113695, //CTTGA
-        98.698121,	2.066305, //CTTGC
-        100.143390,	1.986539, //CTTGG
-        99.698475,	2.510487, //CTTGT
-        97.833296,	1.708404, //CTTTA
-        93.994560,	1.569772, //CTTTC
-        96.038527,	1.623511, //CTTTG
-        90.896237,	1.513907, //CTTTT
-        83.386638,	1.517846, //GAAAA
-        74.388394,	1.705015, //GAAAC
-        81.388866,	1.537572, //GAAAG
-        74.042064,	1.542528, //GAAAT
-        87.048645,	1.962027, //GAACA
-        83.557746,	1.836131, //GAACC
-        85.665266,	1.554534, //GAACG
-        82.634133,	1.588056, //GAACT
-        81.166448,	1.461596, //GAAGA
-        76.520803,	1.427101, //GAAGC
-        80.833237,	1.409894, //GAAGG
-        74.795959,	1.487030, //GAAGT
-        80.121540,	1.980243, //GAATA
-        73.854454,	2.227696, //GAATC
-        77.095118,	1.676175, //GAATG
-        68.536043,	2.008670, //GAATT
-        105.222875,	2.191321, //GACAA
-        97.661873,	1.741661, //GACAC
-        102.268034,	2.289866, //GACAG
-        96.832985,	2.177595, //GACAT
-        105.456844,	1.882637, //GACCA
-        102.183376,	1.753323, //GACCC
-        103.955159,	1.904430, //GACCG
-        100.749327,	1.830978, //GACCT
-        100.000783,	2.247222, //GACGA
-        96.771938,	2.023168, //GACGC
-        100.285296,	2.226676, //GACGG
-        95.850103,	2.645556, //GACGT
-        98.853494,	1.698466, //GACTA
-        91.816791,	1.861358, //GACTC
-        95.756422,	1.644856, //GACTG
-        86.309743,	1.469612, //GACTT
-        75.544973,	1.829158, //GAGAA
-        65.307774,	2.144815, //GAGAC
-        74.000863,	1.828542, //GAGAG
-        65.158786,	1.854593, //GAGAT
-        84.680681,	1.877059, //GAGCA
-        80.945784,	1.706178, //GAGCC
-        82.101278,	1.560138, //GAGCG
-        79.170605,	1.421728, //GAGCT
-        74.768355,	1.833456, //GAGGA
-        70.483473,	1.676900, //GAGGC
-        75.925213,	1.687201, //GAGGG
-        69.438371,	1.760891, //GAGGT
-        73.918872,	2.048050, //GAGTA
-        67.155597,	2.421331, //GAGTC
-        69.683295,	1.996932, //GAGTG
-        61.359462,	2.356355, //GAGTT
-        109.281931,	3.162864, //GATAA
-        105.052128,	3.097662, //GATAC
-        107.364989,	3.024385, //GATAG
-        106.904799,	3.751323, //GATAT
-        116.807913,	2.972605, //GATCA
-        116.146652,	3.047684, //GATCC
-        116.561661,	3.000273, //GATCG
-        116.170176,	3.104102, //GATCT
-        105.520597,	2.994843, //GATGA
-        105.928307,	3.134146, //GATGC
-        106.906539,	2.931226, //GATGG
-        108.772450,	3.567998, //GATGT
-        104.306284,	2.180266, //GATTA
-        99.650873,	2.090218, //GATTC
-        102.066628,	2.200879, //GATTG
-        95.442499,	1.925107, //GATTT
-        89.939141,	2.709875, //GCAAA
-        81.679718,	2.161122, //GCAAC
-        88.368133,	2.817961, //GCAAG
-        80.254497,	2.248901, //GCAAT
-        92.784857,	1.224810, //GCACA
-        90.148429,	1.290436, //GCACC
-        91.623348,	1.397982, //GCACG
-        88.076636,	1.562573, //GCACT
-        84.611481,	2.601181, //GCAGA
-        81.523864,	2.082363, //GCAGC
-        84.900396,	2.501465, //GCAGG
-        77.745998,	2.406247, //GCAGT
-        86.489332,	1.952000, //GCATA
-        80.783037,	2.229315, //GCATC
-        83.593272,	2.185064, //GCATG
-        74.258178,	2.430893, //GCATT
-        101.835905,	1.630852, //GCCAA
-        94.988975,	1.463223, //GCCAC
-        99.657423,	1.842031, //GCCAG
-        93.462754,	1.799272, //GCCAT
-        101.336313,	1.449808, //GCCCA
-        98.210369,	1.401820, //GCCCC
-        99.909622,	1.431916, //GCCCG
-        96.660961,	1.447096, //GCCCT
-        96.013791,	1.820247, //GCCGA
-        93.202291,	1.580932, //GCCGC
-        96.358557,	1.748125, //GCCGG
-        90.871380,	2.134667, //GCCGT
-        96.042651,	1.774084, //GCCTA
-        90.369255,	2.162105, //GCCTC
-        93.038318,	1.638304, //GCCTG
-        84.806715,	1.913109, //GCCTT
-        83.047346,	2.367950, //GCGAA
-        74.039586,	2.003318, //GCGAC
-        82.045953,	2.412907, //GCGAG
-        72.597339,	1.858546, //GCGAT
-        88.912531,	1.442911, //GCGCA
-        86.071698,	1.527415, //GCGCC
-        86.786208,	1.581813, //GCGCG
-        83.458958,	1.560399, //GCGCT
-        81.657448,	2.441716, //GCGGA
-        78.721440,	2.031856, //GCGGC
-        83.377785,	2.352700, //GCGGG
-        76.339622,	2.460963, //GCGGT
-        79.952401,	2.144676, //GCGTA
-        74.115989,	2.495653, //GCGTC
-        76.018809,	2.220054, //GCGTG
-        67.578387,	2.473128, //GCGTT
-        107.212991,	2.640979, //GCTAA
-        103.668501,	2.582529, //GCTAC
-        105.168383,	2.516063, //GCTAG
-        104.067110,	3.038925, //GCTAT
-        112.904496,	2.427926, //GCTCA
-        111.825810,	2.470406, //GCTCC
-        112.328850,	2.498912, //GCTCG
-        111.761826,	2.722041, //GCTCT
-        102.355413,	2.505934, //GCTGA
-        101.761822,	2.565836, //GCTGC
-        103.157324,	2.473458, //GCTGG
-        102.644807,	3.112501, //GCTGT
-        101.279065,	1.860074, //GCTTA
-        96.855676,	1.792855, //GCTTC
-        99.374546,	1.888032, //GCTTG
-        92.861408,	1.897284, //GCTTT
-        75.050005,	1.677481, //GGAAA
-        65.414516,	2.181444, //GGAAC
-        73.223645,	1.595406, //GGAAG
-        65.690017,	1.951472, //GGAAT
-        80.837180,	2.485995, //GGACA
-        77.222799,	2.197200, //GGACC
-        79.590032,	1.981911, //GGACG
-        76.630173,	1.929455, //GGACT
-        74.673690,	1.417762, //GGAGA
-        68.985288,	1.590985, //GGAGC
-        74.767069,	1.358207, //GGAGG
-        68.876269,	1.457057, //GGAGT
-        74.093656,	2.586817, //GGATA
-        68.253333,	2.702412, //GGATC
-        71.176950,	2.058055, //GGATG
-        64.016816,	2.353002, //GGATT
-        101.489714,	2.217680, //GGCAA
-        93.334595,	1.729785, //GGCAC
-        98.582676,	2.293936, //GGCAG
-        92.917383,	2.053863, //GGCAT
-        102.288840,	1.965209, //GGCCA
-        98.763940,	1.763366, //GGCCC
-        100.719835,	1.934645, //GGCCG
-        97.887087,	1.857380, //GGCCT
-        96.635617,	2.248272, //GGCGA
-        92.870280,	1.869846, //GGCGC
-        96.969873,	2.163916, //GGCGG
-        92.667522,	2.467197, //GGCGT
-        95.573822,	1.801944, //GGCTA
-        88.517796,	2.012889, //GGCTC
-        92.450082,	1.678402, //GGCTG
-        83.696252,	1.518410, //GGCTT
-        70.102930,	1.833777, //GGGAA
-        59.569718,	2.325889, //GGGAC
-        68.493043,	1.861102, //GGGAG
-        59.868908,	1.922772, //GGGAT
-        81.528162,	1.896143, //GGGCA
-        78.184412,	1.710818, //GGGCC
-        79.861229,	1.575505, //GGGCG
-        76.671709,	1.474313, //GGGCT
-        72.349880,	1.702104, //GGGGA
-        67.246213,	1.768077, //GGGGC
-        73.483347,	1.512557, //GGGGG
-        66.699841,	1.634836, //GGGGT
-        71.363669,	2.386667, //GGGTA
-        64.854176,	2.691990, //GGGTC
-        67.465323,	2.132513, //GGGTG
-        59.958861,	2.621137, //GGGTT
-        103.092591,	2.967921, //GGTAA
-        97.343566,	2.663822, //GGTAC
-        100.909205,	2.779656, //GGTAG
-        99.148854,	3.770059, //GGTAT
-        111.054862,	2.788713, //GGTCA
-        109.830512,	2.926713, //GGTCC
-        110.538821,	2.905583, //GGTCG
-        110.182778,	3.023806, //GGTCT
-        100.227815,	2.865487, //GGTGA
-        99.578682,	2.925330, //GGTGC
-        101.303068,	2.854346, //GGTGG
-        102.523215,	3.386671, //GGTGT
-        98.581507,	2.404871, //GGTTA
-        93.689416,	2.217327, //GGTTC
-        96.220439,	2.364475, //GGTTG
-        89.601902,	1.913314, //GGTTT
-        89.982076,	2.424337, //GTAAA
-        81.539639,	2.309626, //GTAAC
-        88.511340,	2.478620, //GTAAG
-        80.516642,	2.479595, //GTAAT
-        91.990912,	1.320107, //GTACA
-        89.693237,	1.417739, //GTACC
-        90.767179,	1.341323, //GTACG
-        88.301315,	1.521743, //GTACT
-        87.058295,	2.323276, //GTAGA
-        83.481020,	2.289189, //GTAGC
-        87.351838,	2.340315, //GTAGG
-        81.468725,	2.723338, //GTAGT
-        86.728339,	1.882633, //GTATA
-        82.622965,	2.462911, //GTATC
-        84.315010,	2.119190, //GTATG
-        76.806121,	2.695063, //GTATT
-        101.379601,	2.080524, //GTCAA
-        95.391344,	2.101257, //GTCAC
-        99.605998,	2.400608, //GTCAG
-        93.509137,	2.473610, //GTCAT
-        100.670463,	1.632531, //GTCCA
-        97.904316,	1.608675, //GTCCC
-        99.515842,	1.827966, //GTCCG
-        96.368581,	1.915015, //GTCCT
-        97.384795,	2.591370, //GTCGA
-        94.303889,	2.485991, //GTCGC
-        97.717914,	2.512791, //GTCGG
-        92.558778,	5.740038, //GTCGT
-        95.792036,	1.860970, //GTCTA
-        91.270080,	2.329145, //GTCTC
-        93.420874,	2.032872, //GTCTG
-        85.554250,	2.374892, //GTCTT
-        83.601375,	3.075336, //GTGAA
-        74.576246,	2.535449, //GTGAC
-        83.127101,	3.174293, //GTGAG
-        73.838397,	2.693786, //GTGAT
-        90.199927,	1.482083, //GTGCA
-        87.707263,	1.665776, //GTGCC
-        88.805967,	1.674668, //GTGCG
-        85.971831,	1.839044, //GTGCT
-        85.277473,	3.229588, //GTGGA
-        82.128710,	2.830276, //GTGGC
-        86.688362,	2.988263, //GTGGG
-        80.729504,	3.422647, //GTGGT
-        83.508642,	2.229805, //GTGTA
-        79.343863,	2.831328, //GTGTC
-        80.584531,	2.655150, //GTGTG
-        73.464255,	3.040482, //GTGTT
-        104.027773,	2.163707, //GTTAA
-        99.691570,	2.019532, //GTTAC
-        102.254982,	2.041936, //GTTAG
-        99.693864,	2.505570, //GTTAT
-        107.625062,	2.198568, //GTTCA
-        106.305205,	2.171602, //GTTCC
-        107.262057,	2.226071, //GTTCG
-        106.426197,	2.264576, //GTTCT
-        99.968794,	2.113695, //GTTGA
-        98.831631,	2.066305, //GTTGC
-        100.631462,	1.986539, //GTTGG
-        99.458033,	2.510487, //GTTGT
-        98.129942,	1.708404, //GTTTA
-        93.954313,	1.569772, //GTTTC
-        96.300125,	1.623511, //GTTTG
-        90.279102,	1.513907, //GTTTT
-        87.110801,	1.517846, //TAAAA
-        78.283819,	1.705015, //TAAAC
-        85.402786,	1.537572, //TAAAG
-        77.319566,	1.542528, //TAAAT
-        89.949000,	1.962027, //TAACA
-        86.786303,	1.836131, //TAACC
-        88.614569,	1.554534, //TAACG
-        85.332521,	1.588056, //TAACT
-        84.714208,	1.461596, //TAAGA
-        80.019472,	1.427101, //TAAGC
-        84.285796,	1.409894, //TAAGG
-        78.012306,	1.487030, //TAAGT
-        83.211693,	1.980243, //TAATA
-        77.092142,	2.227696, //TAATC
-        80.258390,	1.676175, //TAATG
-        70.919240,	2.008670, //TAATT
-        105.038267,	2.191321, //TACAA
-        97.459580,	1.741661, //TACAC
-        102.137974,	2.289866, //TACAG
-        96.420347,	2.177595, //TACAT
-        105.028796,	1.882637, //TACCA
-        101.598382,	1.753323, //TACCC
-        103.504437,	1.904430, //TACCG
-        100.094231,	1.830978, //TACCT
-        99.485543,	2.247222, //TACGA
-        96.052496,	2.023168, //TACGC
-        99.594475,	2.226676, //TACGG
-        94.743516,	2.645556, //TACGT
-        98.638847,	1.698466, //TACTA
-        91.883091,	1.861358, //TACTC
-        95.446496,	1.644856, //TACTG
-        86.162047,	1.469612, //TACTT
-        78.881111,	1.829158, //TAGAA
-        68.794947,	2.144815, //TAGAC
-        77.446258,	1.828542, //TAGAG
-        68.471318,	1.854593, //TAGAT
-        85.711523,	1.877059, //TAGCA
-        82.133416,	1.706178, //TAGCC
-        82.735456,	1.560138, //TAGCG
-        80.498507,	1.421728, //TAGCT
-        77.347848,	1.833456, //TAGGA
-        73.221457,	1.676900, //TAGGC
-        78.784896,	1.687201, //TAGGG
-        71.813579,	1.760891, //TAGGT
-        76.317002,	2.048050, //TAGTA
-        69.820528,	2.421331, //TAGTC
-        72.191972,	1.996932, //TAGTG
-        63.584976,	2.356355, //TAGTT
-        109.682082,	3.162864, //TATAA
-        105.403801,	3.097662, //TATAC
-        107.754822,	3.024385, //TATAG
-        107.309844,	3.751323, //TATAT
-        117.983933,	2.972605, //TATCA
-        117.188486,	3.047684, //TATCC
-        117.517222,	3.000273, //TATCG
-        117.555271,	3.104102, //TATCT
-        105.550211,	2.994843, //TATGA
-        105.692073,	3.134146, //TATGC
-        106.686408,	2.931226, //TATGG
-        108.197924,	3.567998, //TATGT
-        105.157128,	2.180266, //TATTA
-        100.112002,	2.090218, //TATTC
-        102.788626,	2.200879, //TATTG
-        95.947011,	1.925107, //TATTT
-        90.110138,	2.709875, //TCAAA
-        82.199679,	2.161122, //TCAAC
-        88.671394,	2.817961, //TCAAG
-        80.719998,	2.248901, //TCAAT
-        92.896485,	1.224810, //TCACA
-        90.383526,	1.290436, //TCACC
-        91.801464,	1.397982, //TCACG
-        88.290341,	1.562573, //TCACT
-        85.104101,	2.601181, //TCAGA
-        81.824701,	2.082363, //TCAGC
-        85.143667,	2.501465, //TCAGG
-        78.120046,	2.406247, //TCAGT
-        86.457378,	1.952000, //TCATA
-        80.734106,	2.229315, //TCATC
-        83.791653,	2.185064, //TCATG
-        74.436252,	2.430893, //TCATT
-        101.477335,	1.630852, //TCCAA
-        94.867930,	1.463223, //TCCAC
-        99.083612,	1.842031, //TCCAG
-        93.327878,	1.799272, //TCCAT
-        100.857711,	1.449808, //TCCCA
-        97.781886,	1.401820, //TCCCC
-        99.451717,	1.431916, //TCCCG
-        96.139394,	1.447096, //TCCCT
-        95.530039,	1.820247, //TCCGA
-        92.886693,	1.580932, //TCCGC
-        95.974951,	1.748125, //TCCGG
-        90.614115,	2.134667, //TCCGT
-        95.787187,	1.774084, //TCCTA
-        90.079311,	2.162105, //TCCTC
-        92.703727,	1.638304, //TCCTG
-        84.493067,	1.913109, //TCCTT
-        82.855355,	2.367950, //TCGAA
-        74.344480,	2.003318, //TCGAC
-        81.751704,	2.412907, //TCGAG
-        72.717827,	1.858546, //TCGAT
-        88.127740,	1.442911, //TCGCA
-        84.976761,	1.527415, //TCGCC
-        85.676709,	1.581813, //TCGCG
-        82.653881,	1.560399, //TCGCT
-        81.512289,	2.441716, //TCGGA
-        78.623976,	2.031856, //TCGGC
-        83.004309,	2.352700, //TCGGG
-        76.197573,	2.460963, //TCGGT
-        79.672304,	2.144676, //TCGTA
-        73.819625,	2.495653, //TCGTC
-        75.801558,	2.220054, //TCGTG
-        67.418801,	2.473128, //TCGTT
-        108.291003,	2.640979, //TCTAA
-        104.709682,	2.582529, //TCTAC
-        106.108011,	2.516063, //TCTAG
-        105.196252,	3.038925, //TCTAT
-        113.900843,	2.427926, //TCTCA
-        113.075779,	2.470406, //TCTCC
-        113.435897,	2.498912, //TCTCG
-        112.715687,	2.722041, //TCTCT
-        103.496535,	2.505934, //TCTGA
-        102.989693,	2.565836, //TCTGC
-        104.141737,	2.473458, //TCTGG
-        103.740894,	3.112501, //TCTGT
-        102.353025,	1.860074, //TCTTA
-        97.691494,	1.792855, //TCTTC
-        100.178981,	1.888032, //TCTTG
-        93.780498,	1.897284, //TCTTT
-        77.796208,	1.677481, //TGAAA
-        68.079456,	2.181444, //TGAAC
-        75.607091,	1.595406, //TGAAG
-        66.861991,	1.951472, //TGAAT
-        83.647544,	2.485995, //TGACA
-        80.344298,	2.197200, //TGACC
-        82.328897,	1.981911, //TGACG
-        79.209093,	1.929455, //TGACT
-        77.438483,	1.417762, //TGAGA
-        72.133224,	1.590985, //TGAGC
-        77.469925,	1.358207, //TGAGG
-        71.115787,	1.457057, //TGAGT
-        75.963571,	2.586817, //TGATA
-        70.091646,	2.702412, //TGATC
-        72.867324,	2.058055, //TGATG
-        64.729991,	2.353002, //TGATT
-        102.245779,	2.217680, //TGCAA
-        94.171625,	1.729785, //TGCAC
-        99.083506,	2.293936, //TGCAG
-        93.222027,	2.053863, //TGCAT
-        103.010164,	1.965209, //TGCCA
-        99.508185,	1.763366, //TGCCC
-        101.584275,	1.934645, //TGCCG
-        98.239428,	1.857380, //TGCCT
-        97.056922,	2.248272, //TGCGA
-        93.507929,	1.869846, //TGCGC
-        97.369661,	2.163916, //TGCGG
-        92.621945,	2.467197, //TGCGT
-        96.290433,	1.801944, //TGCTA
-        89.381608,	2.012889, //TGCTC
-        93.120468,	1.678402, //TGCTG
-        84.107201,	1.518410, //TGCTT
-        72.079631,	1.833777, //TGGAA
-        61.845025,	2.325889, //TGGAC
-        70.531431,	1.861102, //TGGAG
-        61.484549,	1.922772, //TGGAT
-        82.983042,	1.896143, //TGGCA
-        79.656503,	1.710818, //TGGCC
-        81.224246,	1.575505, //TGGCG
-        78.169809,	1.474313, //TGGCT
-        74.498847,	1.702104, //TGGGA
-        69.882906,	1.768077, //TGGGC
-        75.729976,	1.512557, //TGGGG
-        68.816269,	1.634836, //TGGGT
-        73.695690,	2.386667, //TGGTA
-        67.269454,	2.691990, //TGGTC
-        69.746593,	2.132513, //TGGTG
-        61.854664,	2.621137, //TGGTT
-        104.795258,	2.967921, //TGTAA
-        99.280418,	2.663822, //TGTAC
-        102.609692,	2.779656, //TGTAG
-        100.809072,	3.770059, //TGTAT
-        113.356664,	2.788713, //TGTCA
-        111.712997,	2.926713, //TGTCC
-        112.612603,	2.905583, //TGTCG
-        112.230996,	3.023806, //TGTCT
-        101.552476,	2.865487, //TGTGA
-        100.966167,	2.925330, //TGTGC
-        102.720910,	2.854346, //TGTGG
-        103.517568,	3.386671, //TGTGT
-        100.503850,	2.404871, //TGTTA
-        95.318147,	2.217327, //TGTTC
-        97.974253,	2.364475, //TGTTG
-        91.138411,	1.913314, //TGTTT
-        91.410962,	2.424337, //TTAAA
-        83.420966,	2.309626, //TTAAC
-        89.978630,	2.478620, //TTAAG
-        82.138468,	2.479595, //TTAAT
-        93.456748,	1.320107, //TTACA
-        91.086788,	1.417739, //TTACC
-        92.267389,	1.341323, //TTACG
-        89.558506,	1.521743, //TTACT
-        88.332620,	2.323276, //TTAGA
-        85.002867,	2.289189, //TTAGC
-        88.572604,	2.340315, //TTAGG
-        82.477058,	2.723338, //TTAGT
-        88.094812,	1.882633, //TTATA
-        83.755611,	2.462911, //TTATC
-        85.647866,	2.119190, //TTATG
-        77.966495,	2.695063, //TTATT
-        101.170960,	2.080524, //TTCAA
-        95.236643,	2.101257, //TTCAC
-        99.296106,	2.400608, //TTCAG
-        93.692141,	2.473610, //TTCAT
-        100.256021,	1.632531, //TTCCA
-        97.470987,	1.608675, //TTCCC
-        98.993045,	1.827966, //TTCCG
-        96.027094,	1.915015, //TTCCT
-        97.022236,	2.591370, //TTCGA
-        93.911287,	2.485991, //TTCGC
-        97.221238,	2.512791, //TTCGG
-        92.050978,	5.740038, //TTCGT
-        95.723096,	1.860970, //TTCTA
-        90.738442,	2.329145, //TTCTC
-        93.052489,	2.032872, //TTCTG
-        85.480260,	2.374892, //TTCTT
-        83.721234,	3.075336, //TTGAA
-        75.590138,	2.535449, //TTGAC
-        83.326155,	3.174293, //TTGAG
-        74.331402,	2.693786, //TTGAT
-        90.006111,	1.482083, //TTGCA
-        87.366255,	1.665776, //TTGCC
-        88.436191,	1.674668, //TTGCG
-        85.661034,	1.839044, //TTGCT
-        85.028159,	3.229588, //TTGGA
-        81.841017,	2.830276, //TTGGC
-        86.158946,	2.988263, //TTGGG
-        80.408835,	3.422647, //TTGGT
-        83.341406,	2.229805, //TTGTA
-        79.174315,	2.831328, //TTGTC
-        80.346437,	2.655150, //TTGTG
-        73.340969,	3.040482, //TTGTT
-        103.897500,	2.163707, //TTTAA
-        99.942932,	2.019532, //TTTAC
-        102.151443,	2.041936, //TTTAG
-        100.349869,	2.505570, //TTTAT
-        108.207484,	2.198568, //TTTCA
-        106.791029,	2.171602, //TTTCC
-        107.354359,	2.226071, //TTTCG
-        107.074973,	2.264576, //TTTCT
-        99.863983,	2.113695, //TTTGA
-        98.730197,	2.066305, //TTTGC
-        100.575891,	1.986539, //TTTGG
-        99.746559,	2.510487, //TTTGT
-        98.045635,	1.708404, //TTTTA
-        94.016860,	1.569772, //TTTTC
-        96.127181,	1.623511, //TTTTG
-        90.405465,	1.513907  //TTTTT
+alignas(64) constexpr float MODEL_R94_TEMPLATE_MEANS[] = {
+    85.0836105f, 76.6358109f, 83.4890976f, 75.7161636f, 87.42939f, 84.2448273f, 86.3056412f, 83.0040436f,
+    82.5552216f, 78.5646667f, 81.9637604f, 76.4538193f, 81.6702957f, 75.8151398f, 78.830513f, 69.5488205f,
+    106.444466f, 99.2040329f, 103.855499f, 98.4360352f, 106.571953f, 103.300438f, 105.238716f, 102.006203f,
+    101.02961f, 98.1651459f, 101.415405f, 97.1932831f, 99.9312439f, 92.9474182f, 96.8899384f, 87.4654312f,
+    78.2001495f, 68.4263992f, 77.0438232f, 68.0199661f, 85.8839035f, 82.1289978f, 83.2250595f, 80.4779892f,
+    76.2260208f, 72.5002213f, 77.5790787f, 70.9388657f, 75.6384964f, 69.0522003f, 71.3451691f, 63.0483856f,
+    109.874664f, 106.022881f, 108.351128f, 107.807106f, 118.527374f, 117.783752f, 118.492645f, 118.288406f,
+    106.20211f, 106.989288f, 107.698746f, 110.036034f, 105.97438f, 101.007011f, 103.624222f, 96.4946136f,
+    91.0639343f, 82.8272858f, 89.668251f, 81.3991547f, 93.7120972f, 91.1976776f, 92.8143616f, 89.1419678f,
+    85.6492157f, 82.5394669f, 85.9832458f, 78.5253525f, 87.6203995f, 81.7549896f, 84.7164459f, 75.1085205f,
+    102.728561f, 95.8599396f, 100.618065f, 94.3330231f, 101.981102f, 98.8810425f, 100.545128f, 97.3301773f,
+    96.7727737f, 93.9277191f, 97.1789398f, 91.5109787f, 96.6433334f, 91.0143585f, 93.6701889f, 85.1778717f,
+    83.858902f, 74.980835f, 82.9870453f, 73.4466553f, 89.3126907f, 86.3233795f, 87.1936264f, 83.9132309f,
+    82.302803f, 79.4820404f, 84.018364f, 76.8924637f, 80.5668335f, 74.8318253f, 76.6426163f, 68.0589676f,
+    108.509682f, 104.918571f, 106.750816f, 105.454216f, 113.953194f, 112.991631f, 113.24913f, 112.914764f,
+    103.413185f, 102.985184f, 104.18557f, 103.570984f, 102.431892f, 97.885437f, 100.378876f, 93.7422562f,
+    78.486618f, 69.1833878f, 76.8547668f, 68.9572067f, 84.1689987f, 80.4923553f, 82.8880997f, 79.7012787f,
+    77.7626953f, 72.4686508f, 77.8471451f, 71.9786606f, 77.2164917f, 71.4225922f, 74.3239975f, 66.1891403f,
+    104.091034f, 96.1982956f, 101.24456f, 95.5673599f, 104.918633f, 101.892471f, 103.638969f, 100.55191f,
+    99.3553467f, 95.5753632f, 99.6935577f, 95.320755f, 98.0778351f, 91.1826172f, 95.1160812f, 86.0782928f,
+    71.1124649f, 60.7566719f, 69.6485291f, 61.1142311f, 82.5596085f, 78.8975677f, 80.7110901f, 77.4514389f,
+    72.8752365f, 67.8330536f, 74.265976f, 67.1835709f, 72.3717728f, 65.9408264f, 68.3021317f, 60.9108963f,
+    106.293999f, 100.782707f, 104.343201f, 102.996613f, 114.689735f, 113.54319f, 114.3955f, 113.834084f,
+    103.266525f, 103.095772f, 104.689491f, 106.241089f, 102.512917f, 96.7890701f, 100.061516f, 92.8001251f,
+    92.4485245f, 84.1975632f, 91.1712875f, 83.3591385f, 94.1697464f, 91.9427414f, 93.0171661f, 90.3615799f,
+    89.206131f, 86.0977707f, 89.7430801f, 83.6364288f, 89.2265778f, 85.2023392f, 86.8413391f, 79.2928391f,
+    103.532722f, 97.5646362f, 102.075729f, 95.7318192f, 102.574615f, 100.050407f, 101.545334f, 98.5701828f,
+    99.5544128f, 96.3798904f, 99.9471207f, 92.924942f, 97.7509308f, 93.3353729f, 95.4675827f, 87.5893707f,
+    85.4996567f, 76.493103f, 85.2944641f, 75.919899f, 92.0594025f, 89.6105347f, 90.6598587f, 87.7585144f,
+    87.396286f, 84.5639038f, 88.7119141f, 82.9161148f, 85.8876572f, 82.1912537f, 83.024559f, 76.3544922f,
+    106.223167f, 101.745041f, 104.618767f, 101.795364f, 109.668587f, 108.127251f, 109.056244f, 108.519196f,
+    101.961151f, 100.761002f, 102.722572f, 101.406799f, 100.147697f, 95.6766434f, 98.2642212f, 91.8670654f,
+    85.299202f, 76.1822662f, 83.515831f, 75.1899109f, 88.1363754f, 84.9954758f, 87.006691f, 83.4933701f,
+    82.8002014f, 78.1498871f, 82.2669296f, 75.8649673f, 81.5286484f, 75.5300293f, 78.6847839f, 69.4825363f,
+    105.083412f, 97.6156464f, 102.177505f, 96.8336334f, 105.427109f, 102.05291f, 103.922478f, 100.585289f,
+    98.9320374f, 95.7072525f, 99.1426163f, 94.3578644f, 98.8104324f, 91.7302246f, 95.2880478f, 86.1020813f,
+    76.9231949f, 67.1266708f, 75.3608017f, 66.7469711f, 85.4812698f, 81.8511353f, 83.2153091f, 80.1198502f,
+    75.4174652f, 71.5824356f, 76.614624f, 70.1796112f, 75.1439133f, 68.7786789f, 71.4203186f, 62.8827019f,
+    107.114151f, 103.026192f, 105.11467f, 104.405724f, 116.473274f, 115.472549f, 115.908028f, 115.949402f,
+    103.103096f, 103.491684f, 104.304825f, 106.329567f, 102.954712f, 97.9298859f, 100.481873f, 93.685051f,
+    90.8869019f, 82.6886139f, 89.5221939f, 81.1610718f, 94.2913818f, 91.6921692f, 93.1682816f, 89.4956818f,
+    85.6693115f, 82.4918137f, 85.9125061f, 78.5826263f, 87.5364304f, 81.6507263f, 84.6087112f, 75.1376266f,
+    103.838173f, 96.5733566f, 101.084656f, 95.0853348f, 103.314438f, 99.9168854f, 101.723145f, 98.3671036f,
+    97.400383f, 94.4240189f, 97.6072845f, 92.2429886f, 97.9636612f, 92.0398026f, 94.5683975f, 86.0377121f,
+    83.4229813f, 74.6710052f, 82.2083206f, 73.0289993f, 90.0501785f, 87.0040131f, 87.8595428f, 84.5818024f,
+    82.0361176f, 79.0701294f, 83.6039352f, 76.3316803f, 80.4955597f, 74.4977646f, 76.6604309f, 67.9651947f,
+    110.695854f, 107.048904f, 108.913506f, 107.323509f, 116.314346f, 115.528259f, 115.909363f, 115.279297f,
+    105.671967f, 105.233101f, 106.591324f, 105.943748f, 104.639191f, 99.5687943f, 102.481255f, 95.4512939f,
+    79.257843f, 69.4699631f, 77.2546387f, 68.9557419f, 85.3250885f, 81.7901001f, 83.926796f, 80.8212662f,
+    78.4311371f, 73.0524368f, 78.4444656f, 72.2137909f, 77.967186f, 71.5222015f, 74.6436386f, 66.2740326f,
+    104.795113f, 96.2594223f, 101.843895f, 95.7263031f, 105.834969f, 102.470329f, 104.360291f, 101.042526f,
+    99.5307159f, 95.4957733f, 99.7050171f, 94.9776306f, 98.9174042f, 91.1796265f, 95.5238342f, 86.2746964f,
+    71.7344589f, 61.3246346f, 70.0093842f, 61.2866364f, 84.3359528f, 80.7069855f, 82.4782944f, 78.8920746f,
+    74.045166f, 69.084816f, 75.5022888f, 68.1947632f, 73.6284256f, 67.1674347f, 69.5318451f, 61.8370972f,
+    106.265686f, 100.721626f, 104.021896f, 102.596352f, 115.352531f, 114.002655f, 114.732597f, 114.235176f,
+    102.828262f, 102.69091f, 104.332245f, 105.674187f, 102.158012f, 96.3739014f, 99.3142471f, 92.0727158f,
+    92.5621262f, 84.664032f, 91.2013245f, 83.5980453f, 94.8964615f, 92.5933151f, 93.7011795f, 91.0645218f,
+    89.5264053f, 86.2615356f, 89.7886505f, 83.3210831f, 89.6853333f, 85.9511185f, 87.3768692f, 80.2624817f,
+    102.665955f, 97.0410614f, 100.922798f, 95.6287918f, 101.694191f, 99.1479263f, 100.516609f, 97.9825287f,
+    98.7654037f, 95.3900986f, 98.9017563f, 92.6586533f, 97.1358109f, 93.0931473f, 94.926445f, 87.8121872f,
+    84.6984177f, 76.2444687f, 84.3499908f, 75.4179993f, 91.3455734f, 88.8267746f, 90.0088272f, 87.2986221f,
+    86.1222382f, 82.8803024f, 87.3359909f, 81.3642426f, 84.9146347f, 81.4243164f, 82.2311707f, 75.964447f,
+    104.196114f, 100.287933f, 102.394287f, 100.838821f, 107.93084f, 106.308731f, 107.1008f, 107.156075f,
+    99.8948746f, 98.6981201f, 100.143387f, 99.6984787f, 97.8332977f, 93.9945602f, 96.0385284f, 90.8962402f,
+    83.3866348f, 74.3883972f, 81.3888626f, 74.0420609f, 87.048645f, 83.5577469f, 85.6652679f, 82.6341324f,
+    81.1664505f, 76.5208054f, 80.8332367f, 74.7959595f, 80.1215363f, 73.854454f, 77.0951157f, 68.5360413f,
+    105.222878f, 97.6618729f, 102.268036f, 96.8329849f, 105.456841f, 102.183372f, 103.955162f, 100.749329f,
+    100.000786f, 96.7719345f, 100.285294f, 95.8501053f, 98.8534927f, 91.8167877f, 95.756424f, 86.3097458f,
+    75.5449753f, 65.3077774f, 74.0008621f, 65.158783f, 84.6806793f, 80.9457855f, 82.1012802f, 79.1706085f,
+    74.7683563f, 70.4834747f, 75.9252167f, 69.4383698f, 73.918869f, 67.1555939f, 69.6832962f, 61.3594627f,
+    109.281929f, 105.052132f, 107.36499f, 106.9048f, 116.807915f, 116.146652f, 116.561661f, 116.170174f,
+    105.520599f, 105.928307f, 106.90654f, 108.772453f, 104.306282f, 99.6508713f, 102.066628f, 95.4424973f,
+    89.9391403f, 81.679718f, 88.3681335f, 80.2544937f, 92.7848587f, 90.1484299f, 91.6233444f, 88.0766373f,
+    84.6114807f, 81.5238647f, 84.9003983f, 77.7459946f, 86.4893341f, 80.7830353f, 83.5932693f, 74.2581787f,
+    101.835907f, 94.9889755f, 99.6574249f, 93.4627533f, 101.336311f, 98.2103653f, 99.9096222f, 96.6609573f,
+    96.0137939f, 93.2022934f, 96.3585587f, 90.8713837f, 96.0426483f, 90.3692551f, 93.0383148f, 84.8067169f,
+    83.047348f, 74.0395889f, 82.0459518f, 72.5973358f, 88.912529f, 86.071701f, 86.7862091f, 83.4589615f,
+    81.6574478f, 78.7214432f, 83.3777847f, 76.3396225f, 79.9524002f, 74.1159897f, 76.0188065f, 67.5783844f,
+    107.21299f, 103.668503f, 105.168381f, 104.067108f, 112.904495f, 111.825813f, 112.32885f, 111.761826f,
+    102.355415f, 101.761826f, 103.157326f, 102.644806f, 101.279068f, 96.8556747f, 99.3745422f, 92.8614044f,
+    75.0500031f, 65.4145126f, 73.2236481f, 65.6900177f, 80.8371811f, 77.2228012f, 79.5900345f, 76.6301727f,
+    74.6736908f, 68.9852905f, 74.767067f, 68.8762665f, 74.0936584f, 68.253334f, 71.1769485f, 64.0168152f,
+    101.489716f, 93.3345947f, 98.5826797f, 92.9173813f, 102.288841f, 98.7639389f, 100.719833f, 97.887085f,
+    96.6356201f, 92.8702774f, 96.9698715f, 92.6675186f, 95.573822f, 88.5177994f, 92.4500809f, 83.6962509f,
+    70.1029282f, 59.5697174f, 68.493042f, 59.8689079f, 81.5281601f, 78.1844101f, 79.8612289f, 76.6717072f,
+    72.3498764f, 67.2462158f, 73.483345f, 66.6998444f, 71.3636703f, 64.8541794f, 67.4653244f, 59.9588623f,
+    103.09259f, 97.3435669f, 100.909203f, 99.1488571f, 111.054863f, 109.830513f, 110.538818f, 110.182777f,
+    100.227814f, 99.5786819f, 101.30307f, 102.523216f, 98.5815048f, 93.689415f, 96.2204361f, 89.6018982f,
+    89.9820786f, 81.5396423f, 88.5113373f, 80.5166397f, 91.9909134f, 89.6932373f, 90.7671814f, 88.3013153f,
+    87.0582962f, 83.4810181f, 87.3518372f, 81.4687271f, 86.7283401f, 82.622963f, 84.3150101f, 76.8061218f,
+    101.379601f, 95.3913422f, 99.6059952f, 93.50914f, 100.670464f, 97.9043198f, 99.5158386f, 96.3685837f,
+    97.3847961f, 94.3038864f, 97.7179108f, 92.5587769f, 95.792038f, 91.2700806f, 93.4208755f, 85.5542526f,
+    83.6013718f, 74.5762482f, 83.1270981f, 73.8383942f, 90.1999283f, 87.7072601f, 88.8059692f, 85.9718323f,
+    85.2774734f, 82.1287079f, 86.6883621f, 80.7295074f, 83.5086441f, 79.3438644f, 80.5845337f, 73.4642563f,
+    104.027771f, 99.6915665f, 102.254982f, 99.6938629f, 107.625061f, 106.305206f, 107.262054f, 106.426193f,
+    99.9687958f, 98.8316345f, 100.631462f, 99.4580307f, 98.1299438f, 93.9543152f, 96.3001251f, 90.2790985f,
+    87.1108017f, 78.2838211f, 85.4027863f, 77.3195648f, 89.9489975f, 86.7863007f, 88.6145706f, 85.3325195f,
+    84.7142105f, 80.0194702f, 84.2857971f, 78.0123062f, 83.2116928f, 77.0921402f, 80.2583923f, 70.9192429f,
+    105.038269f, 97.4595795f, 102.137978f, 96.4203491f, 105.028793f, 101.598381f, 103.50444f, 100.094231f,
+    99.4855423f, 96.0524979f, 99.5944748f, 94.743515f, 98.6388474f, 91.8830948f, 95.4464951f, 86.1620483f,
+    78.8811111f, 68.7949448f, 77.4462585f, 68.4713211f, 85.711525f, 82.1334152f, 82.7354584f, 80.4985046f,
+    77.347847f, 73.2214584f, 78.7848969f, 71.8135757f, 76.3170013f, 69.8205261f, 72.1919708f, 63.5849762f,
+    109.682083f, 105.403801f, 107.754822f, 107.309845f, 117.983932f, 117.188484f, 117.51722f, 117.555267f,
+    105.550209f, 105.69207f, 106.686409f, 108.197922f, 105.157127f, 100.112f, 102.788628f, 95.9470139f,
+    90.1101379f, 82.1996765f, 88.6713943f, 80.7200012f, 92.8964844f, 90.3835297f, 91.8014603f, 88.2903442f,
+    85.1041031f, 81.8246994f, 85.1436691f, 78.1200485f, 86.4573746f, 80.734108f, 83.7916565f, 74.4362488f,
+    101.477333f, 94.8679276f, 99.0836105f, 93.3278809f, 100.857712f, 97.7818832f, 99.4517136f, 96.1393967f,
+    95.5300369f, 92.8866959f, 95.9749527f, 90.6141129f, 95.7871857f, 90.0793076f, 92.7037277f, 84.4930649f,
+    82.8553543f, 74.3444824f, 81.7517014f, 72.7178268f, 88.127739f, 84.9767609f, 85.676712f, 82.6538773f,
+    81.512291f, 78.6239777f, 83.0043106f, 76.1975708f, 79.6723022f, 73.8196259f, 75.8015594f, 67.4188004f,
+    108.291f, 104.709679f, 106.108009f, 105.196251f, 113.900841f, 113.075783f, 113.435898f, 112.715691f,
+    103.496536f, 102.989693f, 104.141739f, 103.740891f, 102.353027f, 97.6914978f, 100.178978f, 93.7804947f,
+    77.7962112f, 68.0794525f, 75.6070938f, 66.8619919f, 83.6475449f, 80.3442993f, 82.3288956f, 79.2090912f,
+    77.4384842f, 72.1332245f, 77.4699249f, 71.1157837f, 75.9635696f, 70.0916443f, 72.8673248f, 64.7299881f,
+    102.245781f, 94.1716232f, 99.0835037f, 93.2220306f, 103.010162f, 99.5081863f, 101.584274f, 98.2394257f,
+    97.0569229f, 93.5079269f, 97.3696594f, 92.6219482f, 96.2904358f, 89.3816071f, 93.1204681f, 84.1072006f,
+    72.079628f, 61.8450241f, 70.5314331f, 61.4845505f, 82.9830399f, 79.6565018f, 81.2242432f, 78.1698074f,
+    74.498848f, 69.8829041f, 75.7299728f, 68.8162689f, 73.6956863f, 67.269455f, 69.7465897f, 61.8546638f,
+    104.795258f, 99.2804184f, 102.609695f, 100.809074f, 113.356667f, 111.712997f, 112.612602f, 112.230995f,
+    101.552475f, 100.966164f, 102.720909f, 103.51757f, 100.503853f, 95.3181458f, 97.9742508f, 91.1384125f,
+    91.410965f, 83.4209671f, 89.9786301f, 82.1384659f, 93.456749f, 91.0867844f, 92.2673874f, 89.5585022f,
+    88.3326187f, 85.0028687f, 88.5726013f, 82.4770584f, 88.0948105f, 83.7556076f, 85.6478653f, 77.9664917f,
+    101.170959f, 95.2366409f, 99.2961044f, 93.6921387f, 100.25602f, 97.4709854f, 98.993042f, 96.027092f,
+    97.0222397f, 93.9112854f, 97.2212372f, 92.0509796f, 95.7230988f, 90.7384415f, 93.0524902f, 85.4802628f,
+    83.7212372f, 75.5901413f, 83.3261566f, 74.3314056f, 90.0061111f, 87.3662567f, 88.4361877f, 85.6610336f,
+    85.0281601f, 81.8410187f, 86.1589432f, 80.4088364f, 83.3414078f, 79.1743164f, 80.3464355f, 73.3409653f,
+    103.897499f, 99.9429321f, 102.151443f, 100.349869f, 108.207481f, 106.791031f, 107.354362f, 107.074974f,
+    99.8639832f, 98.7301941f, 100.57589f, 99.7465591f, 98.0456314f, 94.016861f, 96.127182f, 90.4054642f
+};
+
+alignas(64) constexpr float MODEL_R94_TEMPLATE_VARS_X2[] = {
+    4.60771275f, 5.81415176f, 4.72825527f, 4.75878525f, 7.69909954f, 6.74275398f, 4.83315182f, 5.04384375f,
+    4.27252579f, 4.07323456f, 3.97560215f, 4.42251682f, 7.84272432f, 9.92525864f, 5.61912537f, 8.06951141f,
+    9.60377407f, 6.06676579f, 10.4869719f, 9.48383904f, 7.0886445f, 6.148283f, 7.25370741f, 6.7049613f,
+    10.1000128f, 8.18641853f, 9.91617203f, 13.9979324f, 5.76957321f, 6.92930746f, 5.41110229f, 4.31951904f,
+    6.69163752f, 9.20046234f, 6.68713188f, 6.8790307f, 7.04670095f, 5.82208633f, 4.86806107f, 4.04262114f,
+    6.72312212f, 5.6239872f, 5.69329453f, 6.20147371f, 8.38901711f, 11.725687f, 7.97547483f, 11.1048174f,
+    20.0074177f, 19.1910191f, 18.2938099f, 28.1448479f, 17.67276f, 18.5767555f, 18.0032768f, 19.2708969f,
+    17.9381695f, 19.6457424f, 17.1841717f, 25.4612179f, 9.50711918f, 8.7380228f, 9.68773746f, 7.41207409f,
+    14.6868458f, 9.34089756f, 15.8818083f, 10.1151104f, 3.000319f, 3.3304503f, 3.90870738f, 4.88326836f,
+    13.5322857f, 8.67247009f, 12.5146551f, 11.5800486f, 7.62060833f, 9.93969154f, 9.54901028f, 11.8184814f,
+    5.31935644f, 4.28204298f, 6.78615665f, 6.4747591f, 4.20388651f, 3.93019843f, 4.10076666f, 4.18817377f,
+    6.62659883f, 4.99869204f, 6.11188173f, 9.1136055f, 6.29474783f, 9.34939671f, 5.36808014f, 7.31997156f,
+    11.2143736f, 8.02656651f, 11.6442394f, 6.90838671f, 4.1639843f, 4.66599321f, 5.00426483f, 4.86969042f,
+    11.923954f, 8.2568779f, 11.0703945f, 12.1126776f, 9.19927025f, 12.4565668f, 9.85727882f, 12.2327251f,
+    13.9495411f, 13.338913f, 12.6611462f, 18.470129f, 11.78965f, 12.2058125f, 12.4891233f, 14.8190136f,
+    12.5594101f, 13.1670284f, 12.2359896f, 19.3753242f, 6.91975069f, 6.42865849f, 7.1293292f, 7.19937325f,
+    5.62788534f, 9.51739502f, 5.09064102f, 7.61648607f, 12.360343f, 9.65537643f, 7.85594177f, 7.44559336f,
+    4.02009821f, 5.06246614f, 3.68945241f, 4.24603033f, 13.3832445f, 14.60606f, 8.47117996f, 11.0732374f,
+    9.8362093f, 5.98431206f, 10.5242853f, 8.43670654f, 7.72409296f, 6.21891928f, 7.48570299f, 6.89972115f,
+    10.1094532f, 6.99264812f, 9.36506557f, 12.1741219f, 6.49400425f, 8.10344315f, 5.6340661f, 4.61113787f,
+    6.72547579f, 10.81952f, 6.92740107f, 7.39410448f, 7.19071627f, 5.85379696f, 4.96443224f, 4.34719753f,
+    5.79431581f, 6.2521925f, 4.57565737f, 5.34537745f, 11.3923588f, 14.493619f, 9.09522343f, 13.7407169f,
+    17.6171112f, 14.1918945f, 15.4529743f, 28.4266911f, 15.5538397f, 17.1312981f, 16.8848248f, 18.2868061f,
+    16.4220333f, 17.1151104f, 16.2945824f, 22.9390812f, 11.5668087f, 9.83307934f, 11.1814842f, 7.32154083f,
+    11.7548189f, 10.668745f, 12.2871151f, 12.2967825f, 3.48536491f, 4.01996803f, 3.59829497f, 4.63140392f,
+    10.7952232f, 10.4807739f, 10.9541492f, 14.8331385f, 7.08861399f, 12.1318598f, 8.98193264f, 14.5267305f,
+    8.65715981f, 8.83056259f, 11.5258379f, 12.2374926f, 5.33031511f, 5.17567062f, 6.68291903f, 7.33456469f,
+    13.430398f, 12.3603029f, 12.6282368f, 65.8960724f, 6.92641878f, 10.8498325f, 8.26513672f, 11.2802238f,
+    18.9153824f, 12.8570032f, 20.1522732f, 14.5129652f, 4.39313984f, 5.54961967f, 5.60902548f, 6.7641654f,
+    20.8604774f, 16.0209255f, 17.8594303f, 23.4290257f, 9.94406033f, 16.032835f, 14.0996428f, 18.4890614f,
+    9.36325645f, 8.15701866f, 8.33900452f, 12.5557613f, 9.66740322f, 9.43171024f, 9.91078281f, 10.256609f,
+    8.93541241f, 8.53923225f, 7.89267445f, 12.6050911f, 5.8372879f, 4.92836809f, 5.27157545f, 4.58382845f,
+    4.60771275f, 5.81415176f, 4.72825527f, 4.75878525f, 7.69909954f, 6.74275398f, 4.83315182f, 5.04384375f,
+    4.27252579f, 4.07323456f, 3.97560215f, 4.42251682f, 7.84272432f, 9.92525864f, 5.61912537f, 8.06951141f,
+    9.60377407f, 6.06676579f, 10.4869719f, 9.48383904f, 7.0886445f, 6.148283f, 7.25370741f, 6.7049613f,
+    10.1000128f, 8.18641853f, 9.91617203f, 13.9979324f, 5.76957321f, 6.92930746f, 5.41110229f, 4.31951904f,
+    6.69163752f, 9.20046234f, 6.68713188f, 6.8790307f, 7.04670095f, 5.82208633f, 4.86806107f, 4.04262114f,
+    6.72312212f, 5.6239872f, 5.69329453f, 6.20147371f, 8.38901711f, 11.725687f, 7.97547483f, 11.1048174f,
+    20.0074177f, 19.1910191f, 18.2938099f, 28.1448479f, 17.67276f, 18.5767555f, 18.0032768f, 19.2708969f,
+    17.9381695f, 19.6457424f, 17.1841717f, 25.4612179f, 9.50711918f, 8.7380228f, 9.68773746f, 7.41207409f,
+    14.6868458f, 9.34089756f, 15.8818083f, 10.1151104f, 3.000319f, 3.3304503f, 3.90870738f, 4.88326836f,
+    13.5322857f, 8.67247009f, 12.5146551f, 11.5800486f, 7.62060833f, 9.93969154f, 9.54901028f, 11.8184814f,
+    5.31935644f, 4.28204298f, 6.78615665f, 6.4747591f, 4.20388651f, 3.93019843f, 4.10076666f, 4.18817377f,
+    6.62659883f, 4.99869204f, 6.11188173f, 9.1136055f, 6.29474783f, 9.34939671f, 5.36808014f, 7.31997156f,
+    11.2143736f, 8.02656651f, 11.6442394f, 6.90838671f, 4.1639843f, 4.66599321f, 5.00426483f, 4.86969042f,
+    11.923954f, 8.2568779f, 11.0703945f, 12.1126776f, 9.19927025f, 12.4565668f, 9.85727882f, 12.2327251f,
+    13.9495411f, 13.338913f, 12.6611462f, 18.470129f, 11.78965f, 12.2058125f, 12.4891233f, 14.8190136f,
+    12.5594101f, 13.1670284f, 12.2359896f, 19.3753242f, 6.91975069f, 6.42865849f, 7.1293292f, 7.19937325f,
+    5.62788534f, 9.51739502f, 5.09064102f, 7.61648607f, 12.360343f, 9.65537643f, 7.85594177f, 7.44559336f,
+    4.02009821f, 5.06246614f, 3.68945241f, 4.24603033f, 13.3832445f, 14.60606f, 8.47117996f, 11.0732374f,
+    9.8362093f, 5.98431206f, 10.5242853f, 8.43670654f, 7.72409296f, 6.21891928f, 7.48570299f, 6.89972115f,
+    10.1094532f, 6.99264812f, 9.36506557f, 12.1741219f, 6.49400425f, 8.10344315f, 5.6340661f, 4.61113787f,
+    6.72547579f, 10.81952f, 6.92740107f, 7.39410448f, 7.19071627f, 5.85379696f, 4.96443224f, 4.34719753f,
+    5.79431581f, 6.2521925f, 4.57565737f, 5.34537745f, 11.3923588f, 14.493619f, 9.09522343f, 13.7407169f,
+    17.6171112f, 14.1918945f, 15.4529743f, 28.4266911f, 15.5538397f, 17.1312981f, 16.8848248f, 18.2868061f,
+    16.4220333f, 17.1151104f, 16.2945824f, 22.9390812f, 11.5668087f, 9.83307934f, 11.1814842f, 7.32154083f,
+    11.7548189f, 10.668745f, 12.2871151f, 12.2967825f, 3.48536491f, 4.01996803f, 3.59829497f, 4.63140392f,
+    10.7952232f, 10.4807739f, 10.9541492f, 14.8331385f, 7.08861399f, 12.1318598f, 8.98193264f, 14.5267305f,
+    8.65715981f, 8.83056259f, 11.5258379f, 12.2374926f, 5.33031511f, 5.17567062f, 6.68291903f, 7.33456469f,
+    13.430398f, 12.3603029f, 12.6282368f, 65.8960724f, 6.92641878f, 10.8498325f, 8.26513672f, 11.2802238f,
+    18.9153824f, 12.8570032f, 20.1522732f, 14.5129652f, 4.39313984f, 5.54961967f, 5.60902548f, 6.7641654f,
+    20.8604774f, 16.0209255f, 17.8594303f, 23.4290257f, 9.94406033f, 16.032835f, 14.0996428f, 18.4890614f,
+    9.36325645f, 8.15701866f, 8.33900452f, 12.5557613f, 9.66740322f, 9.43171024f, 9.91078281f, 10.256609f,
+    8.93541241f, 8.53923225f, 7.89267445f, 12.6050911f, 5.8372879f, 4.92836809f, 5.27157545f, 4.58382845f,
+    4.60771275f, 5.81415176f, 4.72825527f, 4.75878525f, 7.69909954f, 6.74275398f, 4.83315182f, 5.04384375f,
+    4.27252579f, 4.07323456f, 3.97560215f, 4.42251682f, 7.84272432f, 9.92525864f, 5.61912537f, 8.06951141f,
+    9.60377407f, 6.06676579f, 10.4869719f, 9.48383904f, 7.0886445f, 6.148283f, 7.25370741f, 6.7049613f,
+    10.1000128f, 8.18641853f, 9.91617203f, 13.9979324f, 5.76957321f, 6.92930746f, 5.41110229f, 4.31951904f,
+    6.69163752f, 9.20046234f, 6.68713188f, 6.8790307f, 7.04670095f, 5.82208633f, 4.86806107f, 4.04262114f,
+    6.72312212f, 5.6239872f, 5.69329453f, 6.20147371f, 8.38901711f, 11.725687f, 7.97547483f, 11.1048174f,
+    20.0074177f, 19.1910191f, 18.2938099f, 28.1448479f, 17.67276f, 18.5767555f, 18.0032768f, 19.2708969f,
+    17.9381695f, 19.6457424f, 17.1841717f, 25.4612179f, 9.50711918f, 8.7380228f, 9.68773746f, 7.41207409f,
+    14.6868458f, 9.34089756f, 15.8818083f, 10.1151104f, 3.000319f, 3.3304503f, 3.90870738f, 4.88326836f,
+    13.5322857f, 8.67247009f, 12.5146551f, 11.5800486f, 7.62060833f, 9.93969154f, 9.54901028f, 11.8184814f,
+    5.31935644f, 4.28204298f, 6.78615665f, 6.4747591f, 4.20388651f, 3.93019843f, 4.10076666f, 4.18817377f,
+    6.62659883f, 4.99869204f, 6.11188173f, 9.1136055f, 6.29474783f, 9.34939671f, 5.36808014f, 7.31997156f,
+    11.2143736f, 8.02656651f, 11.6442394f, 6.90838671f, 4.1639843f, 4.66599321f, 5.00426483f, 4.86969042f,
+    11.923954f, 8.2568779f, 11.0703945f, 12.1126776f, 9.19927025f, 12.4565668f, 9.85727882f, 12.2327251f,
+    13.9495411f, 13.338913f, 12.6611462f, 18.470129f, 11.78965f, 12.2058125f, 12.4891233f, 14.8190136f,
+    12.5594101f, 13.1670284f, 12.2359896f, 19.3753242f, 6.91975069f, 6.42865849f, 7.1293292f, 7.19937325f,
+    5.62788534f, 9.51739502f, 5.09064102f, 7.61648607f, 12.360343f, 9.65537643f, 7.85594177f, 7.44559336f,
+    4.02009821f, 5.06246614f, 3.68945241f, 4.24603033f, 13.3832445f, 14.60606f, 8.47117996f, 11.0732374f,
+    9.8362093f, 5.98431206f, 10.5242853f, 8.43670654f, 7.72409296f, 6.21891928f, 7.48570299f, 6.89972115f,
+    10.1094532f, 6.99264812f, 9.36506557f, 12.1741219f, 6.49400425f, 8.10344315f, 5.6340661f, 4.61113787f,
+    6.72547579f, 10.81952f, 6.92740107f, 7.39410448f, 7.19071627f, 5.85379696f, 4.96443224f, 4.34719753f,
+    5.79431581f, 6.2521925f, 4.57565737f, 5.34537745f, 11.3923588f, 14.493619f, 9.09522343f, 13.7407169f,
+    17.6171112f, 14.1918945f, 15.4529743f, 28.4266911f, 15.5538397f, 17.1312981f, 16.8848248f, 18.2868061f,
+    16.4220333f, 17.1151104f, 16.2945824f, 22.9390812f, 11.5668087f, 9.83307934f, 11.1814842f, 7.32154083f,
+    11.7548189f, 10.668745f, 12.2871151f, 12.2967825f, 3.48536491f, 4.01996803f, 3.59829497f, 4.63140392f,
+    10.7952232f, 10.4807739f, 10.9541492f, 14.8331385f, 7.08861399f, 12.1318598f, 8.98193264f, 14.5267305f,
+    8.65715981f, 8.83056259f, 11.5258379f, 12.2374926f, 5.33031511f, 5.17567062f, 6.68291903f, 7.33456469f,
+    13.430398f, 12.3603029f, 12.6282368f, 65.8960724f, 6.92641878f, 10.8498325f, 8.26513672f, 11.2802238f,
+    18.9153824f, 12.8570032f, 20.1522732f, 14.5129652f, 4.39313984f, 5.54961967f, 5.60902548f, 6.7641654f,
+    20.8604774f, 16.0209255f, 17.8594303f, 23.4290257f, 9.94406033f, 16.032835f, 14.0996428f, 18.4890614f,
+    9.36325645f, 8.15701866f, 8.33900452f, 12.5557613f, 9.66740322f, 9.43171024f, 9.91078281f, 10.256609f,
+    8.93541241f, 8.53923225f, 7.89267445f, 12.6050911f, 5.8372879f, 4.92836809f, 5.27157545f, 4.58382845f,
+    4.60771275f, 5.81415176f, 4.72825527f, 4.75878525f, 7.69909954f, 6.74275398f, 4.83315182f, 5.04384375f,
+    4.27252579f, 4.07323456f, 3.97560215f, 4.42251682f, 7.84272432f, 9.92525864f, 5.61912537f, 8.06951141f,
+    9.60377407f, 6.06676579f, 10.4869719f, 9.48383904f, 7.0886445f, 6.148283f, 7.25370741f, 6.7049613f,
+    10.1000128f, 8.18641853f, 9.91617203f, 13.9979324f, 5.76957321f, 6.92930746f, 5.41110229f, 4.31951904f,
+    6.69163752f, 9.20046234f, 6.68713188f, 6.8790307f, 7.04670095f, 5.82208633f, 4.86806107f, 4.04262114f,
+    6.72312212f, 5.6239872f, 5.69329453f, 6.20147371f, 8.38901711f, 11.725687f, 7.97547483f, 11.1048174f,
+    20.0074177f, 19.1910191f, 18.2938099f, 28.1448479f, 17.67276f, 18.5767555f, 18.0032768f, 19.2708969f,
+    17.9381695f, 19.6457424f, 17.1841717f, 25.4612179f, 9.50711918f, 8.7380228f, 9.68773746f, 7.41207409f,
+    14.6868458f, 9.34089756f, 15.8818083f, 10.1151104f, 3.000319f, 3.3304503f, 3.90870738f, 4.88326836f,
+    13.5322857f, 8.67247009f, 12.5146551f, 11.5800486f, 7.62060833f, 9.93969154f, 9.54901028f, 11.8184814f,
+    5.31935644f, 4.28204298f, 6.78615665f, 6.4747591f, 4.20388651f, 3.93019843f, 4.10076666f, 4.18817377f,
+    6.62659883f, 4.99869204f, 6.11188173f, 9.1136055f, 6.29474783f, 9.34939671f, 5.36808014f, 7.31997156f,
+    11.2143736f, 8.02656651f, 11.6442394f, 6.90838671f, 4.1639843f, 4.66599321f, 5.00426483f, 4.86969042f,
+    11.923954f, 8.2568779f, 11.0703945f, 12.1126776f, 9.19927025f, 12.4565668f, 9.85727882f, 12.2327251f,
+    13.9495411f, 13.338913f, 12.6611462f, 18.470129f, 11.78965f, 12.2058125f, 12.4891233f, 14.8190136f,
+    12.5594101f, 13.1670284f, 12.2359896f, 19.3753242f, 6.91975069f, 6.42865849f, 7.1293292f, 7.19937325f,
+    5.62788534f, 9.51739502f, 5.09064102f, 7.61648607f, 12.360343f, 9.65537643f, 7.85594177f, 7.44559336f,
+    4.02009821f, 5.06246614f, 3.68945241f, 4.24603033f, 13.3832445f, 14.60606f, 8.47117996f, 11.0732374f,
+    9.8362093f, 5.98431206f, 10.5242853f, 8.43670654f, 7.72409296f, 6.21891928f, 7.48570299f, 6.89972115f,
+    10.1094532f, 6.99264812f, 9.36506557f, 12.1741219f, 6.49400425f, 8.10344315f, 5.6340661f, 4.61113787f,
+    6.72547579f, 10.81952f, 6.92740107f, 7.39410448f, 7.19071627f, 5.85379696f, 4.96443224f, 4.34719753f,
+    5.79431581f, 6.2521925f, 4.57565737f, 5.34537745f, 11.3923588f, 14.493619f, 9.09522343f, 13.7407169f,
+    17.6171112f, 14.1918945f, 15.4529743f, 28.4266911f, 15.5538397f, 17.1312981f, 16.8848248f, 18.2868061f,
+    16.4220333f, 17.1151104f, 16.2945824f, 22.9390812f, 11.5668087f, 9.83307934f, 11.1814842f, 7.32154083f,
+    11.7548189f, 10.668745f, 12.2871151f, 12.2967825f, 3.48536491f, 4.01996803f, 3.59829497f, 4.63140392f,
+    10.7952232f, 10.4807739f, 10.9541492f, 14.8331385f, 7.08861399f, 12.1318598f, 8.98193264f, 14.5267305f,
+    8.65715981f, 8.83056259f, 11.5258379f, 12.2374926f, 5.33031511f, 5.17567062f, 6.68291903f, 7.33456469f,
+    13.430398f, 12.3603029f, 12.6282368f, 65.8960724f, 6.92641878f, 10.8498325f, 8.26513672f, 11.2802238f,
+    18.9153824f, 12.8570032f, 20.1522732f, 14.5129652f, 4.39313984f, 5.54961967f, 5.60902548f, 6.7641654f,
+    20.8604774f, 16.0209255f, 17.8594303f, 23.4290257f, 9.94406033f, 16.032835f, 14.0996428f, 18.4890614f,
+    9.36325645f, 8.15701866f, 8.33900452f, 12.5557613f, 9.66740322f, 9.43171024f, 9.91078281f, 10.256609f,
+    8.93541241f, 8.53923225f, 7.89267445f, 12.6050911f, 5.8372879f, 4.92836809f, 5.27157545f, 4.58382845f
+};
+
+alignas(64) constexpr float MODEL_R94_TEMPLATE_LOGNORM_DENOMS[] = {
+    1.33623075f, 1.45251238f, 1.34914303f, 1.3523612f, 1.59291661f, 1.52659917f, 1.36011434f, 1.3814491f,
+    1.29846752f, 1.2745837f, 1.26245308f, 1.31571937f, 1.60215807f, 1.71990633f, 1.43545294f, 1.61641145f,
+    1.70344305f, 1.47377777f, 1.74743176f, 1.69715953f, 1.55161202f, 1.48045135f, 1.56312132f, 1.52378881f,
+    1.72863328f, 1.62360322f, 1.71944845f, 1.89181972f, 1.44866395f, 1.54024494f, 1.41659141f, 1.30393696f,
+    1.52279425f, 1.68199182f, 1.52245748f, 1.53660381f, 1.54864478f, 1.45319426f, 1.36371279f, 1.27081156f,
+    1.52514124f, 1.43588543f, 1.44200945f, 1.48475838f, 1.63582659f, 1.80325592f, 1.61055052f, 1.7760545f,
+    2.07041645f, 2.04958606f, 2.02564621f, 2.24104714f, 2.00837708f, 2.03332043f, 2.01764178f, 2.05166292f,
+    2.01583028f, 2.06129527f, 1.99435925f, 2.19094324f, 1.69838536f, 1.65620697f, 1.70779538f, 1.57392013f,
+    1.9158411f, 1.68956614f, 1.95495212f, 1.72938013f, 1.12172425f, 1.17391872f, 1.25396836f, 1.36527228f,
+    1.87490416f, 1.65244174f, 1.83581507f, 1.79700673f, 1.58779299f, 1.72063291f, 1.7005837f, 1.80719721f,
+    1.40804112f, 1.2995801f, 1.52980733f, 1.5063206f, 1.29036963f, 1.25670993f, 1.27795196f, 1.28849733f,
+    1.51791084f, 1.37695312f, 1.47748232f, 1.67724919f, 1.49222279f, 1.6900208f, 1.41260016f, 1.5676682f,
+    1.78096306f, 1.61374342f, 1.79977071f, 1.53873301f, 1.28560114f, 1.34251535f, 1.37751019f, 1.36388016f,
+    1.81163955f, 1.6278882f, 1.77450216f, 1.81949127f, 1.68192697f, 1.83348894f, 1.71647f, 1.82442236f,
+    1.8900882f, 1.86770773f, 1.84163392f, 2.03044224f, 1.80597591f, 1.8233211f, 1.83479404f, 1.92032051f,
+    1.83759999f, 1.86122286f, 1.82455575f, 2.05436516f, 1.53955483f, 1.50274789f, 1.55447352f, 1.55936193f,
+    1.43623185f, 1.6989255f, 1.38606679f, 1.58752251f, 1.82961154f, 1.7061224f, 1.60300004f, 1.57617617f,
+    1.26801813f, 1.38329184f, 1.22510397f, 1.29535723f, 1.86936665f, 1.9130832f, 1.64069986f, 1.77463055f,
+    1.7154001f, 1.46693563f, 1.74920774f, 1.63866091f, 1.59453714f, 1.48616302f, 1.57886243f, 1.53810549f,
+    1.72910047f, 1.54479456f, 1.69085813f, 1.82202125f, 1.50780463f, 1.61850941f, 1.43678069f, 1.33660221f,
+    1.52531624f, 1.7630409f, 1.54010725f, 1.57270646f, 1.55876029f, 1.45591021f, 1.37351441f, 1.30713069f,
+    1.45080364f, 1.48883104f, 1.33274019f, 1.41048098f, 1.78883636f, 1.90921915f, 1.67623961f, 1.88254666f,
+    2.00680017f, 1.89870048f, 1.9412657f, 2.24602914f, 1.94451869f, 1.99281847f, 1.98557258f, 2.02545476f,
+    1.97167695f, 1.99234581f, 1.96778131f, 2.13878608f, 1.79643476f, 1.71524107f, 1.77949452f, 1.56777537f,
+    1.80449653f, 1.75602412f, 1.82664049f, 1.82703376f, 1.19665134f, 1.26800191f, 1.21259499f, 1.33879495f,
+    1.76191676f, 1.74713624f, 1.76922405f, 1.92079687f, 1.55160987f, 1.82028246f, 1.66997254f, 1.91036022f,
+    1.65155828f, 1.66147435f, 1.79466057f, 1.82461715f, 1.40907013f, 1.39434946f, 1.52214241f, 1.56866395f,
+    1.87112522f, 1.82960987f, 1.84033263f, 2.66640425f, 1.54003644f, 1.76443982f, 1.62838805f, 1.78389049f,
+    2.04235268f, 1.84930933f, 2.07402349f, 1.90988612f, 1.31238699f, 1.42922962f, 1.43455338f, 1.52818441f,
+    2.0912931f, 1.9593128f, 2.01363087f, 2.14935279f, 1.72085261f, 1.95968437f, 1.89543962f, 2.0309546f,
+    1.69076157f, 1.62180436f, 1.63283682f, 1.8374548f, 1.70674479f, 1.69440365f, 1.71917665f, 1.7363261f,
+    1.66737604f, 1.64470053f, 1.60533249f, 1.83941531f, 1.45449805f, 1.36986887f, 1.40352952f, 1.33363223f,
+    1.33623075f, 1.45251238f, 1.34914303f, 1.3523612f, 1.59291661f, 1.52659917f, 1.36011434f, 1.3814491f,
+    1.29846752f, 1.2745837f, 1.26245308f, 1.31571937f, 1.60215807f, 1.71990633f, 1.43545294f, 1.61641145f,
+    1.70344305f, 1.47377777f, 1.74743176f, 1.69715953f, 1.55161202f, 1.48045135f, 1.56312132f, 1.52378881f,
+    1.72863328f, 1.62360322f, 1.71944845f, 1.89181972f, 1.44866395f, 1.54024494f, 1.41659141f, 1.30393696f,
+    1.52279425f, 1.68199182f, 1.52245748f, 1.53660381f, 1.54864478f, 1.45319426f, 1.36371279f, 1.27081156f,
+    1.52514124f, 1.43588543f, 1.44200945f, 1.48475838f, 1.63582659f, 1.80325592f, 1.61055052f, 1.7760545f,
+    2.07041645f, 2.04958606f, 2.02564621f, 2.24104714f, 2.00837708f, 2.03332043f, 2.01764178f, 2.05166292f,
+    2.01583028f, 2.06129527f, 1.99435925f, 2.19094324f, 1.69838536f, 1.65620697f, 1.70779538f, 1.57392013f,
+    1.9158411f, 1.68956614f, 1.95495212f, 1.72938013f, 1.12172425f, 1.17391872f, 1.25396836f, 1.36527228f,
+    1.87490416f, 1.65244174f, 1.83581507f, 1.79700673f, 1.58779299f, 1.72063291f, 1.7005837f, 1.80719721f,
+    1.40804112f, 1.2995801f, 1.52980733f, 1.5063206f, 1.29036963f, 1.25670993f, 1.27795196f, 1.28849733f,
+    1.51791084f, 1.37695312f, 1.47748232f, 1.67724919f, 1.49222279f, 1.6900208f, 1.41260016f, 1.5676682f,
+    1.78096306f, 1.61374342f, 1.79977071f, 1.53873301f, 1.28560114f, 1.34251535f, 1.37751019f, 1.36388016f,
+    1.81163955f, 1.6278882f, 1.77450216f, 1.81949127f, 1.68192697f, 1.83348894f, 1.71647f, 1.82442236f,
+    1.8900882f, 1.86770773f, 1.84163392f, 2.03044224f, 1.80597591f, 1.8233211f, 1.83479404f, 1.92032051f,
+    1.83759999f, 1.86122286f, 1.82455575f, 2.05436516f, 1.53955483f, 1.50274789f, 1.55447352f, 1.55936193f,
+    1.43623185f, 1.6989255f, 1.38606679f, 1.58752251f, 1.82961154f, 1.7061224f, 1.60300004f, 1.57617617f,
+    1.26801813f, 1.38329184f, 1.22510397f, 1.29535723f, 1.86936665f, 1.9130832f, 1.64069986f, 1.77463055f,
+    1.7154001f, 1.46693563f, 1.74920774f, 1.63866091f, 1.59453714f, 1.48616302f, 1.57886243f, 1.53810549f,
+    1.72910047f, 1.54479456f, 1.69085813f, 1.82202125f, 1.50780463f, 1.61850941f, 1.43678069f, 1.33660221f,
+    1.52531624f, 1.7630409f, 1.54010725f, 1.57270646f, 1.55876029f, 1.45591021f, 1.37351441f, 1.30713069f,
+    1.45080364f, 1.48883104f, 1.33274019f, 1.41048098f, 1.78883636f, 1.90921915f, 1.67623961f, 1.88254666f,
+    2.00680017f, 1.89870048f, 1.9412657f, 2.24602914f, 1.94451869f, 1.99281847f, 1.98557258f, 2.02545476f,
+    1.97167695f, 1.99234581f, 1.96778131f, 2.13878608f, 1.79643476f, 1.71524107f, 1.77949452f, 1.56777537f,
+    1.80449653f, 1.75602412f, 1.82664049f, 1.82703376f, 1.19665134f, 1.26800191f, 1.21259499f, 1.33879495f,
+    1.76191676f, 1.74713624f, 1.76922405f, 1.92079687f, 1.55160987f, 1.82028246f, 1.66997254f, 1.91036022f,
+    1.65155828f, 1.66147435f, 1.79466057f, 1.82461715f, 1.40907013f, 1.39434946f, 1.52214241f, 1.56866395f,
+    1.87112522f, 1.82960987f, 1.84033263f, 2.66640425f, 1.54003644f, 1.76443982f, 1.62838805f, 1.78389049f,
+    2.04235268f, 1.84930933f, 2.07402349f, 1.90988612f, 1.31238699f, 1.42922962f, 1.43455338f, 1.52818441f,
+    2.0912931f, 1.9593128f, 2.01363087f, 2.14935279f, 1.72085261f, 1.95968437f, 1.89543962f, 2.0309546f,
+    1.69076157f, 1.62180436f, 1.63283682f, 1.8374548f, 1.70674479f, 1.69440365f, 1.71917665f, 1.7363261f,
+    1.66737604f, 1.64470053f, 1.60533249f, 1.83941531f, 1.45449805f, 1.36986887f, 1.40352952f, 1.33363223f,
+    1.33623075f, 1.45251238f, 1.34914303f, 1.3523612f, 1.59291661f, 1.52659917f, 1.36011434f, 1.3814491f,
+    1.29846752f, 1.2745837f, 1.26245308f, 1.31571937f, 1.60215807f, 1.71990633f, 1.43545294f, 1.61641145f,
+    1.70344305f, 1.47377777f, 1.74743176f, 1.69715953f, 1.55161202f, 1.48045135f, 1.56312132f, 1.52378881f,
+    1.72863328f, 1.62360322f, 1.71944845f, 1.89181972f, 1.44866395f, 1.54024494f, 1.41659141f, 1.30393696f,
+    1.52279425f, 1.68199182f, 1.52245748f, 1.53660381f, 1.54864478f, 1.45319426f, 1.36371279f, 1.27081156f,
+    1.52514124f, 1.43588543f, 1.44200945f, 1.48475838f, 1.63582659f, 1.80325592f, 1.61055052f, 1.7760545f,
+    2.07041645f, 2.04958606f, 2.02564621f, 2.24104714f, 2.00837708f, 2.03332043f, 2.01764178f, 2.05166292f,
+    2.01583028f, 2.06129527f, 1.99435925f, 2.19094324f, 1.69838536f, 1.65620697f, 1.70779538f, 1.57392013f,
+    1.9158411f, 1.68956614f, 1.95495212f, 1.72938013f, 1.12172425f, 1.17391872f, 1.25396836f, 1.36527228f,
+    1.87490416f, 1.65244174f, 1.83581507f, 1.79700673f, 1.58779299f, 1.72063291f, 1.7005837f, 1.80719721f,
+    1.40804112f, 1.2995801f, 1.52980733f, 1.5063206f, 1.29036963f, 1.25670993f, 1.27795196f, 1.28849733f,
+    1.51791084f, 1.37695312f, 1.47748232f, 1.67724919f, 1.49222279f, 1.6900208f, 1.41260016f, 1.5676682f,
+    1.78096306f, 1.61374342f, 1.79977071f, 1.53873301f, 1.28560114f, 1.34251535f, 1.37751019f, 1.36388016f,
+    1.81163955f, 1.6278882f, 1.77450216f, 1.81949127f, 1.68192697f, 1.83348894f, 1.71647f, 1.82442236f,
+    1.8900882f, 1.86770773f, 1.84163392f, 2.03044224f, 1.80597591f, 1.8233211f, 1.83479404f, 1.92032051f,
+    1.83759999f, 1.86122286f, 1.82455575f, 2.05436516f, 1.53955483f, 1.50274789f, 1.55447352f, 1.55936193f,
+    1.43623185f, 1.6989255f, 1.38606679f, 1.58752251f, 1.82961154f, 1.7061224f, 1.60300004f, 1.57617617f,
+    1.26801813f, 1.38329184f, 1.22510397f, 1.29535723f, 1.86936665f, 1.9130832f, 1.64069986f, 1.77463055f,
+    1.7154001f, 1.46693563f, 1.74920774f, 1.63866091f, 1.59453714f, 1.48616302f, 1.57886243f, 1.53810549f,
+    1.72910047f, 1.54479456f, 1.69085813f, 1.82202125f, 1.50780463f, 1.61850941f, 1.43678069f, 1.33660221f,
+    1.52531624f, 1.7630409f, 1.54010725f, 1.57270646f, 1.55876029f, 1.45591021f, 1.37351441f, 1.30713069f,
+    1.45080364f, 1.48883104f, 1.33274019f, 1.41048098f, 1.78883636f, 1.90921915f, 1.67623961f, 1.88254666f,
+    2.00680017f, 1.89870048f, 1.9412657f, 2.24602914f, 1.94451869f, 1.99281847f, 1.98557258f, 2.02545476f,
+    1.97167695f, 1.99234581f, 1.96778131f, 2.13878608f, 1.79643476f, 1.71524107f, 1.77949452f, 1.56777537f,
+    1.80449653f, 1.75602412f, 1.82664049f, 1.82703376f, 1.19665134f, 1.26800191f, 1.21259499f, 1.33879495f,
+    1.76191676f, 1.74713624f, 1.76922405f, 1.92079687f, 1.55160987f, 1.82028246f, 1.66997254f, 1.91036022f,
+    1.65155828f, 1.66147435f, 1.79466057f, 1.82461715f, 1.40907013f, 1.39434946f, 1.52214241f, 1.56866395f,
+    1.87112522f, 1.82960987f, 1.84033263f, 2.66640425f, 1.54003644f, 1.76443982f, 1.62838805f, 1.78389049f,
+    2.04235268f, 1.84930933f, 2.07402349f, 1.90988612f, 1.31238699f, 1.42922962f, 1.43455338f, 1.52818441f,
+    2.0912931f, 1.9593128f, 2.01363087f, 2.14935279f, 1.72085261f, 1.95968437f, 1.89543962f, 2.0309546f,
+    1.69076157f, 1.62180436f, 1.63283682f, 1.8374548f, 1.70674479f, 1.69440365f, 1.71917665f, 1.7363261f,
+    1.66737604f, 1.64470053f, 1.60533249f, 1.83941531f, 1.45449805f, 1.36986887f, 1.40352952f, 1.33363223f,
+    1.33623075f, 1.45251238f, 1.34914303f, 1.3523612f, 1.59291661f, 1.52659917f, 1.36011434f, 1.3814491f,
+    1.29846752f, 1.2745837f, 1.26245308f, 1.31571937f, 1.60215807f, 1.71990633f, 1.43545294f, 1.61641145f,
+    1.70344305f, 1.47377777f, 1.74743176f, 1.69715953f, 1.55161202f, 1.48045135f, 1.56312132f, 1.52378881f,
+    1.72863328f, 1.62360322f, 1.71944845f, 1.89181972f, 1.44866395f, 1.54024494f, 1.41659141f, 1.30393696f,
+    1.52279425f, 1.68199182f, 1.52245748f, 1.53660381f, 1.54864478f, 1.45319426f, 1.36371279f, 1.27081156f,
+    1.52514124f, 1.43588543f, 1.44200945f, 1.48475838f, 1.63582659f, 1.80325592f, 1.61055052f, 1.7760545f,
+    2.07041645f, 2.04958606f, 2.02564621f, 2.24104714f, 2.00837708f, 2.03332043f, 2.01764178f, 2.05166292f,
+    2.01583028f, 2.06129527f, 1.99435925f, 2.19094324f, 1.69838536f, 1.65620697f, 1.70779538f, 1.57392013f,
+    1.9158411f, 1.68956614f, 1.95495212f, 1.72938013f, 1.12172425f, 1.17391872f, 1.25396836f, 1.36527228f,
+    1.87490416f, 1.65244174f, 1.83581507f, 1.79700673f, 1.58779299f, 1.72063291f, 1.7005837f, 1.80719721f,
+    1.40804112f, 1.2995801f, 1.52980733f, 1.5063206f, 1.29036963f, 1.25670993f, 1.27795196f, 1.28849733f,
+    1.51791084f, 1.37695312f, 1.47748232f, 1.67724919f, 1.49222279f, 1.6900208f, 1.41260016f, 1.5676682f,
+    1.78096306f, 1.61374342f, 1.79977071f, 1.53873301f, 1.28560114f, 1.34251535f, 1.37751019f, 1.36388016f,
+    1.81163955f, 1.6278882f, 1.77450216f, 1.81949127f, 1.68192697f, 1.83348894f, 1.71647f, 1.82442236f,
+    1.8900882f, 1.86770773f, 1.84163392f, 2.03044224f, 1.80597591f, 1.8233211f, 1.83479404f, 1.92032051f,
+    1.83759999f, 1.86122286f, 1.82455575f, 2.05436516f, 1.53955483f, 1.50274789f, 1.55447352f, 1.55936193f,
+    1.43623185f, 1.6989255f, 1.38606679f, 1.58752251f, 1.82961154f, 1.7061224f, 1.60300004f, 1.57617617f,
+    1.26801813f, 1.38329184f, 1.22510397f, 1.29535723f, 1.86936665f, 1.9130832f, 1.64069986f, 1.77463055f,
+    1.7154001f, 1.46693563f, 1.74920774f, 1.63866091f, 1.59453714f, 1.48616302f, 1.57886243f, 1.53810549f,
+    1.72910047f, 1.54479456f, 1.69085813f, 1.82202125f, 1.50780463f, 1.61850941f, 1.43678069f, 1.33660221f,
+    1.52531624f, 1.7630409f, 1.54010725f, 1.57270646f, 1.55876029f, 1.45591021f, 1.37351441f, 1.30713069f,
+    1.45080364f, 1.48883104f, 1.33274019f, 1.41048098f, 1.78883636f, 1.90921915f, 1.67623961f, 1.88254666f,
+    2.00680017f, 1.89870048f, 1.9412657f, 2.24602914f, 1.94451869f, 1.99281847f, 1.98557258f, 2.02545476f,
+    1.97167695f, 1.99234581f, 1.96778131f, 2.13878608f, 1.79643476f, 1.71524107f, 1.77949452f, 1.56777537f,
+    1.80449653f, 1.75602412f, 1.82664049f, 1.82703376f, 1.19665134f, 1.26800191f, 1.21259499f, 1.33879495f,
+    1.76191676f, 1.74713624f, 1.76922405f, 1.92079687f, 1.55160987f, 1.82028246f, 1.66997254f, 1.91036022f,
+    1.65155828f, 1.66147435f, 1.79466057f, 1.82461715f, 1.40907013f, 1.39434946f, 1.52214241f, 1.56866395f,
+    1.87112522f, 1.82960987f, 1.84033263f, 2.66640425f, 1.54003644f, 1.76443982f, 1.62838805f, 1.78389049f,
+    2.04235268f, 1.84930933f, 2.07402349f, 1.90988612f, 1.31238699f, 1.42922962f, 1.43455338f, 1.52818441f,
+    2.0912931f, 1.9593128f, 2.01363087f, 2.14935279f, 1.72085261f, 1.95968437f, 1.89543962f, 2.0309546f,
+    1.69076157f, 1.62180436f, 1.63283682f, 1.8374548f, 1.70674479f, 1.69440365f, 1.71917665f, 1.7363261f,
+    1.66737604f, 1.64470053f, 1.60533249f, 1.83941531f, 1.45449805f, 1.36986887f, 1.40352952f, 1.33363223f
+};
+
+alignas(64) constexpr float MODEL_R94_TEMPLATE_SORTED_MEANS[] = {
+    59.5697174f, 59.8689079f, 59.9588623f, 60.7566719f, 60.9108963f, 61.1142311f, 61.2866364f, 61.3246346f,
+    61.3594627f, 61.4845505f, 61.8370972f, 61.8450241f, 61.8546638f, 62.8827019f, 63.0483856f, 63.5849762f,
+    64.0168152f, 64.7299881f, 64.8541794f, 65.158783f, 65.3077774f, 65.4145126f, 65.6900177f, 65.9408264f,
+    66.1891403f, 66.2740326f, 66.6998444f, 66.7469711f, 66.8619919f, 67.1266708f, 67.1555939f, 67.1674347f,
+    67.1835709f, 67.2462158f, 67.269455f, 67.4188004f, 67.4653244f, 67.5783844f, 67.8330536f, 67.9651947f,
+    68.0199661f, 68.0589676f, 68.0794525f, 68.1947632f, 68.253334f, 68.3021317f, 68.4263992f, 68.4713211f,
+    68.493042f, 68.5360413f, 68.7786789f, 68.7949448f, 68.8162689f, 68.8762665f, 68.9557419f, 68.9572067f,
+    68.9852905f, 69.0522003f, 69.084816f, 69.1833878f, 69.4383698f, 69.4699631f, 69.4825363f, 69.5318451f,
+    69.5488205f, 69.6485291f, 69.6832962f, 69.7465897f, 69.8205261f, 69.8829041f, 70.0093842f, 70.0916443f,
+    70.1029282f, 70.1796112f, 70.4834747f, 70.5314331f, 70.9192429f, 70.9388657f, 71.1124649f, 71.1157837f,
+    71.1769485f, 71.3451691f, 71.3636703f, 71.4203186f, 71.4225922f, 71.5222015f, 71.5824356f, 71.7344589f,
+    71.8135757f, 71.9786606f, 72.079628f, 72.1332245f, 72.1919708f, 72.2137909f, 72.3498764f, 72.3717728f,
+    72.4686508f, 72.5002213f, 72.5973358f, 72.7178268f, 72.8673248f, 72.8752365f, 73.0289993f, 73.0524368f,
+    73.2214584f, 73.2236481f, 73.3409653f, 73.4466553f, 73.4642563f, 73.483345f, 73.6284256f, 73.6956863f,
+    73.8196259f, 73.8383942f, 73.854454f, 73.918869f, 74.0008621f, 74.0395889f, 74.0420609f, 74.045166f,
+    74.0936584f, 74.1159897f, 74.2581787f, 74.265976f, 74.3239975f, 74.3314056f, 74.3444824f, 74.3883972f,
+    74.4362488f, 74.4977646f, 74.498848f, 74.5762482f, 74.6436386f, 74.6710052f, 74.6736908f, 74.767067f,
+    74.7683563f, 74.7959595f, 74.8318253f, 74.980835f, 75.0500031f, 75.1085205f, 75.1376266f, 75.1439133f,
+    75.1899109f, 75.3608017f, 75.4174652f, 75.4179993f, 75.5022888f, 75.5300293f, 75.5449753f, 75.5901413f,
+    75.6070938f, 75.6384964f, 75.7161636f, 75.7299728f, 75.8015594f, 75.8151398f, 75.8649673f, 75.919899f,
+    75.9252167f, 75.9635696f, 75.964447f, 76.0188065f, 76.1822662f, 76.1975708f, 76.2260208f, 76.2444687f,
+    76.3170013f, 76.3316803f, 76.3396225f, 76.3544922f, 76.4538193f, 76.493103f, 76.5208054f, 76.614624f,
+    76.6301727f, 76.6358109f, 76.6426163f, 76.6604309f, 76.6717072f, 76.8061218f, 76.8547668f, 76.8924637f,
+    76.9231949f, 77.0438232f, 77.0921402f, 77.0951157f, 77.2164917f, 77.2228012f, 77.2546387f, 77.3195648f,
+    77.347847f, 77.4384842f, 77.4462585f, 77.4514389f, 77.4699249f, 77.5790787f, 77.7459946f, 77.7626953f,
+    77.7962112f, 77.8471451f, 77.9664917f, 77.967186f, 78.0123062f, 78.1200485f, 78.1498871f, 78.1698074f,
+    78.1844101f, 78.2001495f, 78.2838211f, 78.4311371f, 78.4444656f, 78.486618f, 78.5253525f, 78.5646667f,
+    78.5826263f, 78.6239777f, 78.6847839f, 78.7214432f, 78.7848969f, 78.830513f, 78.8811111f, 78.8920746f,
+    78.8975677f, 79.0701294f, 79.1706085f, 79.1743164f, 79.2090912f, 79.257843f, 79.2928391f, 79.3438644f,
+    79.4820404f, 79.5900345f, 79.6565018f, 79.6723022f, 79.7012787f, 79.8612289f, 79.9524002f, 80.0194702f,
+    80.1198502f, 80.1215363f, 80.2544937f, 80.2583923f, 80.2624817f, 80.3442993f, 80.3464355f, 80.4088364f,
+    80.4779892f, 80.4923553f, 80.4955597f, 80.4985046f, 80.5166397f, 80.5668335f, 80.5845337f, 80.7069855f,
+    80.7110901f, 80.7200012f, 80.7295074f, 80.734108f, 80.7830353f, 80.8212662f, 80.8332367f, 80.8371811f,
+    80.9457855f, 81.1610718f, 81.1664505f, 81.2242432f, 81.3642426f, 81.3888626f, 81.3991547f, 81.4243164f,
+    81.4687271f, 81.512291f, 81.5238647f, 81.5281601f, 81.5286484f, 81.5396423f, 81.6507263f, 81.6574478f,
+    81.6702957f, 81.679718f, 81.7517014f, 81.7549896f, 81.7901001f, 81.8246994f, 81.8410187f, 81.8511353f,
+    81.9637604f, 82.0361176f, 82.0459518f, 82.1012802f, 82.1287079f, 82.1289978f, 82.1334152f, 82.1384659f,
+    82.1912537f, 82.1996765f, 82.2083206f, 82.2311707f, 82.2669296f, 82.302803f, 82.3288956f, 82.4770584f,
+    82.4782944f, 82.4918137f, 82.5394669f, 82.5552216f, 82.5596085f, 82.622963f, 82.6341324f, 82.6538773f,
+    82.6886139f, 82.7354584f, 82.8002014f, 82.8272858f, 82.8553543f, 82.8803024f, 82.8880997f, 82.9161148f,
+    82.9830399f, 82.9870453f, 83.0040436f, 83.0043106f, 83.024559f, 83.047348f, 83.1270981f, 83.2116928f,
+    83.2153091f, 83.2250595f, 83.3210831f, 83.3261566f, 83.3414078f, 83.3591385f, 83.3777847f, 83.3866348f,
+    83.4209671f, 83.4229813f, 83.4589615f, 83.4810181f, 83.4890976f, 83.4933701f, 83.5086441f, 83.515831f,
+    83.5577469f, 83.5932693f, 83.5980453f, 83.6013718f, 83.6039352f, 83.6364288f, 83.6475449f, 83.6962509f,
+    83.7212372f, 83.7556076f, 83.7916565f, 83.858902f, 83.9132309f, 83.926796f, 84.018364f, 84.1072006f,
+    84.1689987f, 84.1975632f, 84.2448273f, 84.2857971f, 84.3150101f, 84.3359528f, 84.3499908f, 84.4930649f,
+    84.5639038f, 84.5818024f, 84.6087112f, 84.6114807f, 84.664032f, 84.6806793f, 84.6984177f, 84.7142105f,
+    84.7164459f, 84.8067169f, 84.9003983f, 84.9146347f, 84.9767609f, 84.9954758f, 85.0028687f, 85.0281601f,
+    85.0836105f, 85.1041031f, 85.1436691f, 85.1778717f, 85.2023392f, 85.2774734f, 85.2944641f, 85.299202f,
+    85.3250885f, 85.3325195f, 85.4027863f, 85.4802628f, 85.4812698f, 85.4996567f, 85.5542526f, 85.6478653f,
+    85.6492157f, 85.6610336f, 85.6652679f, 85.6693115f, 85.676712f, 85.711525f, 85.8839035f, 85.8876572f,
+    85.9125061f, 85.9511185f, 85.9718323f, 85.9832458f, 86.0377121f, 86.071701f, 86.0782928f, 86.0977707f,
+    86.1020813f, 86.1222382f, 86.1589432f, 86.1620483f, 86.2615356f, 86.2746964f, 86.3056412f, 86.3097458f,
+    86.3233795f, 86.4573746f, 86.4893341f, 86.6883621f, 86.7283401f, 86.7862091f, 86.7863007f, 86.8413391f,
+    87.0040131f, 87.006691f, 87.048645f, 87.0582962f, 87.1108017f, 87.1936264f, 87.2986221f, 87.3359909f,
+    87.3518372f, 87.3662567f, 87.3768692f, 87.396286f, 87.42939f, 87.4654312f, 87.5364304f, 87.5893707f,
+    87.6203995f, 87.7072601f, 87.7585144f, 87.8121872f, 87.8595428f, 88.0766373f, 88.0948105f, 88.127739f,
+    88.1363754f, 88.2903442f, 88.3013153f, 88.3326187f, 88.3681335f, 88.4361877f, 88.5113373f, 88.5177994f,
+    88.5726013f, 88.6145706f, 88.6713943f, 88.7119141f, 88.8059692f, 88.8267746f, 88.912529f, 89.1419678f,
+    89.206131f, 89.2265778f, 89.3126907f, 89.3816071f, 89.4956818f, 89.5221939f, 89.5264053f, 89.5585022f,
+    89.6018982f, 89.6105347f, 89.668251f, 89.6853333f, 89.6932373f, 89.7430801f, 89.7886505f, 89.9391403f,
+    89.9489975f, 89.9786301f, 89.9820786f, 90.0061111f, 90.0088272f, 90.0501785f, 90.0793076f, 90.1101379f,
+    90.1484299f, 90.1999283f, 90.2790985f, 90.3615799f, 90.3692551f, 90.3835297f, 90.4054642f, 90.6141129f,
+    90.6598587f, 90.7384415f, 90.7671814f, 90.8713837f, 90.8869019f, 90.8962402f, 91.0143585f, 91.0639343f,
+    91.0645218f, 91.0867844f, 91.1384125f, 91.1712875f, 91.1796265f, 91.1826172f, 91.1976776f, 91.2013245f,
+    91.2700806f, 91.3455734f, 91.410965f, 91.5109787f, 91.6233444f, 91.6921692f, 91.7302246f, 91.8014603f,
+    91.8167877f, 91.8670654f, 91.8830948f, 91.9427414f, 91.9909134f, 92.0398026f, 92.0509796f, 92.0594025f,
+    92.0727158f, 92.2429886f, 92.2673874f, 92.4485245f, 92.4500809f, 92.5587769f, 92.5621262f, 92.5933151f,
+    92.6219482f, 92.6586533f, 92.6675186f, 92.7037277f, 92.7848587f, 92.8001251f, 92.8143616f, 92.8614044f,
+    92.8702774f, 92.8866959f, 92.8964844f, 92.9173813f, 92.924942f, 92.9474182f, 93.0171661f, 93.0383148f,
+    93.0524902f, 93.0931473f, 93.1204681f, 93.1682816f, 93.2022934f, 93.2220306f, 93.3278809f, 93.3345947f,
+    93.3353729f, 93.4208755f, 93.456749f, 93.4627533f, 93.5079269f, 93.50914f, 93.6701889f, 93.685051f,
+    93.689415f, 93.6921387f, 93.7011795f, 93.7120972f, 93.7422562f, 93.7804947f, 93.9112854f, 93.9277191f,
+    93.9543152f, 93.9945602f, 94.016861f, 94.1697464f, 94.1716232f, 94.2913818f, 94.3038864f, 94.3330231f,
+    94.3578644f, 94.4240189f, 94.5683975f, 94.743515f, 94.8679276f, 94.8964615f, 94.926445f, 94.9776306f,
+    94.9889755f, 95.0853348f, 95.1160812f, 95.2366409f, 95.2880478f, 95.3181458f, 95.320755f, 95.3900986f,
+    95.3913422f, 95.4424973f, 95.4464951f, 95.4512939f, 95.4675827f, 95.4957733f, 95.5238342f, 95.5300369f,
+    95.5673599f, 95.573822f, 95.5753632f, 95.6287918f, 95.6766434f, 95.7072525f, 95.7230988f, 95.7263031f,
+    95.7318192f, 95.756424f, 95.7871857f, 95.792038f, 95.8501053f, 95.8599396f, 95.9470139f, 95.9749527f,
+    96.0137939f, 96.027092f, 96.0385284f, 96.0426483f, 96.0524979f, 96.127182f, 96.1393967f, 96.1982956f,
+    96.2204361f, 96.2594223f, 96.2904358f, 96.3001251f, 96.3585587f, 96.3685837f, 96.3739014f, 96.3798904f,
+    96.4203491f, 96.4946136f, 96.5733566f, 96.6356201f, 96.6433334f, 96.6609573f, 96.7719345f, 96.7727737f,
+    96.7890701f, 96.8329849f, 96.8336334f, 96.8556747f, 96.8899384f, 96.9698715f, 97.0222397f, 97.0410614f,
+    97.0569229f, 97.1358109f, 97.1789398f, 97.1932831f, 97.2212372f, 97.3301773f, 97.3435669f, 97.3696594f,
+    97.3847961f, 97.400383f, 97.4595795f, 97.4709854f, 97.5646362f, 97.6072845f, 97.6156464f, 97.6618729f,
+    97.6914978f, 97.7179108f, 97.7509308f, 97.7818832f, 97.8332977f, 97.885437f, 97.887085f, 97.9043198f,
+    97.9298859f, 97.9636612f, 97.9742508f, 97.9825287f, 98.0456314f, 98.0778351f, 98.1299438f, 98.1651459f,
+    98.2103653f, 98.2394257f, 98.2642212f, 98.3671036f, 98.4360352f, 98.5701828f, 98.5815048f, 98.5826797f,
+    98.6388474f, 98.6981201f, 98.7301941f, 98.7639389f, 98.7654037f, 98.8104324f, 98.8316345f, 98.8534927f,
+    98.8810425f, 98.9017563f, 98.9174042f, 98.9320374f, 98.993042f, 99.0835037f, 99.0836105f, 99.1426163f,
+    99.1479263f, 99.1488571f, 99.2040329f, 99.2804184f, 99.2961044f, 99.3142471f, 99.3553467f, 99.3745422f,
+    99.4517136f, 99.4580307f, 99.4855423f, 99.5081863f, 99.5158386f, 99.5307159f, 99.5544128f, 99.5687943f,
+    99.5786819f, 99.5944748f, 99.6059952f, 99.6508713f, 99.6574249f, 99.6915665f, 99.6935577f, 99.6938629f,
+    99.6984787f, 99.7050171f, 99.7465591f, 99.8639832f, 99.8948746f, 99.9096222f, 99.9168854f, 99.9312439f,
+    99.9429321f, 99.9471207f, 99.9687958f, 100.000786f, 100.050407f, 100.061516f, 100.094231f, 100.112f,
+    100.143387f, 100.147697f, 100.178978f, 100.227814f, 100.25602f, 100.285294f, 100.287933f, 100.349869f,
+    100.378876f, 100.481873f, 100.503853f, 100.516609f, 100.545128f, 100.55191f, 100.57589f, 100.585289f,
+    100.618065f, 100.631462f, 100.670464f, 100.719833f, 100.721626f, 100.749329f, 100.761002f, 100.782707f,
+    100.809074f, 100.838821f, 100.857712f, 100.909203f, 100.922798f, 100.966164f, 101.007011f, 101.02961f,
+    101.042526f, 101.084656f, 101.170959f, 101.24456f, 101.279068f, 101.30307f, 101.336311f, 101.379601f,
+    101.406799f, 101.415405f, 101.477333f, 101.489716f, 101.545334f, 101.552475f, 101.584274f, 101.598381f,
+    101.694191f, 101.723145f, 101.745041f, 101.761826f, 101.795364f, 101.835907f, 101.843895f, 101.892471f,
+    101.961151f, 101.981102f, 102.006203f, 102.05291f, 102.066628f, 102.075729f, 102.137978f, 102.151443f,
+    102.158012f, 102.177505f, 102.183372f, 102.245781f, 102.254982f, 102.268036f, 102.288841f, 102.353027f,
+    102.355415f, 102.394287f, 102.431892f, 102.470329f, 102.481255f, 102.512917f, 102.523216f, 102.574615f,
+    102.596352f, 102.609695f, 102.644806f, 102.665955f, 102.69091f, 102.720909f, 102.722572f, 102.728561f,
+    102.788628f, 102.828262f, 102.954712f, 102.985184f, 102.989693f, 102.996613f, 103.010162f, 103.026192f,
+    103.09259f, 103.095772f, 103.103096f, 103.157326f, 103.266525f, 103.300438f, 103.314438f, 103.413185f,
+    103.491684f, 103.496536f, 103.50444f, 103.51757f, 103.532722f, 103.570984f, 103.624222f, 103.638969f,
+    103.668503f, 103.740891f, 103.838173f, 103.855499f, 103.897499f, 103.922478f, 103.955162f, 104.021896f,
+    104.027771f, 104.067108f, 104.091034f, 104.141739f, 104.18557f, 104.196114f, 104.304825f, 104.306282f,
+    104.332245f, 104.343201f, 104.360291f, 104.405724f, 104.618767f, 104.639191f, 104.689491f, 104.709679f,
+    104.795113f, 104.795258f, 104.918571f, 104.918633f, 105.028793f, 105.038269f, 105.052132f, 105.083412f,
+    105.11467f, 105.157127f, 105.168381f, 105.196251f, 105.222878f, 105.233101f, 105.238716f, 105.403801f,
+    105.427109f, 105.454216f, 105.456841f, 105.520599f, 105.550209f, 105.671967f, 105.674187f, 105.69207f,
+    105.834969f, 105.928307f, 105.943748f, 105.97438f, 106.022881f, 106.108009f, 106.20211f, 106.223167f,
+    106.241089f, 106.265686f, 106.293999f, 106.305206f, 106.308731f, 106.329567f, 106.426193f, 106.444466f,
+    106.571953f, 106.591324f, 106.686409f, 106.750816f, 106.791031f, 106.9048f, 106.90654f, 106.989288f,
+    107.048904f, 107.074974f, 107.1008f, 107.114151f, 107.156075f, 107.21299f, 107.262054f, 107.309845f,
+    107.323509f, 107.354362f, 107.36499f, 107.625061f, 107.698746f, 107.754822f, 107.807106f, 107.93084f,
+    108.127251f, 108.197922f, 108.207481f, 108.291f, 108.351128f, 108.509682f, 108.519196f, 108.772453f,
+    108.913506f, 109.056244f, 109.281929f, 109.668587f, 109.682083f, 109.830513f, 109.874664f, 110.036034f,
+    110.182777f, 110.538818f, 110.695854f, 111.054863f, 111.712997f, 111.761826f, 111.825813f, 112.230995f,
+    112.32885f, 112.612602f, 112.715691f, 112.904495f, 112.914764f, 112.991631f, 113.075783f, 113.24913f,
+    113.356667f, 113.435898f, 113.54319f, 113.834084f, 113.900841f, 113.953194f, 114.002655f, 114.235176f,
+    114.3955f, 114.689735f, 114.732597f, 115.279297f, 115.352531f, 115.472549f, 115.528259f, 115.908028f,
+    115.909363f, 115.949402f, 116.146652f, 116.170174f, 116.314346f, 116.473274f, 116.561661f, 116.807915f,
+    117.188484f, 117.51722f, 117.555267f, 117.783752f, 117.983932f, 118.288406f, 118.492645f, 118.527374f
+};
+
+alignas(64) constexpr u32 MODEL_R94_TEMPLATE_SORTED_KMERS[] = {
+    673, 675, 687, 161, 175, 163, 419, 417,
+    559, 931, 431, 929, 943, 303, 47, 815,
+    655, 911, 685, 547, 545, 641, 643, 173,
+    143, 399, 683, 291, 899, 289, 557, 429,
+    171, 681, 941, 879, 686, 623, 169, 367,
+    35, 111, 897, 427, 653, 174, 33, 803,
+    674, 527, 301, 801, 939, 651, 387, 131,
+    649, 45, 425, 129, 555, 385, 271, 430,
+    15, 162, 558, 942, 813, 937, 418, 909,
+    672, 299, 553, 930, 783, 43, 160, 907,
+    654, 46, 684, 302, 141, 397, 297, 416,
+    811, 139, 928, 905, 814, 395, 680, 172,
+    137, 41, 611, 867, 910, 168, 355, 393,
+    809, 642, 1007, 99, 751, 682, 428, 940,
+    877, 739, 525, 556, 546, 609, 515, 424,
+    652, 621, 591, 170, 142, 995, 865, 513,
+    847, 365, 936, 737, 398, 353, 648, 650,
+    552, 523, 109, 97, 640, 79, 335, 300,
+    259, 290, 296, 483, 426, 269, 544, 993,
+    898, 44, 3, 938, 878, 13, 267, 227,
+    554, 908, 495, 622, 257, 875, 40, 481,
+    812, 363, 619, 239, 11, 225, 521, 298,
+    647, 1, 110, 366, 679, 719, 130, 107,
+    288, 34, 781, 526, 140, 645, 386, 771,
+    808, 904, 802, 167, 906, 42, 587, 136,
+    896, 138, 975, 396, 779, 843, 265, 935,
+    677, 32, 769, 392, 394, 128, 75, 9,
+    331, 873, 270, 617, 810, 14, 800, 423,
+    165, 361, 551, 1005, 903, 384, 207, 749,
+    105, 646, 933, 876, 135, 678, 620, 777,
+    295, 524, 579, 782, 463, 901, 1006, 1003,
+    39, 133, 364, 807, 707, 108, 750, 421,
+    166, 835, 747, 845, 589, 391, 522, 644,
+    549, 323, 520, 934, 491, 514, 67, 493,
+    715, 872, 585, 676, 268, 705, 333, 616,
+    12, 577, 866, 77, 389, 841, 1001, 293,
+    10, 360, 610, 550, 745, 37, 805, 963,
+    237, 833, 354, 494, 266, 104, 902, 971,
+    422, 329, 73, 8, 164, 717, 519, 871,
+    321, 806, 264, 65, 864, 489, 134, 235,
+    932, 98, 7, 874, 238, 608, 738, 780,
+    294, 38, 459, 994, 1004, 195, 618, 512,
+    961, 352, 615, 713, 2, 263, 748, 258,
+    517, 590, 451, 736, 362, 203, 900, 671,
+    992, 973, 846, 96, 103, 390, 106, 927,
+    132, 193, 5, 778, 718, 420, 482, 863,
+    233, 359, 334, 584, 449, 548, 480, 776,
+    78, 607, 586, 492, 869, 261, 969, 1000,
+    0, 840, 842, 95, 205, 744, 226, 256,
+    388, 775, 770, 991, 292, 224, 735, 974,
+    72, 999, 518, 328, 870, 804, 36, 236,
+    330, 461, 743, 74, 351, 613, 159, 201,
+    287, 488, 1002, 799, 457, 415, 6, 543,
+    101, 844, 588, 746, 716, 614, 773, 206,
+    357, 262, 516, 712, 768, 102, 487, 490,
+    714, 997, 462, 232, 4, 31, 332, 223,
+    76, 741, 231, 479, 358, 583, 972, 868,
+    260, 839, 711, 968, 578, 998, 706, 669,
+    970, 774, 834, 234, 742, 485, 612, 71,
+    200, 204, 100, 925, 327, 322, 456, 967,
+    703, 229, 66, 460, 709, 202, 458, 576,
+    772, 962, 704, 996, 486, 356, 861, 832,
+    581, 740, 767, 199, 605, 837, 1023, 859,
+    230, 989, 710, 603, 320, 511, 93, 64,
+    455, 965, 959, 194, 413, 157, 69, 450,
+    733, 484, 960, 91, 582, 325, 285, 838,
+    541, 255, 797, 197, 708, 349, 987, 228,
+    447, 347, 966, 192, 670, 731, 448, 453,
+    923, 475, 667, 862, 580, 191, 70, 639,
+    665, 857, 836, 659, 219, 29, 198, 606,
+    990, 477, 926, 326, 601, 915, 851, 657,
+    221, 734, 964, 595, 921, 723, 94, 319,
+    701, 979, 454, 68, 127, 895, 985, 89,
+    765, 509, 1021, 196, 913, 324, 729, 83,
+    283, 345, 350, 795, 849, 452, 478, 411,
+    593, 339, 158, 977, 286, 957, 155, 473,
+    721, 575, 798, 383, 222, 409, 414, 856,
+    147, 668, 153, 467, 253, 281, 988, 403,
+    211, 542, 860, 732, 539, 81, 831, 858,
+    600, 983, 510, 604, 793, 1022, 855, 145,
+    702, 401, 924, 766, 602, 727, 445, 217,
+    787, 63, 337, 664, 92, 599, 537, 88,
+    189, 531, 275, 637, 30, 666, 984, 465,
+    920, 476, 90, 27, 986, 87, 689, 922,
+    728, 344, 785, 981, 209, 346, 273, 529,
+    893, 730, 220, 853, 508, 125, 663, 725,
+    317, 348, 958, 471, 1020, 156, 764, 25,
+    597, 919, 254, 343, 19, 215, 700, 658,
+    796, 505, 1017, 661, 472, 284, 761, 540,
+    85, 474, 412, 280, 982, 914, 850, 282,
+    469, 691, 17, 945, 978, 446, 152, 638,
+    854, 763, 792, 917, 726, 408, 216, 381,
+    697, 794, 722, 573, 594, 753, 154, 755,
+    507, 410, 1019, 1016, 504, 598, 341, 28,
+    1009, 218, 760, 536, 213, 190, 791, 829,
+    506, 252, 894, 696, 980, 538, 497, 1011,
+    126, 318, 956, 470, 86, 151, 1018, 279,
+    82, 762, 724, 662, 433, 535, 249, 177,
+    947, 499, 852, 690, 466, 953, 61, 24,
+    407, 338, 976, 146, 636, 698, 596, 720,
+    251, 26, 848, 656, 214, 952, 918, 789,
+    468, 342, 241, 633, 243, 592, 402, 149,
+    248, 84, 23, 277, 574, 210, 786, 1010,
+    444, 274, 533, 912, 754, 530, 660, 892,
+    632, 498, 124, 405, 382, 188, 699, 212,
+    435, 946, 635, 464, 441, 954, 250, 80,
+    830, 440, 316, 121, 889, 179, 916, 305,
+    688, 185, 312, 634, 184, 21, 340, 120,
+    313, 888, 790, 955, 208, 123, 62, 150,
+    625, 891, 336, 18, 1008, 278, 534, 434,
+    752, 627, 144, 890, 122, 496, 314, 572,
+    442, 178, 406, 307, 242, 380, 186, 881,
+    400, 944, 113, 148, 788, 784, 561, 272,
+    306, 828, 626, 883, 528, 377, 22, 817,
+    276, 115, 532, 568, 824, 376, 443, 825,
+    404, 569, 379, 60, 49, 882, 56, 240,
+    187, 432, 176, 757, 501, 315, 759, 16,
+    20, 378, 826, 114, 1013, 563, 570, 57,
+    369, 1015, 502, 304, 503, 624, 758, 819,
+    371, 1014, 562, 756, 58, 818, 51, 500,
+    245, 827, 1012, 880, 50, 112, 247, 571,
+    370, 246, 560, 244, 816, 693, 48, 59,
+    695, 694, 368, 692, 949, 631, 629, 951,
+    630, 950, 887, 628, 119, 117, 885, 118,
+    948, 886, 181, 183, 884, 116, 437, 439,
+    182, 180, 438, 375, 436, 309, 373, 310,
+    374, 311, 565, 567, 372, 308, 566, 564,
+    821, 822, 823, 53, 820, 55, 54, 52
+};
+
+constexpr ModelPreset MODEL_R94_TEMPLATE = {
+    5, 90.2083511f, 12.8326607f,
+    MODEL_R94_TEMPLATE_MEANS, MODEL_R94_TEMPLATE_VARS_X2,
+    MODEL_R94_TEMPLATE_LOGNORM_DENOMS, MODEL_R94_TEMPLATE_SORTED_MEANS,
+    MODEL_R94_TEMPLATE_SORTED_KMERS
+};
+
+alignas(64) constexpr float MODEL_R94_COMPLEMENT_MEANS[] = {
+    90.4054642f, 96.127182f, 94.016861f, 98.0456314f, 99.7465591f, 100.57589f, 98.7301941f, 99.8639832f,
+    107.074974f, 107.354362f, 106.791031f, 108.207481f, 100.349869f, 102.151443f, 99.9429321f, 103.897499f,
+    73.3409653f, 80.3464355f, 79.1743164f, 83.3414078f, 80.4088364f, 86.1589432f, 81.8410187f, 85.0281601f,
+    85.6610336f, 88.4361877f, 87.3662567f, 90.0061111f, 74.3314056f, 83.3261566f, 75.5901413f, 83.7212372f,
+    85.4802628f, 93.0524902f, 90.7384415f, 95.7230988f, 92.0509796f, 97.2212372f, 93.9112854f, 97.0222397f,
+    96.027092f, 98.993042f, 97.4709854f, 100.25602f, 93.6921387f, 99.2961044f, 95.2366409f, 101.170959f,
+    77.9664917f, 85.6478653f, 83.7556076f, 88.0948105f, 82.4770584f, 88.5726013f, 85.0028687f, 88.3326187f,
+    89.5585022f, 92.2673874f, 91.0867844f, 93.456749f, 82.1384659f, 89.9786301f, 83.4209671f, 91.410965f,
+    91.1384125f, 97.9742508f, 95.3181458f, 100.503853f, 103.51757f, 102.720909f, 100.966164f, 101.552475f,
+    112.230995f, 112.612602f, 111.712997f, 113.356667f, 100.809074f, 102.609695f, 99.2804184f, 104.795258f,
+    61.8546638f, 69.7465897f, 67.269455f, 73.6956863f, 68.8162689f, 75.7299728f, 69.8829041f, 74.498848f,
+    78.1698074f, 81.2242432f, 79.6565018f, 82.9830399f, 61.4845505f, 70.5314331f, 61.8450241f, 72.079628f,
+    84.1072006f, 93.1204681f, 89.3816071f, 96.2904358f, 92.6219482f, 97.3696594f, 93.5079269f, 97.0569229f,
+    98.2394257f, 101.584274f, 99.5081863f, 103.010162f, 93.2220306f, 99.0835037f, 94.1716232f, 102.245781f,
+    64.7299881f, 72.8673248f, 70.0916443f, 75.9635696f, 71.1157837f, 77.4699249f, 72.1332245f, 77.4384842f,
+    79.2090912f, 82.3288956f, 80.3442993f, 83.6475449f, 66.8619919f, 75.6070938f, 68.0794525f, 77.7962112f,
+    93.7804947f, 100.178978f, 97.6914978f, 102.353027f, 103.740891f, 104.141739f, 102.989693f, 103.496536f,
+    112.715691f, 113.435898f, 113.075783f, 113.900841f, 105.196251f, 106.108009f, 104.709679f, 108.291f,
+    67.4188004f, 75.8015594f, 73.8196259f, 79.6723022f, 76.1975708f, 83.0043106f, 78.6239777f, 81.512291f,
+    82.6538773f, 85.676712f, 84.9767609f, 88.127739f, 72.7178268f, 81.7517014f, 74.3444824f, 82.8553543f,
+    84.4930649f, 92.7037277f, 90.0793076f, 95.7871857f, 90.6141129f, 95.9749527f, 92.8866959f, 95.5300369f,
+    96.1393967f, 99.4517136f, 97.7818832f, 100.857712f, 93.3278809f, 99.0836105f, 94.8679276f, 101.477333f,
+    74.4362488f, 83.7916565f, 80.734108f, 86.4573746f, 78.1200485f, 85.1436691f, 81.8246994f, 85.1041031f,
+    88.2903442f, 91.8014603f, 90.3835297f, 92.8964844f, 80.7200012f, 88.6713943f, 82.1996765f, 90.1101379f,
+    95.9470139f, 102.788628f, 100.112f, 105.157127f, 108.197922f, 106.686409f, 105.69207f, 105.550209f,
+    117.555267f, 117.51722f, 117.188484f, 117.983932f, 107.309845f, 107.754822f, 105.403801f, 109.682083f,
+    63.5849762f, 72.1919708f, 69.8205261f, 76.3170013f, 71.8135757f, 78.7848969f, 73.2214584f, 77.347847f,
+    80.4985046f, 82.7354584f, 82.1334152f, 85.711525f, 68.4713211f, 77.4462585f, 68.7949448f, 78.8811111f,
+    86.1620483f, 95.4464951f, 91.8830948f, 98.6388474f, 94.743515f, 99.5944748f, 96.0524979f, 99.4855423f,
+    100.094231f, 103.50444f, 101.598381f, 105.028793f, 96.4203491f, 102.137978f, 97.4595795f, 105.038269f,
+    70.9192429f, 80.2583923f, 77.0921402f, 83.2116928f, 78.0123062f, 84.2857971f, 80.0194702f, 84.7142105f,
+    85.3325195f, 88.6145706f, 86.7863007f, 89.9489975f, 77.3195648f, 85.4027863f, 78.2838211f, 87.1108017f,
+    90.2790985f, 96.3001251f, 93.9543152f, 98.1299438f, 99.4580307f, 100.631462f, 98.8316345f, 99.9687958f,
+    106.426193f, 107.262054f, 106.305206f, 107.625061f, 99.6938629f, 102.254982f, 99.6915665f, 104.027771f,
+    73.4642563f, 80.5845337f, 79.3438644f, 83.5086441f, 80.7295074f, 86.6883621f, 82.1287079f, 85.2774734f,
+    85.9718323f, 88.8059692f, 87.7072601f, 90.1999283f, 73.8383942f, 83.1270981f, 74.5762482f, 83.6013718f,
+    85.5542526f, 93.4208755f, 91.2700806f, 95.792038f, 92.5587769f, 97.7179108f, 94.3038864f, 97.3847961f,
+    96.3685837f, 99.5158386f, 97.9043198f, 100.670464f, 93.50914f, 99.6059952f, 95.3913422f, 101.379601f,
+    76.8061218f, 84.3150101f, 82.622963f, 86.7283401f, 81.4687271f, 87.3518372f, 83.4810181f, 87.0582962f,
+    88.3013153f, 90.7671814f, 89.6932373f, 91.9909134f, 80.5166397f, 88.5113373f, 81.5396423f, 89.9820786f,
+    89.6018982f, 96.2204361f, 93.689415f, 98.5815048f, 102.523216f, 101.30307f, 99.5786819f, 100.227814f,
+    110.182777f, 110.538818f, 109.830513f, 111.054863f, 99.1488571f, 100.909203f, 97.3435669f, 103.09259f,
+    59.9588623f, 67.4653244f, 64.8541794f, 71.3636703f, 66.6998444f, 73.483345f, 67.2462158f, 72.3498764f,
+    76.6717072f, 79.8612289f, 78.1844101f, 81.5281601f, 59.8689079f, 68.493042f, 59.5697174f, 70.1029282f,
+    83.6962509f, 92.4500809f, 88.5177994f, 95.573822f, 92.6675186f, 96.9698715f, 92.8702774f, 96.6356201f,
+    97.887085f, 100.719833f, 98.7639389f, 102.288841f, 92.9173813f, 98.5826797f, 93.3345947f, 101.489716f,
+    64.0168152f, 71.1769485f, 68.253334f, 74.0936584f, 68.8762665f, 74.767067f, 68.9852905f, 74.6736908f,
+    76.6301727f, 79.5900345f, 77.2228012f, 80.8371811f, 65.6900177f, 73.2236481f, 65.4145126f, 75.0500031f,
+    92.8614044f, 99.3745422f, 96.8556747f, 101.279068f, 102.644806f, 103.157326f, 101.761826f, 102.355415f,
+    111.761826f, 112.32885f, 111.825813f, 112.904495f, 104.067108f, 105.168381f, 103.668503f, 107.21299f,
+    67.5783844f, 76.0188065f, 74.1159897f, 79.9524002f, 76.3396225f, 83.3777847f, 78.7214432f, 81.6574478f,
+    83.4589615f, 86.7862091f, 86.071701f, 88.912529f, 72.5973358f, 82.0459518f, 74.0395889f, 83.047348f,
+    84.8067169f, 93.0383148f, 90.3692551f, 96.0426483f, 90.8713837f, 96.3585587f, 93.2022934f, 96.0137939f,
+    96.6609573f, 99.9096222f, 98.2103653f, 101.336311f, 93.4627533f, 99.6574249f, 94.9889755f, 101.835907f,
+    74.2581787f, 83.5932693f, 80.7830353f, 86.4893341f, 77.7459946f, 84.9003983f, 81.5238647f, 84.6114807f,
+    88.0766373f, 91.6233444f, 90.1484299f, 92.7848587f, 80.2544937f, 88.3681335f, 81.679718f, 89.9391403f,
+    95.4424973f, 102.066628f, 99.6508713f, 104.306282f, 108.772453f, 106.90654f, 105.928307f, 105.520599f,
+    116.170174f, 116.561661f, 116.146652f, 116.807915f, 106.9048f, 107.36499f, 105.052132f, 109.281929f,
+    61.3594627f, 69.6832962f, 67.1555939f, 73.918869f, 69.4383698f, 75.9252167f, 70.4834747f, 74.7683563f,
+    79.1706085f, 82.1012802f, 80.9457855f, 84.6806793f, 65.158783f, 74.0008621f, 65.3077774f, 75.5449753f,
+    86.3097458f, 95.756424f, 91.8167877f, 98.8534927f, 95.8501053f, 100.285294f, 96.7719345f, 100.000786f,
+    100.749329f, 103.955162f, 102.183372f, 105.456841f, 96.8329849f, 102.268036f, 97.6618729f, 105.222878f,
+    68.5360413f, 77.0951157f, 73.854454f, 80.1215363f, 74.7959595f, 80.8332367f, 76.5208054f, 81.1664505f,
+    82.6341324f, 85.6652679f, 83.5577469f, 87.048645f, 74.0420609f, 81.3888626f, 74.3883972f, 83.3866348f,
+    90.8962402f, 96.0385284f, 93.9945602f, 97.8332977f, 99.6984787f, 100.143387f, 98.6981201f, 99.8948746f,
+    107.156075f, 107.1008f, 106.308731f, 107.93084f, 100.838821f, 102.394287f, 100.287933f, 104.196114f,
+    75.964447f, 82.2311707f, 81.4243164f, 84.9146347f, 81.3642426f, 87.3359909f, 82.8803024f, 86.1222382f,
+    87.2986221f, 90.0088272f, 88.8267746f, 91.3455734f, 75.4179993f, 84.3499908f, 76.2444687f, 84.6984177f,
+    87.8121872f, 94.926445f, 93.0931473f, 97.1358109f, 92.6586533f, 98.9017563f, 95.3900986f, 98.7654037f,
+    97.9825287f, 100.516609f, 99.1479263f, 101.694191f, 95.6287918f, 100.922798f, 97.0410614f, 102.665955f,
+    80.2624817f, 87.3768692f, 85.9511185f, 89.6853333f, 83.3210831f, 89.7886505f, 86.2615356f, 89.5264053f,
+    91.0645218f, 93.7011795f, 92.5933151f, 94.8964615f, 83.5980453f, 91.2013245f, 84.664032f, 92.5621262f,
+    92.0727158f, 99.3142471f, 96.3739014f, 102.158012f, 105.674187f, 104.332245f, 102.69091f, 102.828262f,
+    114.235176f, 114.732597f, 114.002655f, 115.352531f, 102.596352f, 104.021896f, 100.721626f, 106.265686f,
+    61.8370972f, 69.5318451f, 67.1674347f, 73.6284256f, 68.1947632f, 75.5022888f, 69.084816f, 74.045166f,
+    78.8920746f, 82.4782944f, 80.7069855f, 84.3359528f, 61.2866364f, 70.0093842f, 61.3246346f, 71.7344589f,
+    86.2746964f, 95.5238342f, 91.1796265f, 98.9174042f, 94.9776306f, 99.7050171f, 95.4957733f, 99.5307159f,
+    101.042526f, 104.360291f, 102.470329f, 105.834969f, 95.7263031f, 101.843895f, 96.2594223f, 104.795113f,
+    66.2740326f, 74.6436386f, 71.5222015f, 77.967186f, 72.2137909f, 78.4444656f, 73.0524368f, 78.4311371f,
+    80.8212662f, 83.926796f, 81.7901001f, 85.3250885f, 68.9557419f, 77.2546387f, 69.4699631f, 79.257843f,
+    95.4512939f, 102.481255f, 99.5687943f, 104.639191f, 105.943748f, 106.591324f, 105.233101f, 105.671967f,
+    115.279297f, 115.909363f, 115.528259f, 116.314346f, 107.323509f, 108.913506f, 107.048904f, 110.695854f,
+    67.9651947f, 76.6604309f, 74.4977646f, 80.4955597f, 76.3316803f, 83.6039352f, 79.0701294f, 82.0361176f,
+    84.5818024f, 87.8595428f, 87.0040131f, 90.0501785f, 73.0289993f, 82.2083206f, 74.6710052f, 83.4229813f,
+    86.0377121f, 94.5683975f, 92.0398026f, 97.9636612f, 92.2429886f, 97.6072845f, 94.4240189f, 97.400383f,
+    98.3671036f, 101.723145f, 99.9168854f, 103.314438f, 95.0853348f, 101.084656f, 96.5733566f, 103.838173f,
+    75.1376266f, 84.6087112f, 81.6507263f, 87.5364304f, 78.5826263f, 85.9125061f, 82.4918137f, 85.6693115f,
+    89.4956818f, 93.1682816f, 91.6921692f, 94.2913818f, 81.1610718f, 89.5221939f, 82.6886139f, 90.8869019f,
+    93.685051f, 100.481873f, 97.9298859f, 102.954712f, 106.329567f, 104.304825f, 103.491684f, 103.103096f,
+    115.949402f, 115.908028f, 115.472549f, 116.473274f, 104.405724f, 105.11467f, 103.026192f, 107.114151f,
+    62.8827019f, 71.4203186f, 68.7786789f, 75.1439133f, 70.1796112f, 76.614624f, 71.5824356f, 75.4174652f,
+    80.1198502f, 83.2153091f, 81.8511353f, 85.4812698f, 66.7469711f, 75.3608017f, 67.1266708f, 76.9231949f,
+    86.1020813f, 95.2880478f, 91.7302246f, 98.8104324f, 94.3578644f, 99.1426163f, 95.7072525f, 98.9320374f,
+    100.585289f, 103.922478f, 102.05291f, 105.427109f, 96.8336334f, 102.177505f, 97.6156464f, 105.083412f,
+    69.4825363f, 78.6847839f, 75.5300293f, 81.5286484f, 75.8649673f, 82.2669296f, 78.1498871f, 82.8002014f,
+    83.4933701f, 87.006691f, 84.9954758f, 88.1363754f, 75.1899109f, 83.515831f, 76.1822662f, 85.299202f,
+    91.8670654f, 98.2642212f, 95.6766434f, 100.147697f, 101.406799f, 102.722572f, 100.761002f, 101.961151f,
+    108.519196f, 109.056244f, 108.127251f, 109.668587f, 101.795364f, 104.618767f, 101.745041f, 106.223167f,
+    76.3544922f, 83.024559f, 82.1912537f, 85.8876572f, 82.9161148f, 88.7119141f, 84.5639038f, 87.396286f,
+    87.7585144f, 90.6598587f, 89.6105347f, 92.0594025f, 75.919899f, 85.2944641f, 76.493103f, 85.4996567f,
+    87.5893707f, 95.4675827f, 93.3353729f, 97.7509308f, 92.924942f, 99.9471207f, 96.3798904f, 99.5544128f,
+    98.5701828f, 101.545334f, 100.050407f, 102.574615f, 95.7318192f, 102.075729f, 97.5646362f, 103.532722f,
+    79.2928391f, 86.8413391f, 85.2023392f, 89.2265778f, 83.6364288f, 89.7430801f, 86.0977707f, 89.206131f,
+    90.3615799f, 93.0171661f, 91.9427414f, 94.1697464f, 83.3591385f, 91.1712875f, 84.1975632f, 92.4485245f,
+    92.8001251f, 100.061516f, 96.7890701f, 102.512917f, 106.241089f, 104.689491f, 103.095772f, 103.266525f,
+    113.834084f, 114.3955f, 113.54319f, 114.689735f, 102.996613f, 104.343201f, 100.782707f, 106.293999f,
+    60.9108963f, 68.3021317f, 65.9408264f, 72.3717728f, 67.1835709f, 74.265976f, 67.8330536f, 72.8752365f,
+    77.4514389f, 80.7110901f, 78.8975677f, 82.5596085f, 61.1142311f, 69.6485291f, 60.7566719f, 71.1124649f,
+    86.0782928f, 95.1160812f, 91.1826172f, 98.0778351f, 95.320755f, 99.6935577f, 95.5753632f, 99.3553467f,
+    100.55191f, 103.638969f, 101.892471f, 104.918633f, 95.5673599f, 101.24456f, 96.1982956f, 104.091034f,
+    66.1891403f, 74.3239975f, 71.4225922f, 77.2164917f, 71.9786606f, 77.8471451f, 72.4686508f, 77.7626953f,
+    79.7012787f, 82.8880997f, 80.4923553f, 84.1689987f, 68.9572067f, 76.8547668f, 69.1833878f, 78.486618f,
+    93.7422562f, 100.378876f, 97.885437f, 102.431892f, 103.570984f, 104.18557f, 102.985184f, 103.413185f,
+    112.914764f, 113.24913f, 112.991631f, 113.953194f, 105.454216f, 106.750816f, 104.918571f, 108.509682f,
+    68.0589676f, 76.6426163f, 74.8318253f, 80.5668335f, 76.8924637f, 84.018364f, 79.4820404f, 82.302803f,
+    83.9132309f, 87.1936264f, 86.3233795f, 89.3126907f, 73.4466553f, 82.9870453f, 74.980835f, 83.858902f,
+    85.1778717f, 93.6701889f, 91.0143585f, 96.6433334f, 91.5109787f, 97.1789398f, 93.9277191f, 96.7727737f,
+    97.3301773f, 100.545128f, 98.8810425f, 101.981102f, 94.3330231f, 100.618065f, 95.8599396f, 102.728561f,
+    75.1085205f, 84.7164459f, 81.7549896f, 87.6203995f, 78.5253525f, 85.9832458f, 82.5394669f, 85.6492157f,
+    89.1419678f, 92.8143616f, 91.1976776f, 93.7120972f, 81.3991547f, 89.668251f, 82.8272858f, 91.0639343f,
+    96.4946136f, 103.624222f, 101.007011f, 105.97438f, 110.036034f, 107.698746f, 106.989288f, 106.20211f,
+    118.288406f, 118.492645f, 117.783752f, 118.527374f, 107.807106f, 108.351128f, 106.022881f, 109.874664f,
+    63.0483856f, 71.3451691f, 69.0522003f, 75.6384964f, 70.9388657f, 77.5790787f, 72.5002213f, 76.2260208f,
+    80.4779892f, 83.2250595f, 82.1289978f, 85.8839035f, 68.0199661f, 77.0438232f, 68.4263992f, 78.2001495f,
+    87.4654312f, 96.8899384f, 92.9474182f, 99.9312439f, 97.1932831f, 101.415405f, 98.1651459f, 101.02961f,
+    102.006203f, 105.238716f, 103.300438f, 106.571953f, 98.4360352f, 103.855499f, 99.2040329f, 106.444466f,
+    69.5488205f, 78.830513f, 75.8151398f, 81.6702957f, 76.4538193f, 81.9637604f, 78.5646667f, 82.5552216f,
+    83.0040436f, 86.3056412f, 84.2448273f, 87.42939f, 75.7161636f, 83.4890976f, 76.6358109f, 85.0836105f
+};
+
+alignas(64) constexpr float MODEL_R94_COMPLEMENT_VARS_X2[] = {
+    4.58382845f, 5.27157545f, 4.92836809f, 5.8372879f, 12.6050911f, 7.89267445f, 8.53923225f, 8.93541241f,
+    10.256609f, 9.91078281f, 9.43171024f, 9.66740322f, 12.5557613f, 8.33900452f, 8.15701866f, 9.36325645f,
+    18.4890614f, 14.0996428f, 16.032835f, 9.94406033f, 23.4290257f, 17.8594303f, 16.0209255f, 20.8604774f,
+    6.7641654f, 5.60902548f, 5.54961967f, 4.39313984f, 14.5129652f, 20.1522732f, 12.8570032f, 18.9153824f,
+    11.2802238f, 8.26513672f, 10.8498325f, 6.92641878f, 65.8960724f, 12.6282368f, 12.3603029f, 13.430398f,
+    7.33456469f, 6.68291903f, 5.17567062f, 5.33031511f, 12.2374926f, 11.5258379f, 8.83056259f, 8.65715981f,
+    14.5267305f, 8.98193264f, 12.1318598f, 7.08861399f, 14.8331385f, 10.9541492f, 10.4807739f, 10.7952232f,
+    4.63140392f, 3.59829497f, 4.01996803f, 3.48536491f, 12.2967825f, 12.2871151f, 10.668745f, 11.7548189f,
+    7.32154083f, 11.1814842f, 9.83307934f, 11.5668087f, 22.9390812f, 16.2945824f, 17.1151104f, 16.4220333f,
+    18.2868061f, 16.8848248f, 17.1312981f, 15.5538397f, 28.4266911f, 15.4529743f, 14.1918945f, 17.6171112f,
+    13.7407169f, 9.09522343f, 14.493619f, 11.3923588f, 5.34537745f, 4.57565737f, 6.2521925f, 5.79431581f,
+    4.34719753f, 4.96443224f, 5.85379696f, 7.19071627f, 7.39410448f, 6.92740107f, 10.81952f, 6.72547579f,
+    4.61113787f, 5.6340661f, 8.10344315f, 6.49400425f, 12.1741219f, 9.36506557f, 6.99264812f, 10.1094532f,
+    6.89972115f, 7.48570299f, 6.21891928f, 7.72409296f, 8.43670654f, 10.5242853f, 5.98431206f, 9.8362093f,
+    11.0732374f, 8.47117996f, 14.60606f, 13.3832445f, 4.24603033f, 3.68945241f, 5.06246614f, 4.02009821f,
+    7.44559336f, 7.85594177f, 9.65537643f, 12.360343f, 7.61648607f, 5.09064102f, 9.51739502f, 5.62788534f,
+    7.19937325f, 7.1293292f, 6.42865849f, 6.91975069f, 19.3753242f, 12.2359896f, 13.1670284f, 12.5594101f,
+    14.8190136f, 12.4891233f, 12.2058125f, 11.78965f, 18.470129f, 12.6611462f, 13.338913f, 13.9495411f,
+    12.2327251f, 9.85727882f, 12.4565668f, 9.19927025f, 12.1126776f, 11.0703945f, 8.2568779f, 11.923954f,
+    4.86969042f, 5.00426483f, 4.66599321f, 4.1639843f, 6.90838671f, 11.6442394f, 8.02656651f, 11.2143736f,
+    7.31997156f, 5.36808014f, 9.34939671f, 6.29474783f, 9.1136055f, 6.11188173f, 4.99869204f, 6.62659883f,
+    4.18817377f, 4.10076666f, 3.93019843f, 4.20388651f, 6.4747591f, 6.78615665f, 4.28204298f, 5.31935644f,
+    11.8184814f, 9.54901028f, 9.93969154f, 7.62060833f, 11.5800486f, 12.5146551f, 8.67247009f, 13.5322857f,
+    4.88326836f, 3.90870738f, 3.3304503f, 3.000319f, 10.1151104f, 15.8818083f, 9.34089756f, 14.6868458f,
+    7.41207409f, 9.68773746f, 8.7380228f, 9.50711918f, 25.4612179f, 17.1841717f, 19.6457424f, 17.9381695f,
+    19.2708969f, 18.0032768f, 18.5767555f, 17.67276f, 28.1448479f, 18.2938099f, 19.1910191f, 20.0074177f,
+    11.1048174f, 7.97547483f, 11.725687f, 8.38901711f, 6.20147371f, 5.69329453f, 5.6239872f, 6.72312212f,
+    4.04262114f, 4.86806107f, 5.82208633f, 7.04670095f, 6.8790307f, 6.68713188f, 9.20046234f, 6.69163752f,
+    4.31951904f, 5.41110229f, 6.92930746f, 5.76957321f, 13.9979324f, 9.91617203f, 8.18641853f, 10.1000128f,
+    6.7049613f, 7.25370741f, 6.148283f, 7.0886445f, 9.48383904f, 10.4869719f, 6.06676579f, 9.60377407f,
+    8.06951141f, 5.61912537f, 9.92525864f, 7.84272432f, 4.42251682f, 3.97560215f, 4.07323456f, 4.27252579f,
+    5.04384375f, 4.83315182f, 6.74275398f, 7.69909954f, 4.75878525f, 4.72825527f, 5.81415176f, 4.60771275f,
+    4.58382845f, 5.27157545f, 4.92836809f, 5.8372879f, 12.6050911f, 7.89267445f, 8.53923225f, 8.93541241f,
+    10.256609f, 9.91078281f, 9.43171024f, 9.66740322f, 12.5557613f, 8.33900452f, 8.15701866f, 9.36325645f,
+    18.4890614f, 14.0996428f, 16.032835f, 9.94406033f, 23.4290257f, 17.8594303f, 16.0209255f, 20.8604774f,
+    6.7641654f, 5.60902548f, 5.54961967f, 4.39313984f, 14.5129652f, 20.1522732f, 12.8570032f, 18.9153824f,
+    11.2802238f, 8.26513672f, 10.8498325f, 6.92641878f, 65.8960724f, 12.6282368f, 12.3603029f, 13.430398f,
+    7.33456469f, 6.68291903f, 5.17567062f, 5.33031511f, 12.2374926f, 11.5258379f, 8.83056259f, 8.65715981f,
+    14.5267305f, 8.98193264f, 12.1318598f, 7.08861399f, 14.8331385f, 10.9541492f, 10.4807739f, 10.7952232f,
+    4.63140392f, 3.59829497f, 4.01996803f, 3.48536491f, 12.2967825f, 12.2871151f, 10.668745f, 11.7548189f,
+    7.32154083f, 11.1814842f, 9.83307934f, 11.5668087f, 22.9390812f, 16.2945824f, 17.1151104f, 16.4220333f,
+    18.2868061f, 16.8848248f, 17.1312981f, 15.5538397f, 28.4266911f, 15.4529743f, 14.1918945f, 17.6171112f,
+    13.7407169f, 9.09522343f, 14.493619f, 11.3923588f, 5.34537745f, 4.57565737f, 6.2521925f, 5.79431581f,
+    4.34719753f, 4.96443224f, 5.85379696f, 7.19071627f, 7.39410448f, 6.92740107f, 10.81952f, 6.72547579f,
+    4.61113787f, 5.6340661f, 8.10344315f, 6.49400425f, 12.1741219f, 9.36506557f, 6.99264812f, 10.1094532f,
+    6.89972115f, 7.48570299f, 6.21891928f, 7.72409296f, 8.43670654f, 10.5242853f, 5.98431206f, 9.8362093f,
+    11.0732374f, 8.47117996f, 14.60606f, 13.3832445f, 4.24603033f, 3.68945241f, 5.06246614f, 4.02009821f,
+    7.44559336f, 7.85594177f, 9.65537643f, 12.360343f, 7.61648607f, 5.09064102f, 9.51739502f, 5.62788534f,
+    7.19937325f, 7.1293292f, 6.42865849f, 6.91975069f, 19.3753242f, 12.2359896f, 13.1670284f, 12.5594101f,
+    14.8190136f, 12.4891233f, 12.2058125f, 11.78965f, 18.470129f, 12.6611462f, 13.338913f, 13.9495411f,
+    12.2327251f, 9.85727882f, 12.4565668f, 9.19927025f, 12.1126776f, 11.0703945f, 8.2568779f, 11.923954f,
+    4.86969042f, 5.00426483f, 4.66599321f, 4.1639843f, 6.90838671f, 11.6442394f, 8.02656651f, 11.2143736f,
+    7.31997156f, 5.36808014f, 9.34939671f, 6.29474783f, 9.1136055f, 6.11188173f, 4.99869204f, 6.62659883f,
+    4.18817377f, 4.10076666f, 3.93019843f, 4.20388651f, 6.4747591f, 6.78615665f, 4.28204298f, 5.31935644f,
+    11.8184814f, 9.54901028f, 9.93969154f, 7.62060833f, 11.5800486f, 12.5146551f, 8.67247009f, 13.5322857f,
+    4.88326836f, 3.90870738f, 3.3304503f, 3.000319f, 10.1151104f, 15.8818083f, 9.34089756f, 14.6868458f,
+    7.41207409f, 9.68773746f, 8.7380228f, 9.50711918f, 25.4612179f, 17.1841717f, 19.6457424f, 17.9381695f,
+    19.2708969f, 18.0032768f, 18.5767555f, 17.67276f, 28.1448479f, 18.2938099f, 19.1910191f, 20.0074177f,
+    11.1048174f, 7.97547483f, 11.725687f, 8.38901711f, 6.20147371f, 5.69329453f, 5.6239872f, 6.72312212f,
+    4.04262114f, 4.86806107f, 5.82208633f, 7.04670095f, 6.8790307f, 6.68713188f, 9.20046234f, 6.69163752f,
+    4.31951904f, 5.41110229f, 6.92930746f, 5.76957321f, 13.9979324f, 9.91617203f, 8.18641853f, 10.1000128f,
+    6.7049613f, 7.25370741f, 6.148283f, 7.0886445f, 9.48383904f, 10.4869719f, 6.06676579f, 9.60377407f,
+    8.06951141f, 5.61912537f, 9.92525864f, 7.84272432f, 4.42251682f, 3.97560215f, 4.07323456f, 4.27252579f,
+    5.04384375f, 4.83315182f, 6.74275398f, 7.69909954f, 4.75878525f, 4.72825527f, 5.81415176f, 4.60771275f,
+    4.58382845f, 5.27157545f, 4.92836809f, 5.8372879f, 12.6050911f, 7.89267445f, 8.53923225f, 8.93541241f,
+    10.256609f, 9.91078281f, 9.43171024f, 9.66740322f, 12.5557613f, 8.33900452f, 8.15701866f, 9.36325645f,
+    18.4890614f, 14.0996428f, 16.032835f, 9.94406033f, 23.4290257f, 17.8594303f, 16.0209255f, 20.8604774f,
+    6.7641654f, 5.60902548f, 5.54961967f, 4.39313984f, 14.5129652f, 20.1522732f, 12.8570032f, 18.9153824f,
+    11.2802238f, 8.26513672f, 10.8498325f, 6.92641878f, 65.8960724f, 12.6282368f, 12.3603029f, 13.430398f,
+    7.33456469f, 6.68291903f, 5.17567062f, 5.33031511f, 12.2374926f, 11.5258379f, 8.83056259f, 8.65715981f,
+    14.5267305f, 8.98193264f, 12.1318598f, 7.08861399f, 14.8331385f, 10.9541492f, 10.4807739f, 10.7952232f,
+    4.63140392f, 3.59829497f, 4.01996803f, 3.48536491f, 12.2967825f, 12.2871151f, 10.668745f, 11.7548189f,
+    7.32154083f, 11.1814842f, 9.83307934f, 11.5668087f, 22.9390812f, 16.2945824f, 17.1151104f, 16.4220333f,
+    18.2868061f, 16.8848248f, 17.1312981f, 15.5538397f, 28.4266911f, 15.4529743f, 14.1918945f, 17.6171112f,
+    13.7407169f, 9.09522343f, 14.493619f, 11.3923588f, 5.34537745f, 4.57565737f, 6.2521925f, 5.79431581f,
+    4.34719753f, 4.96443224f, 5.85379696f, 7.19071627f, 7.39410448f, 6.92740107f, 10.81952f, 6.72547579f,
+    4.61113787f, 5.6340661f, 8.10344315f, 6.49400425f, 12.1741219f, 9.36506557f, 6.99264812f, 10.1094532f,
+    6.89972115f, 7.48570299f, 6.21891928f, 7.72409296f, 8.43670654f, 10.5242853f, 5.98431206f, 9.8362093f,
+    11.0732374f, 8.47117996f, 14.60606f, 13.3832445f, 4.24603033f, 3.68945241f, 5.06246614f, 4.02009821f,
+    7.44559336f, 7.85594177f, 9.65537643f, 12.360343f, 7.61648607f, 5.09064102f, 9.51739502f, 5.62788534f,
+    7.19937325f, 7.1293292f, 6.42865849f, 6.91975069f, 19.3753242f, 12.2359896f, 13.1670284f, 12.5594101f,
+    14.8190136f, 12.4891233f, 12.2058125f, 11.78965f, 18.470129f, 12.6611462f, 13.338913f, 13.9495411f,
+    12.2327251f, 9.85727882f, 12.4565668f, 9.19927025f, 12.1126776f, 11.0703945f, 8.2568779f, 11.923954f,
+    4.86969042f, 5.00426483f, 4.66599321f, 4.1639843f, 6.90838671f, 11.6442394f, 8.02656651f, 11.2143736f,
+    7.31997156f, 5.36808014f, 9.34939671f, 6.29474783f, 9.1136055f, 6.11188173f, 4.99869204f, 6.62659883f,
+    4.18817377f, 4.10076666f, 3.93019843f, 4.20388651f, 6.4747591f, 6.78615665f, 4.28204298f, 5.31935644f,
+    11.8184814f, 9.54901028f, 9.93969154f, 7.62060833f, 11.5800486f, 12.5146551f, 8.67247009f, 13.5322857f,
+    4.88326836f, 3.90870738f, 3.3304503f, 3.000319f, 10.1151104f, 15.8818083f, 9.34089756f, 14.6868458f,
+    7.41207409f, 9.68773746f, 8.7380228f, 9.50711918f, 25.4612179f, 17.1841717f, 19.6457424f, 17.9381695f,
+    19.2708969f, 18.0032768f, 18.5767555f, 17.67276f, 28.1448479f, 18.2938099f, 19.1910191f, 20.0074177f,
+    11.1048174f, 7.97547483f, 11.725687f, 8.38901711f, 6.20147371f, 5.69329453f, 5.6239872f, 6.72312212f,
+    4.04262114f, 4.86806107f, 5.82208633f, 7.04670095f, 6.8790307f, 6.68713188f, 9.20046234f, 6.69163752f,
+    4.31951904f, 5.41110229f, 6.92930746f, 5.76957321f, 13.9979324f, 9.91617203f, 8.18641853f, 10.1000128f,
+    6.7049613f, 7.25370741f, 6.148283f, 7.0886445f, 9.48383904f, 10.4869719f, 6.06676579f, 9.60377407f,
+    8.06951141f, 5.61912537f, 9.92525864f, 7.84272432f, 4.42251682f, 3.97560215f, 4.07323456f, 4.27252579f,
+    5.04384375f, 4.83315182f, 6.74275398f, 7.69909954f, 4.75878525f, 4.72825527f, 5.81415176f, 4.60771275f,
+    4.58382845f, 5.27157545f, 4.92836809f, 5.8372879f, 12.6050911f, 7.89267445f, 8.53923225f, 8.93541241f,
+    10.256609f, 9.91078281f, 9.43171024f, 9.66740322f, 12.5557613f, 8.33900452f, 8.15701866f, 9.36325645f,
+    18.4890614f, 14.0996428f, 16.032835f, 9.94406033f, 23.4290257f, 17.8594303f, 16.0209255f, 20.8604774f,
+    6.7641654f, 5.60902548f, 5.54961967f, 4.39313984f, 14.5129652f, 20.1522732f, 12.8570032f, 18.9153824f,
+    11.2802238f, 8.26513672f, 10.8498325f, 6.92641878f, 65.8960724f, 12.6282368f, 12.3603029f, 13.430398f,
+    7.33456469f, 6.68291903f, 5.17567062f, 5.33031511f, 12.2374926f, 11.5258379f, 8.83056259f, 8.65715981f,
+    14.5267305f, 8.98193264f, 12.1318598f, 7.08861399f, 14.8331385f, 10.9541492f, 10.4807739f, 10.7952232f,
+    4.63140392f, 3.59829497f, 4.01996803f, 3.48536491f, 12.2967825f, 12.2871151f, 10.668745f, 11.7548189f,
+    7.32154083f, 11.1814842f, 9.83307934f, 11.5668087f, 22.9390812f, 16.2945824f, 17.1151104f, 16.4220333f,
+    18.2868061f, 16.8848248f, 17.1312981f, 15.5538397f, 28.4266911f, 15.4529743f, 14.1918945f, 17.6171112f,
+    13.7407169f, 9.09522343f, 14.493619f, 11.3923588f, 5.34537745f, 4.57565737f, 6.2521925f, 5.79431581f,
+    4.34719753f, 4.96443224f, 5.85379696f, 7.19071627f, 7.39410448f, 6.92740107f, 10.81952f, 6.72547579f,
+    4.61113787f, 5.6340661f, 8.10344315f, 6.49400425f, 12.1741219f, 9.36506557f, 6.99264812f, 10.1094532f,
+    6.89972115f, 7.48570299f, 6.21891928f, 7.72409296f, 8.43670654f, 10.5242853f, 5.98431206f, 9.8362093f,
+    11.0732374f, 8.47117996f, 14.60606f, 13.3832445f, 4.24603033f, 3.68945241f, 5.06246614f, 4.02009821f,
+    7.44559336f, 7.85594177f, 9.65537643f, 12.360343f, 7.61648607f, 5.09064102f, 9.51739502f, 5.62788534f,
+    7.19937325f, 7.1293292f, 6.42865849f, 6.91975069f, 19.3753242f, 12.2359896f, 13.1670284f, 12.5594101f,
+    14.8190136f, 12.4891233f, 12.2058125f, 11.78965f, 18.470129f, 12.6611462f, 13.338913f, 13.9495411f,
+    12.2327251f, 9.85727882f, 12.4565668f, 9.19927025f, 12.1126776f, 11.0703945f, 8.2568779f, 11.923954f,
+    4.86969042f, 5.00426483f, 4.66599321f, 4.1639843f, 6.90838671f, 11.6442394f, 8.02656651f, 11.2143736f,
+    7.31997156f, 5.36808014f, 9.34939671f, 6.29474783f, 9.1136055f, 6.11188173f, 4.99869204f, 6.62659883f,
+    4.18817377f, 4.10076666f, 3.93019843f, 4.20388651f, 6.4747591f, 6.78615665f, 4.28204298f, 5.31935644f,
+    11.8184814f, 9.54901028f, 9.93969154f, 7.62060833f, 11.5800486f, 12.5146551f, 8.67247009f, 13.5322857f,
+    4.88326836f, 3.90870738f, 3.3304503f, 3.000319f, 10.1151104f, 15.8818083f, 9.34089756f, 14.6868458f,
+    7.41207409f, 9.68773746f, 8.7380228f, 9.50711918f, 25.4612179f, 17.1841717f, 19.6457424f, 17.9381695f,
+    19.2708969f, 18.0032768f, 18.5767555f, 17.67276f, 28.1448479f, 18.2938099f, 19.1910191f, 20.0074177f,
+    11.1048174f, 7.97547483f, 11.725687f, 8.38901711f, 6.20147371f, 5.69329453f, 5.6239872f, 6.72312212f,
+    4.04262114f, 4.86806107f, 5.82208633f, 7.04670095f, 6.8790307f, 6.68713188f, 9.20046234f, 6.69163752f,
+    4.31951904f, 5.41110229f, 6.92930746f, 5.76957321f, 13.9979324f, 9.91617203f, 8.18641853f, 10.1000128f,
+    6.7049613f, 7.25370741f, 6.148283f, 7.0886445f, 9.48383904f, 10.4869719f, 6.06676579f, 9.60377407f,
+    8.06951141f, 5.61912537f, 9.92525864f, 7.84272432f, 4.42251682f, 3.97560215f, 4.07323456f, 4.27252579f,
+    5.04384375f, 4.83315182f, 6.74275398f, 7.69909954f, 4.75878525f, 4.72825527f, 5.81415176f, 4.60771275f
+};
+
+alignas(64) constexpr float MODEL_R94_COMPLEMENT_LOGNORM_DENOMS[] = {
+    1.33363223f, 1.40352952f, 1.36986887f, 1.45449805f, 1.83941531f, 1.60533249f, 1.64470053f, 1.66737604f,
+    1.7363261f, 1.71917665f, 1.69440365f, 1.70674479f, 1.8374548f, 1.63283682f, 1.62180436f, 1.69076157f,
+    2.0309546f, 1.89543962f, 1.95968437f, 1.72085261f, 2.14935279f, 2.01363087f, 1.9593128f, 2.0912931f,
+    1.52818441f, 1.43455338f, 1.42922962f, 1.31238699f, 1.90988612f, 2.07402349f, 1.84930933f, 2.04235268f,
+    1.78389049f, 1.62838805f, 1.76443982f, 1.54003644f, 2.66640425f, 1.84033263f, 1.82960987f, 1.87112522f,
+    1.56866395f, 1.52214241f, 1.39434946f, 1.40907013f, 1.82461715f, 1.79466057f, 1.66147435f, 1.65155828f,
+    1.91036022f, 1.66997254f, 1.82028246f, 1.55160987f, 1.92079687f, 1.76922405f, 1.74713624f, 1.76191676f,
+    1.33879495f, 1.21259499f, 1.26800191f, 1.19665134f, 1.82703376f, 1.82664049f, 1.75602412f, 1.80449653f,
+    1.56777537f, 1.77949452f, 1.71524107f, 1.79643476f, 2.13878608f, 1.96778131f, 1.99234581f, 1.97167695f,
+    2.02545476f, 1.98557258f, 1.99281847f, 1.94451869f, 2.24602914f, 1.9412657f, 1.89870048f, 2.00680017f,
+    1.88254666f, 1.67623961f, 1.90921915f, 1.78883636f, 1.41048098f, 1.33274019f, 1.48883104f, 1.45080364f,
+    1.30713069f, 1.37351441f, 1.45591021f, 1.55876029f, 1.57270646f, 1.54010725f, 1.7630409f, 1.52531624f,
+    1.33660221f, 1.43678069f, 1.61850941f, 1.50780463f, 1.82202125f, 1.69085813f, 1.54479456f, 1.72910047f,
+    1.53810549f, 1.57886243f, 1.48616302f, 1.59453714f, 1.63866091f, 1.74920774f, 1.46693563f, 1.7154001f,
+    1.77463055f, 1.64069986f, 1.9130832f, 1.86936665f, 1.29535723f, 1.22510397f, 1.38329184f, 1.26801813f,
+    1.57617617f, 1.60300004f, 1.7061224f, 1.82961154f, 1.58752251f, 1.38606679f, 1.6989255f, 1.43623185f,
+    1.55936193f, 1.55447352f, 1.50274789f, 1.53955483f, 2.05436516f, 1.82455575f, 1.86122286f, 1.83759999f,
+    1.92032051f, 1.83479404f, 1.8233211f, 1.80597591f, 2.03044224f, 1.84163392f, 1.86770773f, 1.8900882f,
+    1.82442236f, 1.71647f, 1.83348894f, 1.68192697f, 1.81949127f, 1.77450216f, 1.6278882f, 1.81163955f,
+    1.36388016f, 1.37751019f, 1.34251535f, 1.28560114f, 1.53873301f, 1.79977071f, 1.61374342f, 1.78096306f,
+    1.5676682f, 1.41260016f, 1.6900208f, 1.49222279f, 1.67724919f, 1.47748232f, 1.37695312f, 1.51791084f,
+    1.28849733f, 1.27795196f, 1.25670993f, 1.29036963f, 1.5063206f, 1.52980733f, 1.2995801f, 1.40804112f,
+    1.80719721f, 1.7005837f, 1.72063291f, 1.58779299f, 1.79700673f, 1.83581507f, 1.65244174f, 1.87490416f,
+    1.36527228f, 1.25396836f, 1.17391872f, 1.12172425f, 1.72938013f, 1.95495212f, 1.68956614f, 1.9158411f,
+    1.57392013f, 1.70779538f, 1.65620697f, 1.69838536f, 2.19094324f, 1.99435925f, 2.06129527f, 2.01583028f,
+    2.05166292f, 2.01764178f, 2.03332043f, 2.00837708f, 2.24104714f, 2.02564621f, 2.04958606f, 2.07041645f,
+    1.7760545f, 1.61055052f, 1.80325592f, 1.63582659f, 1.48475838f, 1.44200945f, 1.43588543f, 1.52514124f,
+    1.27081156f, 1.36371279f, 1.45319426f, 1.54864478f, 1.53660381f, 1.52245748f, 1.68199182f, 1.52279425f,
+    1.30393696f, 1.41659141f, 1.54024494f, 1.44866395f, 1.89181972f, 1.71944845f, 1.62360322f, 1.72863328f,
+    1.52378881f, 1.56312132f, 1.48045135f, 1.55161202f, 1.69715953f, 1.74743176f, 1.47377777f, 1.70344305f,
+    1.61641145f, 1.43545294f, 1.71990633f, 1.60215807f, 1.31571937f, 1.26245308f, 1.2745837f, 1.29846752f,
+    1.3814491f, 1.36011434f, 1.52659917f, 1.59291661f, 1.3523612f, 1.34914303f, 1.45251238f, 1.33623075f,
+    1.33363223f, 1.40352952f, 1.36986887f, 1.45449805f, 1.83941531f, 1.60533249f, 1.64470053f, 1.66737604f,
+    1.7363261f, 1.71917665f, 1.69440365f, 1.70674479f, 1.8374548f, 1.63283682f, 1.62180436f, 1.69076157f,
+    2.0309546f, 1.89543962f, 1.95968437f, 1.72085261f, 2.14935279f, 2.01363087f, 1.9593128f, 2.0912931f,
+    1.52818441f, 1.43455338f, 1.42922962f, 1.31238699f, 1.90988612f, 2.07402349f, 1.84930933f, 2.04235268f,
+    1.78389049f, 1.62838805f, 1.76443982f, 1.54003644f, 2.66640425f, 1.84033263f, 1.82960987f, 1.87112522f,
+    1.56866395f, 1.52214241f, 1.39434946f, 1.40907013f, 1.82461715f, 1.79466057f, 1.66147435f, 1.65155828f,
+    1.91036022f, 1.66997254f, 1.82028246f, 1.55160987f, 1.92079687f, 1.76922405f, 1.74713624f, 1.76191676f,
+    1.33879495f, 1.21259499f, 1.26800191f, 1.19665134f, 1.82703376f, 1.82664049f, 1.75602412f, 1.80449653f,
+    1.56777537f, 1.77949452f, 1.71524107f, 1.79643476f, 2.13878608f, 1.96778131f, 1.99234581f, 1.97167695f,
+    2.02545476f, 1.98557258f, 1.99281847f, 1.94451869f, 2.24602914f, 1.9412657f, 1.89870048f, 2.00680017f,
+    1.88254666f, 1.67623961f, 1.90921915f, 1.78883636f, 1.41048098f, 1.33274019f, 1.48883104f, 1.45080364f,
+    1.30713069f, 1.37351441f, 1.45591021f, 1.55876029f, 1.57270646f, 1.54010725f, 1.7630409f, 1.52531624f,
+    1.33660221f, 1.43678069f, 1.61850941f, 1.50780463f, 1.82202125f, 1.69085813f, 1.54479456f, 1.72910047f,
+    1.53810549f, 1.57886243f, 1.48616302f, 1.59453714f, 1.63866091f, 1.74920774f, 1.46693563f, 1.7154001f,
+    1.77463055f, 1.64069986f, 1.9130832f, 1.86936665f, 1.29535723f, 1.22510397f, 1.38329184f, 1.26801813f,
+    1.57617617f, 1.60300004f, 1.7061224f, 1.82961154f, 1.58752251f, 1.38606679f, 1.6989255f, 1.43623185f,
+    1.55936193f, 1.55447352f, 1.50274789f, 1.53955483f, 2.05436516f, 1.82455575f, 1.86122286f, 1.83759999f,
+    1.92032051f, 1.83479404f, 1.8233211f, 1.80597591f, 2.03044224f, 1.84163392f, 1.86770773f, 1.8900882f,
+    1.82442236f, 1.71647f, 1.83348894f, 1.68192697f, 1.81949127f, 1.77450216f, 1.6278882f, 1.81163955f,
+    1.36388016f, 1.37751019f, 1.34251535f, 1.28560114f, 1.53873301f, 1.79977071f, 1.61374342f, 1.78096306f,
+    1.5676682f, 1.41260016f, 1.6900208f, 1.49222279f, 1.67724919f, 1.47748232f, 1.37695312f, 1.51791084f,
+    1.28849733f, 1.27795196f, 1.25670993f, 1.29036963f, 1.5063206f, 1.52980733f, 1.2995801f, 1.40804112f,
+    1.80719721f, 1.7005837f, 1.72063291f, 1.58779299f, 1.79700673f, 1.83581507f, 1.65244174f, 1.87490416f,
+    1.36527228f, 1.25396836f, 1.17391872f, 1.12172425f, 1.72938013f, 1.95495212f, 1.68956614f, 1.9158411f,
+    1.57392013f, 1.70779538f, 1.65620697f, 1.69838536f, 2.19094324f, 1.99435925f, 2.06129527f, 2.01583028f,
+    2.05166292f, 2.01764178f, 2.03332043f, 2.00837708f, 2.24104714f, 2.02564621f, 2.04958606f, 2.07041645f,
+    1.7760545f, 1.61055052f, 1.80325592f, 1.63582659f, 1.48475838f, 1.44200945f, 1.43588543f, 1.52514124f,
+    1.27081156f, 1.36371279f, 1.45319426f, 1.54864478f, 1.53660381f, 1.52245748f, 1.68199182f, 1.52279425f,
+    1.30393696f, 1.41659141f, 1.54024494f, 1.44866395f, 1.89181972f, 1.71944845f, 1.62360322f, 1.72863328f,
+    1.52378881f, 1.56312132f, 1.48045135f, 1.55161202f, 1.69715953f, 1.74743176f, 1.47377777f, 1.70344305f,
+    1.61641145f, 1.43545294f, 1.71990633f, 1.60215807f, 1.31571937f, 1.26245308f, 1.2745837f, 1.29846752f,
+    1.3814491f, 1.36011434f, 1.52659917f, 1.59291661f, 1.3523612f, 1.34914303f, 1.45251238f, 1.33623075f,
+    1.33363223f, 1.40352952f, 1.36986887f, 1.45449805f, 1.83941531f, 1.60533249f, 1.64470053f, 1.66737604f,
+    1.7363261f, 1.71917665f, 1.69440365f, 1.70674479f, 1.8374548f, 1.63283682f, 1.62180436f, 1.69076157f,
+    2.0309546f, 1.89543962f, 1.95968437f, 1.72085261f, 2.14935279f, 2.01363087f, 1.9593128f, 2.0912931f,
+    1.52818441f, 1.43455338f, 1.42922962f, 1.31238699f, 1.90988612f, 2.07402349f, 1.84930933f, 2.04235268f,
+    1.78389049f, 1.62838805f, 1.76443982f, 1.54003644f, 2.66640425f, 1.84033263f, 1.82960987f, 1.87112522f,
+    1.56866395f, 1.52214241f, 1.39434946f, 1.40907013f, 1.82461715f, 1.79466057f, 1.66147435f, 1.65155828f,
+    1.91036022f, 1.66997254f, 1.82028246f, 1.55160987f, 1.92079687f, 1.76922405f, 1.74713624f, 1.76191676f,
+    1.33879495f, 1.21259499f, 1.26800191f, 1.19665134f, 1.82703376f, 1.82664049f, 1.75602412f, 1.80449653f,
+    1.56777537f, 1.77949452f, 1.71524107f, 1.79643476f, 2.13878608f, 1.96778131f, 1.99234581f, 1.97167695f,
+    2.02545476f, 1.98557258f, 1.99281847f, 1.94451869f, 2.24602914f, 1.9412657f, 1.89870048f, 2.00680017f,
+    1.88254666f, 1.67623961f, 1.90921915f, 1.78883636f, 1.41048098f, 1.33274019f, 1.48883104f, 1.45080364f,
+    1.30713069f, 1.37351441f, 1.45591021f, 1.55876029f, 1.57270646f, 1.54010725f, 1.7630409f, 1.52531624f,
+    1.33660221f, 1.43678069f, 1.61850941f, 1.50780463f, 1.82202125f, 1.69085813f, 1.54479456f, 1.72910047f,
+    1.53810549f, 1.57886243f, 1.48616302f, 1.59453714f, 1.63866091f, 1.74920774f, 1.46693563f, 1.7154001f,
+    1.77463055f, 1.64069986f, 1.9130832f, 1.86936665f, 1.29535723f, 1.22510397f, 1.38329184f, 1.26801813f,
+    1.57617617f, 1.60300004f, 1.7061224f, 1.82961154f, 1.58752251f, 1.38606679f, 1.6989255f, 1.43623185f,
+    1.55936193f, 1.55447352f, 1.50274789f, 1.53955483f, 2.05436516f, 1.82455575f, 1.86122286f, 1.83759999f,
+    1.92032051f, 1.83479404f, 1.8233211f, 1.80597591f, 2.03044224f, 1.84163392f, 1.86770773f, 1.8900882f,
+    1.82442236f, 1.71647f, 1.83348894f, 1.68192697f, 1.81949127f, 1.77450216f, 1.6278882f, 1.81163955f,
+    1.36388016f, 1.37751019f, 1.34251535f, 1.28560114f, 1.53873301f, 1.79977071f, 1.61374342f, 1.78096306f,
+    1.5676682f, 1.41260016f, 1.6900208f, 1.49222279f, 1.67724919f, 1.47748232f, 1.37695312f, 1.51791084f,
+    1.28849733f, 1.27795196f, 1.25670993f, 1.29036963f, 1.5063206f, 1.52980733f, 1.2995801f, 1.40804112f,
+    1.80719721f, 1.7005837f, 1.72063291f, 1.58779299f, 1.79700673f, 1.83581507f, 1.65244174f, 1.87490416f,
+    1.36527228f, 1.25396836f, 1.17391872f, 1.12172425f, 1.72938013f, 1.95495212f, 1.68956614f, 1.9158411f,
+    1.57392013f, 1.70779538f, 1.65620697f, 1.69838536f, 2.19094324f, 1.99435925f, 2.06129527f, 2.01583028f,
+    2.05166292f, 2.01764178f, 2.03332043f, 2.00837708f, 2.24104714f, 2.02564621f, 2.04958606f, 2.07041645f,
+    1.7760545f, 1.61055052f, 1.80325592f, 1.63582659f, 1.48475838f, 1.44200945f, 1.43588543f, 1.52514124f,
+    1.27081156f, 1.36371279f, 1.45319426f, 1.54864478f, 1.53660381f, 1.52245748f, 1.68199182f, 1.52279425f,
+    1.30393696f, 1.41659141f, 1.54024494f, 1.44866395f, 1.89181972f, 1.71944845f, 1.62360322f, 1.72863328f,
+    1.52378881f, 1.56312132f, 1.48045135f, 1.55161202f, 1.69715953f, 1.74743176f, 1.47377777f, 1.70344305f,
+    1.61641145f, 1.43545294f, 1.71990633f, 1.60215807f, 1.31571937f, 1.26245308f, 1.2745837f, 1.29846752f,
+    1.3814491f, 1.36011434f, 1.52659917f, 1.59291661f, 1.3523612f, 1.34914303f, 1.45251238f, 1.33623075f,
+    1.33363223f, 1.40352952f, 1.36986887f, 1.45449805f, 1.83941531f, 1.60533249f, 1.64470053f, 1.66737604f,
+    1.7363261f, 1.71917665f, 1.69440365f, 1.70674479f, 1.8374548f, 1.63283682f, 1.62180436f, 1.69076157f,
+    2.0309546f, 1.89543962f, 1.95968437f, 1.72085261f, 2.14935279f, 2.01363087f, 1.9593128f, 2.0912931f,
+    1.52818441f, 1.43455338f, 1.42922962f, 1.31238699f, 1.90988612f, 2.07402349f, 1.84930933f, 2.04235268f,
+    1.78389049f, 1.62838805f, 1.76443982f, 1.54003644f, 2.66640425f, 1.84033263f, 1.82960987f, 1.87112522f,
+    1.56866395f, 1.52214241f, 1.39434946f, 1.40907013f, 1.82461715f, 1.79466057f, 1.66147435f, 1.65155828f,
+    1.91036022f, 1.66997254f, 1.82028246f, 1.55160987f, 1.92079687f, 1.76922405f, 1.74713624f, 1.76191676f,
+    1.33879495f, 1.21259499f, 1.26800191f, 1.19665134f, 1.82703376f, 1.82664049f, 1.75602412f, 1.80449653f,
+    1.56777537f, 1.77949452f, 1.71524107f, 1.79643476f, 2.13878608f, 1.96778131f, 1.99234581f, 1.97167695f,
+    2.02545476f, 1.98557258f, 1.99281847f, 1.94451869f, 2.24602914f, 1.9412657f, 1.89870048f, 2.00680017f,
+    1.88254666f, 1.67623961f, 1.90921915f, 1.78883636f, 1.41048098f, 1.33274019f, 1.48883104f, 1.45080364f,
+    1.30713069f, 1.37351441f, 1.45591021f, 1.55876029f, 1.57270646f, 1.54010725f, 1.7630409f, 1.52531624f,
+    1.33660221f, 1.43678069f, 1.61850941f, 1.50780463f, 1.82202125f, 1.69085813f, 1.54479456f, 1.72910047f,
+    1.53810549f, 1.57886243f, 1.48616302f, 1.59453714f, 1.63866091f, 1.74920774f, 1.46693563f, 1.7154001f,
+    1.77463055f, 1.64069986f, 1.9130832f, 1.86936665f, 1.29535723f, 1.22510397f, 1.38329184f, 1.26801813f,
+    1.57617617f, 1.60300004f, 1.7061224f, 1.82961154f, 1.58752251f, 1.38606679f, 1.6989255f, 1.43623185f,
+    1.55936193f, 1.55447352f, 1.50274789f, 1.53955483f, 2.05436516f, 1.82455575f, 1.86122286f, 1.83759999f,
+    1.92032051f, 1.83479404f, 1.8233211f, 1.80597591f, 2.03044224f, 1.84163392f, 1.86770773f, 1.8900882f,
+    1.82442236f, 1.71647f, 1.83348894f, 1.68192697f, 1.81949127f, 1.77450216f, 1.6278882f, 1.81163955f,
+    1.36388016f, 1.37751019f, 1.34251535f, 1.28560114f, 1.53873301f, 1.79977071f, 1.61374342f, 1.78096306f,
+    1.5676682f, 1.41260016f, 1.6900208f, 1.49222279f, 1.67724919f, 1.47748232f, 1.37695312f, 1.51791084f,
+    1.28849733f, 1.27795196f, 1.25670993f, 1.29036963f, 1.5063206f, 1.52980733f, 1.2995801f, 1.40804112f,
+    1.80719721f, 1.7005837f, 1.72063291f, 1.58779299f, 1.79700673f, 1.83581507f, 1.65244174f, 1.87490416f,
+    1.36527228f, 1.25396836f, 1.17391872f, 1.12172425f, 1.72938013f, 1.95495212f, 1.68956614f, 1.9158411f,
+    1.57392013f, 1.70779538f, 1.65620697f, 1.69838536f, 2.19094324f, 1.99435925f, 2.06129527f, 2.01583028f,
+    2.05166292f, 2.01764178f, 2.03332043f, 2.00837708f, 2.24104714f, 2.02564621f, 2.04958606f, 2.07041645f,
+    1.7760545f, 1.61055052f, 1.80325592f, 1.63582659f, 1.48475838f, 1.44200945f, 1.43588543f, 1.52514124f,
+    1.27081156f, 1.36371279f, 1.45319426f, 1.54864478f, 1.53660381f, 1.52245748f, 1.68199182f, 1.52279425f,
+    1.30393696f, 1.41659141f, 1.54024494f, 1.44866395f, 1.89181972f, 1.71944845f, 1.62360322f, 1.72863328f,
+    1.52378881f, 1.56312132f, 1.48045135f, 1.55161202f, 1.69715953f, 1.74743176f, 1.47377777f, 1.70344305f,
+    1.61641145f, 1.43545294f, 1.71990633f, 1.60215807f, 1.31571937f, 1.26245308f, 1.2745837f, 1.29846752f,
+    1.3814491f, 1.36011434f, 1.52659917f, 1.59291661f, 1.3523612f, 1.34914303f, 1.45251238f, 1.33623075f
+};
+
+alignas(64) constexpr float MODEL_R94_COMPLEMENT_SORTED_MEANS[] = {
+    59.5697174f, 59.8689079f, 59.9588623f, 60.7566719f, 60.9108963f, 61.1142311f, 61.2866364f, 61.3246346f,
+    61.3594627f, 61.4845505f, 61.8370972f, 61.8450241f, 61.8546638f, 62.8827019f, 63.0483856f, 63.5849762f,
+    64.0168152f, 64.7299881f, 64.8541794f, 65.158783f, 65.3077774f, 65.4145126f, 65.6900177f, 65.9408264f,
+    66.1891403f, 66.2740326f, 66.6998444f, 66.7469711f, 66.8619919f, 67.1266708f, 67.1555939f, 67.1674347f,
+    67.1835709f, 67.2462158f, 67.269455f, 67.4188004f, 67.4653244f, 67.5783844f, 67.8330536f, 67.9651947f,
+    68.0199661f, 68.0589676f, 68.0794525f, 68.1947632f, 68.253334f, 68.3021317f, 68.4263992f, 68.4713211f,
+    68.493042f, 68.5360413f, 68.7786789f, 68.7949448f, 68.8162689f, 68.8762665f, 68.9557419f, 68.9572067f,
+    68.9852905f, 69.0522003f, 69.084816f, 69.1833878f, 69.4383698f, 69.4699631f, 69.4825363f, 69.5318451f,
+    69.5488205f, 69.6485291f, 69.6832962f, 69.7465897f, 69.8205261f, 69.8829041f, 70.0093842f, 70.0916443f,
+    70.1029282f, 70.1796112f, 70.4834747f, 70.5314331f, 70.9192429f, 70.9388657f, 71.1124649f, 71.1157837f,
+    71.1769485f, 71.3451691f, 71.3636703f, 71.4203186f, 71.4225922f, 71.5222015f, 71.5824356f, 71.7344589f,
+    71.8135757f, 71.9786606f, 72.079628f, 72.1332245f, 72.1919708f, 72.2137909f, 72.3498764f, 72.3717728f,
+    72.4686508f, 72.5002213f, 72.5973358f, 72.7178268f, 72.8673248f, 72.8752365f, 73.0289993f, 73.0524368f,
+    73.2214584f, 73.2236481f, 73.3409653f, 73.4466553f, 73.4642563f, 73.483345f, 73.6284256f, 73.6956863f,
+    73.8196259f, 73.8383942f, 73.854454f, 73.918869f, 74.0008621f, 74.0395889f, 74.0420609f, 74.045166f,
+    74.0936584f, 74.1159897f, 74.2581787f, 74.265976f, 74.3239975f, 74.3314056f, 74.3444824f, 74.3883972f,
+    74.4362488f, 74.4977646f, 74.498848f, 74.5762482f, 74.6436386f, 74.6710052f, 74.6736908f, 74.767067f,
+    74.7683563f, 74.7959595f, 74.8318253f, 74.980835f, 75.0500031f, 75.1085205f, 75.1376266f, 75.1439133f,
+    75.1899109f, 75.3608017f, 75.4174652f, 75.4179993f, 75.5022888f, 75.5300293f, 75.5449753f, 75.5901413f,
+    75.6070938f, 75.6384964f, 75.7161636f, 75.7299728f, 75.8015594f, 75.8151398f, 75.8649673f, 75.919899f,
+    75.9252167f, 75.9635696f, 75.964447f, 76.0188065f, 76.1822662f, 76.1975708f, 76.2260208f, 76.2444687f,
+    76.3170013f, 76.3316803f, 76.3396225f, 76.3544922f, 76.4538193f, 76.493103f, 76.5208054f, 76.614624f,
+    76.6301727f, 76.6358109f, 76.6426163f, 76.6604309f, 76.6717072f, 76.8061218f, 76.8547668f, 76.8924637f,
+    76.9231949f, 77.0438232f, 77.0921402f, 77.0951157f, 77.2164917f, 77.2228012f, 77.2546387f, 77.3195648f,
+    77.347847f, 77.4384842f, 77.4462585f, 77.4514389f, 77.4699249f, 77.5790787f, 77.7459946f, 77.7626953f,
+    77.7962112f, 77.8471451f, 77.9664917f, 77.967186f, 78.0123062f, 78.1200485f, 78.1498871f, 78.1698074f,
+    78.1844101f, 78.2001495f, 78.2838211f, 78.4311371f, 78.4444656f, 78.486618f, 78.5253525f, 78.5646667f,
+    78.5826263f, 78.6239777f, 78.6847839f, 78.7214432f, 78.7848969f, 78.830513f, 78.8811111f, 78.8920746f,
+    78.8975677f, 79.0701294f, 79.1706085f, 79.1743164f, 79.2090912f, 79.257843f, 79.2928391f, 79.3438644f,
+    79.4820404f, 79.5900345f, 79.6565018f, 79.6723022f, 79.7012787f, 79.8612289f, 79.9524002f, 80.0194702f,
+    80.1198502f, 80.1215363f, 80.2544937f, 80.2583923f, 80.2624817f, 80.3442993f, 80.3464355f, 80.4088364f,
+    80.4779892f, 80.4923553f, 80.4955597f, 80.4985046f, 80.5166397f, 80.5668335f, 80.5845337f, 80.7069855f,
+    80.7110901f, 80.7200012f, 80.7295074f, 80.734108f, 80.7830353f, 80.8212662f, 80.8332367f, 80.8371811f,
+    80.9457855f, 81.1610718f, 81.1664505f, 81.2242432f, 81.3642426f, 81.3888626f, 81.3991547f, 81.4243164f,
+    81.4687271f, 81.512291f, 81.5238647f, 81.5281601f, 81.5286484f, 81.5396423f, 81.6507263f, 81.6574478f,
+    81.6702957f, 81.679718f, 81.7517014f, 81.7549896f, 81.7901001f, 81.8246994f, 81.8410187f, 81.8511353f,
+    81.9637604f, 82.0361176f, 82.0459518f, 82.1012802f, 82.1287079f, 82.1289978f, 82.1334152f, 82.1384659f,
+    82.1912537f, 82.1996765f, 82.2083206f, 82.2311707f, 82.2669296f, 82.302803f, 82.3288956f, 82.4770584f,
+    82.4782944f, 82.4918137f, 82.5394669f, 82.5552216f, 82.5596085f, 82.622963f, 82.6341324f, 82.6538773f,
+    82.6886139f, 82.7354584f, 82.8002014f, 82.8272858f, 82.8553543f, 82.8803024f, 82.8880997f, 82.9161148f,
+    82.9830399f, 82.9870453f, 83.0040436f, 83.0043106f, 83.024559f, 83.047348f, 83.1270981f, 83.2116928f,
+    83.2153091f, 83.2250595f, 83.3210831f, 83.3261566f, 83.3414078f, 83.3591385f, 83.3777847f, 83.3866348f,
+    83.4209671f, 83.4229813f, 83.4589615f, 83.4810181f, 83.4890976f, 83.4933701f, 83.5086441f, 83.515831f,
+    83.5577469f, 83.5932693f, 83.5980453f, 83.6013718f, 83.6039352f, 83.6364288f, 83.6475449f, 83.6962509f,
+    83.7212372f, 83.7556076f, 83.7916565f, 83.858902f, 83.9132309f, 83.926796f, 84.018364f, 84.1072006f,
+    84.1689987f, 84.1975632f, 84.2448273f, 84.2857971f, 84.3150101f, 84.3359528f, 84.3499908f, 84.4930649f,
+    84.5639038f, 84.5818024f, 84.6087112f, 84.6114807f, 84.664032f, 84.6806793f, 84.6984177f, 84.7142105f,
+    84.7164459f, 84.8067169f, 84.9003983f, 84.9146347f, 84.9767609f, 84.9954758f, 85.0028687f, 85.0281601f,
+    85.0836105f, 85.1041031f, 85.1436691f, 85.1778717f, 85.2023392f, 85.2774734f, 85.2944641f, 85.299202f,
+    85.3250885f, 85.3325195f, 85.4027863f, 85.4802628f, 85.4812698f, 85.4996567f, 85.5542526f, 85.6478653f,
+    85.6492157f, 85.6610336f, 85.6652679f, 85.6693115f, 85.676712f, 85.711525f, 85.8839035f, 85.8876572f,
+    85.9125061f, 85.9511185f, 85.9718323f, 85.9832458f, 86.0377121f, 86.071701f, 86.0782928f, 86.0977707f,
+    86.1020813f, 86.1222382f, 86.1589432f, 86.1620483f, 86.2615356f, 86.2746964f, 86.3056412f, 86.3097458f,
+    86.3233795f, 86.4573746f, 86.4893341f, 86.6883621f, 86.7283401f, 86.7862091f, 86.7863007f, 86.8413391f,
+    87.0040131f, 87.006691f, 87.048645f, 87.0582962f, 87.1108017f, 87.1936264f, 87.2986221f, 87.3359909f,
+    87.3518372f, 87.3662567f, 87.3768692f, 87.396286f, 87.42939f, 87.4654312f, 87.5364304f, 87.5893707f,
+    87.6203995f, 87.7072601f, 87.7585144f, 87.8121872f, 87.8595428f, 88.0766373f, 88.0948105f, 88.127739f,
+    88.1363754f, 88.2903442f, 88.3013153f, 88.3326187f, 88.3681335f, 88.4361877f, 88.5113373f, 88.5177994f,
+    88.5726013f, 88.6145706f, 88.6713943f, 88.7119141f, 88.8059692f, 88.8267746f, 88.912529f, 89.1419678f,
+    89.206131f, 89.2265778f, 89.3126907f, 89.3816071f, 89.4956818f, 89.5221939f, 89.5264053f, 89.5585022f,
+    89.6018982f, 89.6105347f, 89.668251f, 89.6853333f, 89.6932373f, 89.7430801f, 89.7886505f, 89.9391403f,
+    89.9489975f, 89.9786301f, 89.9820786f, 90.0061111f, 90.0088272f, 90.0501785f, 90.0793076f, 90.1101379f,
+    90.1484299f, 90.1999283f, 90.2790985f, 90.3615799f, 90.3692551f, 90.3835297f, 90.4054642f, 90.6141129f,
+    90.6598587f, 90.7384415f, 90.7671814f, 90.8713837f, 90.8869019f, 90.8962402f, 91.0143585f, 91.0639343f,
+    91.0645218f, 91.0867844f, 91.1384125f, 91.1712875f, 91.1796265f, 91.1826172f, 91.1976776f, 91.2013245f,
+    91.2700806f, 91.3455734f, 91.410965f, 91.5109787f, 91.6233444f, 91.6921692f, 91.7302246f, 91.8014603f,
+    91.8167877f, 91.8670654f, 91.8830948f, 91.9427414f, 91.9909134f, 92.0398026f, 92.0509796f, 92.0594025f,
+    92.0727158f, 92.2429886f, 92.2673874f, 92.4485245f, 92.4500809f, 92.5587769f, 92.5621262f, 92.5933151f,
+    92.6219482f, 92.6586533f, 92.6675186f, 92.7037277f, 92.7848587f, 92.8001251f, 92.8143616f, 92.8614044f,
+    92.8702774f, 92.8866959f, 92.8964844f, 92.9173813f, 92.924942f, 92.9474182f, 93.0171661f, 93.0383148f,
+    93.0524902f, 93.0931473f, 93.1204681f, 93.1682816f, 93.2022934f, 93.2220306f, 93.3278809f, 93.3345947f,
+    93.3353729f, 93.4208755f, 93.456749f, 93.4627533f, 93.5079269f, 93.50914f, 93.6701889f, 93.685051f,
+    93.689415f, 93.6921387f, 93.7011795f, 93.7120972f, 93.7422562f, 93.7804947f, 93.9112854f, 93.9277191f,
+    93.9543152f, 93.9945602f, 94.016861f, 94.1697464f, 94.1716232f, 94.2913818f, 94.3038864f, 94.3330231f,
+    94.3578644f, 94.4240189f, 94.5683975f, 94.743515f, 94.8679276f, 94.8964615f, 94.926445f, 94.9776306f,
+    94.9889755f, 95.0853348f, 95.1160812f, 95.2366409f, 95.2880478f, 95.3181458f, 95.320755f, 95.3900986f,
+    95.3913422f, 95.4424973f, 95.4464951f, 95.4512939f, 95.4675827f, 95.4957733f, 95.5238342f, 95.5300369f,
+    95.5673599f, 95.573822f, 95.5753632f, 95.6287918f, 95.6766434f, 95.7072525f, 95.7230988f, 95.7263031f,
+    95.7318192f, 95.756424f, 95.7871857f, 95.792038f, 95.8501053f, 95.8599396f, 95.9470139f, 95.9749527f,
+    96.0137939f, 96.027092f, 96.0385284f, 96.0426483f, 96.0524979f, 96.127182f, 96.1393967f, 96.1982956f,
+    96.2204361f, 96.2594223f, 96.2904358f, 96.3001251f, 96.3585587f, 96.3685837f, 96.3739014f, 96.3798904f,
+    96.4203491f, 96.4946136f, 96.5733566f, 96.6356201f, 96.6433334f, 96.6609573f, 96.7719345f, 96.7727737f,
+    96.7890701f, 96.8329849f, 96.8336334f, 96.8556747f, 96.8899384f, 96.9698715f, 97.0222397f, 97.0410614f,
+    97.0569229f, 97.1358109f, 97.1789398f, 97.1932831f, 97.2212372f, 97.3301773f, 97.3435669f, 97.3696594f,
+    97.3847961f, 97.400383f, 97.4595795f, 97.4709854f, 97.5646362f, 97.6072845f, 97.6156464f, 97.6618729f,
+    97.6914978f, 97.7179108f, 97.7509308f, 97.7818832f, 97.8332977f, 97.885437f, 97.887085f, 97.9043198f,
+    97.9298859f, 97.9636612f, 97.9742508f, 97.9825287f, 98.0456314f, 98.0778351f, 98.1299438f, 98.1651459f,
+    98.2103653f, 98.2394257f, 98.2642212f, 98.3671036f, 98.4360352f, 98.5701828f, 98.5815048f, 98.5826797f,
+    98.6388474f, 98.6981201f, 98.7301941f, 98.7639389f, 98.7654037f, 98.8104324f, 98.8316345f, 98.8534927f,
+    98.8810425f, 98.9017563f, 98.9174042f, 98.9320374f, 98.993042f, 99.0835037f, 99.0836105f, 99.1426163f,
+    99.1479263f, 99.1488571f, 99.2040329f, 99.2804184f, 99.2961044f, 99.3142471f, 99.3553467f, 99.3745422f,
+    99.4517136f, 99.4580307f, 99.4855423f, 99.5081863f, 99.5158386f, 99.5307159f, 99.5544128f, 99.5687943f,
+    99.5786819f, 99.5944748f, 99.6059952f, 99.6508713f, 99.6574249f, 99.6915665f, 99.6935577f, 99.6938629f,
+    99.6984787f, 99.7050171f, 99.7465591f, 99.8639832f, 99.8948746f, 99.9096222f, 99.9168854f, 99.9312439f,
+    99.9429321f, 99.9471207f, 99.9687958f, 100.000786f, 100.050407f, 100.061516f, 100.094231f, 100.112f,
+    100.143387f, 100.147697f, 100.178978f, 100.227814f, 100.25602f, 100.285294f, 100.287933f, 100.349869f,
+    100.378876f, 100.481873f, 100.503853f, 100.516609f, 100.545128f, 100.55191f, 100.57589f, 100.585289f,
+    100.618065f, 100.631462f, 100.670464f, 100.719833f, 100.721626f, 100.749329f, 100.761002f, 100.782707f,
+    100.809074f, 100.838821f, 100.857712f, 100.909203f, 100.922798f, 100.966164f, 101.007011f, 101.02961f,
+    101.042526f, 101.084656f, 101.170959f, 101.24456f, 101.279068f, 101.30307f, 101.336311f, 101.379601f,
+    101.406799f, 101.415405f, 101.477333f, 101.489716f, 101.545334f, 101.552475f, 101.584274f, 101.598381f,
+    101.694191f, 101.723145f, 101.745041f, 101.761826f, 101.795364f, 101.835907f, 101.843895f, 101.892471f,
+    101.961151f, 101.981102f, 102.006203f, 102.05291f, 102.066628f, 102.075729f, 102.137978f, 102.151443f,
+    102.158012f, 102.177505f, 102.183372f, 102.245781f, 102.254982f, 102.268036f, 102.288841f, 102.353027f,
+    102.355415f, 102.394287f, 102.431892f, 102.470329f, 102.481255f, 102.512917f, 102.523216f, 102.574615f,
+    102.596352f, 102.609695f, 102.644806f, 102.665955f, 102.69091f, 102.720909f, 102.722572f, 102.728561f,
+    102.788628f, 102.828262f, 102.954712f, 102.985184f, 102.989693f, 102.996613f, 103.010162f, 103.026192f,
+    103.09259f, 103.095772f, 103.103096f, 103.157326f, 103.266525f, 103.300438f, 103.314438f, 103.413185f,
+    103.491684f, 103.496536f, 103.50444f, 103.51757f, 103.532722f, 103.570984f, 103.624222f, 103.638969f,
+    103.668503f, 103.740891f, 103.838173f, 103.855499f, 103.897499f, 103.922478f, 103.955162f, 104.021896f,
+    104.027771f, 104.067108f, 104.091034f, 104.141739f, 104.18557f, 104.196114f, 104.304825f, 104.306282f,
+    104.332245f, 104.343201f, 104.360291f, 104.405724f, 104.618767f, 104.639191f, 104.689491f, 104.709679f,
+    104.795113f, 104.795258f, 104.918571f, 104.918633f, 105.028793f, 105.038269f, 105.052132f, 105.083412f,
+    105.11467f, 105.157127f, 105.168381f, 105.196251f, 105.222878f, 105.233101f, 105.238716f, 105.403801f,
+    105.427109f, 105.454216f, 105.456841f, 105.520599f, 105.550209f, 105.671967f, 105.674187f, 105.69207f,
+    105.834969f, 105.928307f, 105.943748f, 105.97438f, 106.022881f, 106.108009f, 106.20211f, 106.223167f,
+    106.241089f, 106.265686f, 106.293999f, 106.305206f, 106.308731f, 106.329567f, 106.426193f, 106.444466f,
+    106.571953f, 106.591324f, 106.686409f, 106.750816f, 106.791031f, 106.9048f, 106.90654f, 106.989288f,
+    107.048904f, 107.074974f, 107.1008f, 107.114151f, 107.156075f, 107.21299f, 107.262054f, 107.309845f,
+    107.323509f, 107.354362f, 107.36499f, 107.625061f, 107.698746f, 107.754822f, 107.807106f, 107.93084f,
+    108.127251f, 108.197922f, 108.207481f, 108.291f, 108.351128f, 108.509682f, 108.519196f, 108.772453f,
+    108.913506f, 109.056244f, 109.281929f, 109.668587f, 109.682083f, 109.830513f, 109.874664f, 110.036034f,
+    110.182777f, 110.538818f, 110.695854f, 111.054863f, 111.712997f, 111.761826f, 111.825813f, 112.230995f,
+    112.32885f, 112.612602f, 112.715691f, 112.904495f, 112.914764f, 112.991631f, 113.075783f, 113.24913f,
+    113.356667f, 113.435898f, 113.54319f, 113.834084f, 113.900841f, 113.953194f, 114.002655f, 114.235176f,
+    114.3955f, 114.689735f, 114.732597f, 115.279297f, 115.352531f, 115.472549f, 115.528259f, 115.908028f,
+    115.909363f, 115.949402f, 116.146652f, 116.170174f, 116.314346f, 116.473274f, 116.561661f, 116.807915f,
+    117.188484f, 117.51722f, 117.555267f, 117.783752f, 117.983932f, 118.288406f, 118.492645f, 118.527374f
+};
+
+alignas(64) constexpr u32 MODEL_R94_COMPLEMENT_SORTED_KMERS[] = {
+    350, 348, 336, 862, 848, 860, 604, 606,
+    464, 92, 592, 94, 80, 720, 976, 208,
+    368, 112, 338, 476, 478, 382, 380, 850,
+    880, 624, 340, 732, 124, 734, 466, 594,
+    852, 342, 82, 144, 337, 400, 854, 656,
+    988, 912, 126, 596, 370, 849, 990, 220,
+    349, 496, 722, 222, 84, 372, 636, 892,
+    374, 978, 598, 894, 468, 638, 752, 593,
+    1008, 861, 465, 81, 210, 86, 605, 114,
+    351, 724, 470, 93, 240, 980, 863, 116,
+    369, 977, 339, 721, 882, 626, 726, 607,
+    212, 884, 95, 118, 209, 628, 343, 851,
+    886, 982, 412, 156, 113, 855, 668, 630,
+    214, 381, 16, 924, 272, 341, 595, 83,
+    146, 284, 498, 467, 477, 414, 508, 599,
+    371, 402, 432, 853, 881, 28, 158, 510,
+    176, 658, 87, 286, 625, 670, 375, 373,
+    471, 500, 914, 926, 383, 944, 688, 723,
+    764, 733, 727, 540, 597, 754, 479, 30,
+    125, 979, 1020, 85, 145, 1010, 756, 796,
+    469, 115, 528, 401, 766, 148, 983, 542,
+    211, 660, 404, 784, 1012, 798, 502, 725,
+    376, 1022, 913, 657, 344, 304, 893, 916,
+    735, 989, 242, 497, 883, 378, 637, 252,
+    215, 119, 221, 856, 117, 981, 436, 887,
+    127, 885, 48, 627, 244, 180, 758, 88,
+    346, 991, 254, 631, 629, 895, 948, 1014,
+    692, 150, 753, 406, 213, 1009, 223, 600,
+    858, 662, 472, 18, 120, 639, 816, 274,
+    918, 377, 90, 147, 888, 345, 403, 246,
+    728, 499, 444, 241, 560, 122, 17, 20,
+    984, 890, 659, 216, 316, 915, 273, 602,
+    857, 188, 276, 178, 434, 632, 501, 379,
+    474, 700, 503, 89, 532, 509, 956, 530,
+    308, 151, 438, 347, 755, 318, 690, 407,
+    1011, 446, 157, 946, 634, 182, 22, 730,
+    1013, 663, 413, 473, 278, 986, 218, 60,
+    786, 190, 669, 529, 757, 919, 121, 52,
+    601, 694, 950, 1015, 859, 306, 504, 152,
+    702, 217, 759, 958, 159, 534, 889, 788,
+    91, 925, 1016, 149, 785, 415, 285, 243,
+    729, 985, 564, 29, 19, 828, 405, 511,
+    62, 671, 408, 310, 1021, 760, 275, 765,
+    506, 433, 572, 287, 661, 820, 123, 352,
+    31, 50, 177, 927, 920, 633, 917, 96,
+    891, 830, 1018, 245, 305, 603, 541, 160,
+    790, 664, 689, 439, 574, 475, 543, 247,
+    945, 416, 437, 531, 154, 762, 54, 23,
+    1023, 183, 181, 928, 818, 279, 797, 767,
+    635, 248, 253, 32, 731, 799, 288, 49,
+    951, 24, 505, 695, 153, 219, 987, 787,
+    693, 562, 280, 949, 672, 410, 864, 822,
+    736, 535, 21, 224, 566, 608, 1017, 480,
+    922, 179, 435, 277, 307, 409, 250, 817,
+    666, 761, 507, 311, 255, 921, 536, 533,
+    309, 26, 561, 791, 1019, 992, 691, 800,
+    947, 282, 792, 544, 665, 440, 51, 155,
+    763, 184, 312, 55, 445, 25, 317, 354,
+    53, 249, 189, 789, 281, 538, 411, 952,
+    823, 819, 923, 98, 696, 701, 567, 56,
+    320, 794, 957, 563, 314, 821, 565, 447,
+    251, 61, 319, 27, 537, 667, 162, 191,
+    442, 283, 256, 824, 418, 186, 0, 164,
+    793, 34, 313, 420, 703, 512, 930, 959,
+    568, 58, 64, 829, 610, 866, 954, 573,
+    290, 539, 63, 932, 441, 698, 738, 185,
+    482, 768, 226, 826, 315, 674, 36, 795,
+    576, 676, 57, 831, 353, 292, 575, 570,
+    100, 548, 356, 161, 443, 832, 953, 384,
+    358, 166, 187, 364, 804, 994, 825, 417,
+    33, 546, 97, 697, 422, 108, 172, 366,
+    802, 289, 59, 428, 102, 300, 929, 704,
+    322, 44, 569, 955, 896, 128, 38, 934,
+    258, 514, 2, 827, 110, 699, 294, 940,
+    740, 678, 673, 228, 174, 571, 545, 612,
+    430, 684, 865, 46, 737, 66, 868, 550,
+    302, 448, 225, 640, 801, 614, 609, 167,
+    876, 355, 870, 556, 770, 742, 35, 620,
+    812, 481, 163, 291, 484, 942, 192, 165,
+    423, 40, 513, 419, 230, 1, 168, 878,
+    321, 622, 99, 257, 421, 296, 578, 806,
+    236, 960, 686, 359, 931, 424, 486, 935,
+    834, 492, 748, 386, 993, 357, 39, 558,
+    103, 547, 933, 996, 37, 936, 334, 101,
+    295, 679, 238, 42, 814, 677, 750, 494,
+    130, 293, 803, 170, 515, 898, 360, 298,
+    706, 675, 65, 552, 3, 867, 259, 998,
+    426, 104, 769, 680, 1004, 808, 323, 365,
+    227, 518, 6, 362, 551, 739, 262, 483,
+    938, 549, 611, 743, 41, 109, 173, 741,
+    554, 332, 1006, 78, 45, 577, 871, 385,
+    169, 260, 231, 106, 297, 615, 807, 642,
+    326, 229, 301, 450, 429, 270, 869, 268,
+    516, 613, 4, 7, 519, 425, 682, 995,
+    14, 805, 263, 487, 810, 833, 232, 194,
+    517, 771, 129, 327, 43, 485, 526, 12,
+    897, 705, 67, 553, 937, 872, 5, 744,
+    941, 261, 299, 361, 590, 488, 774, 846,
+    76, 524, 171, 333, 557, 70, 962, 999,
+    616, 685, 47, 877, 387, 325, 427, 303,
+    772, 997, 175, 367, 809, 71, 105, 234,
+    555, 681, 782, 390, 780, 431, 621, 874,
+    775, 939, 1000, 746, 449, 813, 237, 13,
+    579, 749, 490, 111, 269, 493, 363, 131,
+    391, 525, 899, 618, 641, 835, 324, 811,
+    588, 77, 388, 559, 582, 69, 773, 943,
+    193, 583, 707, 902, 134, 844, 107, 718,
+    335, 838, 711, 389, 839, 1002, 683, 903,
+    710, 135, 233, 68, 815, 900, 961, 873,
+    398, 132, 687, 1005, 15, 745, 489, 589,
+    271, 396, 879, 133, 901, 527, 709, 451,
+    581, 845, 617, 716, 781, 643, 837, 142,
+    623, 79, 910, 875, 235, 239, 462, 751,
+    717, 195, 397, 140, 495, 646, 1001, 206,
+    747, 908, 491, 455, 199, 647, 580, 198,
+    619, 454, 644, 963, 974, 141, 967, 783,
+    836, 591, 847, 266, 522, 708, 264, 1007,
+    1003, 645, 197, 909, 10, 460, 453, 966,
+    654, 8, 521, 719, 520, 399, 265, 204,
+    652, 9, 461, 267, 965, 205, 972, 523,
+    778, 196, 11, 143, 973, 911, 776, 452,
+    653, 777, 463, 779, 207, 330, 975, 964,
+    328, 329, 655, 331, 74, 392, 394, 72,
+    393, 73, 136, 395, 904, 906, 138, 905,
+    75, 137, 842, 840, 139, 907, 586, 584,
+    841, 843, 585, 648, 587, 714, 650, 713,
+    649, 712, 458, 456, 651, 715, 457, 459,
+    202, 201, 200, 970, 203, 968, 969, 971
+};
+
+constexpr ModelPreset MODEL_R94_COMPLEMENT = {
+    5, 90.2083511f, 12.8326588f,
+    MODEL_R94_COMPLEMENT_MEANS, MODEL_R94_COMPLEMENT_VARS_X2,
+    MODEL_R94_COMPLEMENT_LOGNORM_DENOMS, MODEL_R94_COMPLEMENT_SORTED_MEANS,
+    MODEL_R94_COMPLEMENT_SORTED_KMERS
 };
 
 const PoreModel<KmerLen::k5> 
-    pmodel_r94_template(model_r94_means_stdvs, false);
+    pmodel_r94_template(MODEL_R94_TEMPLATE, false);
 
 const PoreModel<KmerLen::k5> 
-    pmodel_r94_complement(model_r94_means_stdvs, true);
+    pmodel_r94_complement(MODEL_R94_COMPLEMENT, true);
 
 #endif
@@ -91,6 +91,11 @@ void Normalizer::reset(u32 buffer_size) {
 
     set_length(buffer_size);
 
+    //Signal may have been replaced by set_signal
+    if (signal_.size() != PRMS.len) {
+        signal_.resize(PRMS.len);
+    }
+
     signal_[0] = 0;
 }
 
@@ -0,0 +1,127 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+#include "numa.hpp"
+
+#define NODE_DIR "/sys/devices/system/node/"
+
+std::vector<u16> parse_cpu_list(const std::string &list) {
+    std::vector<u16> cpus;
+    std::stringstream ss(list);
+    std::string item;
+
+    while (getline(ss, item, ',')) {
+        if (item.empty()) continue;
+
+        size_t dash = item.find('-');
+        try {
+            if (dash == std::string::npos) {
+                cpus.push_back(std::stoi(item));
+            } else {
+                u16 st = std::stoi(item.substr(0, dash)),
+                    en = std::stoi(item.substr(dash+1));
+                for (u32 c = st; c <= en; c++) cpus.push_back(c);
+            }
+        } catch (const std::exception &e) {
+            std::cerr << "Error: invalid CPU list \"" << list << "\"\n";
+            return std::vector<u16>();
+        }
+    }
+
+    return cpus;
+}
+
+static std::string read_line(const std::string &fname) {
+    std::ifstream in(fname);
+    std::string line;
+    if (in.is_open()) getline(in, line);
+    return line;
+}
+
+u16 numa_node_count() {
+    std::vector<u16> nodes = parse_cpu_list(read_line(NODE_DIR "online"));
+    if (nodes.empty()) return 1;
+    return nodes.back() + 1;
+}
+
+std::vector<u16> numa_node_cpus(u16 node) {
+    return parse_cpu_list(
+        read_line(NODE_DIR "node" + std::to_string(node) + "/cpulist"));
+}
+
+u16 numa_cpu_node(u16 cpu) {
+    u16 nodes = numa_node_count();
+    for (u16 n = 0; n < nodes; n++) {
+        for (u16 c : numa_node_cpus(n)) {
+            if (c == cpu) return n;
+        }
+    }
+    return 0;
+}
+
+static bool set_affinity(pthread_t t, const std::vector<u16> &cpus) {
+    if (cpus.empty()) return false;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (u16 c : cpus) {
+        //CPU_SET doesn't check bounds, so a bad cpu_set would write 
+        //past the end of the set
+        if (c >= CPU_SETSIZE) return false;
+        CPU_SET(c, &set);
+    }
+
+    return pthread_setaffinity_np(t, sizeof(cpu_set_t), &set) == 0;
+}
+
+bool pin_thread(std::thread &t, const std::vector<u16> &cpus) {
+    return set_affinity(t.native_handle(), cpus);
+}
+
+bool pin_this_thread(const std::vector<u16> &cpus) {
+    return set_affinity(pthread_self(), cpus);
+}
+
+bool numa_interleave(bool enable) {
+    if (!enable) {
+        return syscall(SYS_set_mempolicy, MPOL_DEFAULT, NULL, 0) == 0;
+    }
+
+    u16 nodes = numa_node_count();
+    if (nodes > sizeof(unsigned long) * 8) {
+        nodes = sizeof(unsigned long) * 8;
+    }
+
+    unsigned long mask = 0;
+    for (u16 n = 0; n < nodes; n++) mask |= 1UL << n;
+
+    //Kernel reads maxnode-1 bits of the mask
+    return syscall(SYS_set_mempolicy, MPOL_INTERLEAVE, &mask, nodes+1) == 0;
+}
@@ -0,0 +1,58 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _INCL_NUMA
+#define _INCL_NUMA
+
+#include <vector>
+#include <string>
+#include <thread>
+#include "util.hpp"
+
+//How the FM index is placed in memory on multi-socket hosts
+//NONE: wherever the loading thread allocates it
+//REPLICATE: one copy per NUMA node, mappers use their local copy
+//INTERLEAVE: one copy with pages spread evenly across nodes
+enum class NumaIndex {NONE, REPLICATE, INTERLEAVE, NUM};
+
+//Parses Linux-style CPU lists, e.g. "0-7,16,18-19"
+std::vector<u16> parse_cpu_list(const std::string &list);
+
+//Number of online NUMA nodes (1 if not reported by the kernel)
+u16 numa_node_count();
+
+//CPUs belonging to a NUMA node
+std::vector<u16> numa_node_cpus(u16 node);
+
+//NUMA node containing a CPU (0 if unknown)
+u16 numa_cpu_node(u16 cpu);
+
+//Restricts a thread to a set of CPUs, returns false on failure
+bool pin_thread(std::thread &t, const std::vector<u16> &cpus);
+bool pin_this_thread(const std::vector<u16> &cpus);
+
+//Interleaves (or stops interleaving) future allocations of 
+//the calling thread across all NUMA nodes
+bool numa_interleave(bool enable);
+
+#endif
@@ -0,0 +1,196 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <cstring>
+#include "paf_writer.hpp"
+
+const char PafWriter::BINARY_MAGIC[] = "UNCLPAF";
+const u16 PafWriter::BINARY_VERSION;
+
+PafWriter::Buffer::Buffer(PafWriter &writer) : writer_(writer) {
+    buf_.reserve(writer_.block_size_ + (writer_.block_size_ >> 2));
+}
+
+PafWriter::Buffer::~Buffer() {
+    flush();
+}
+
+void PafWriter::Buffer::write(const Paf &p) {
+    if (writer_.fmt_ == Format::BINARY) {
+        i64 max_id = p.max_str_id();
+        if (max_id >= writer_.strs_written_) writer_.write_strs(max_id);
+        p.write_binary(buf_);
+    } else {
+        p.write_text(buf_);
+    }
+
+    if (buf_.size() >= writer_.block_size_) flush();
+}
+
+void PafWriter::Buffer::flush() {
+    if (buf_.empty()) return;
+    writer_.write_block(buf_);
+    buf_.clear();
+}
+
+PafWriter::PafWriter(Format fmt, const std::string &fname, u32 block_size) 
+    : fmt_(fmt),
+      block_size_(block_size),
+      out_(NULL),
+      own_out_(false),
+      strs_written_(0),
+      buffer_(*this) {
+
+    if (fname.empty() || fname == "-") {
+        out_ = stdout;
+    } else {
+        out_ = fopen(fname.c_str(), fmt_ == Format::BINARY ? "wb" : "w");
+        own_out_ = true;
+        if (out_ == NULL) {
+            std::cerr << "Error: failed to open \"" << fname << "\"\n";
+            return;
+        }
+    }
+
+    if (fmt_ == Format::BINARY) {
+        fwrite(BINARY_MAGIC, 1, sizeof(BINARY_MAGIC), out_);
+        fwrite(&BINARY_VERSION, sizeof(BINARY_VERSION), 1, out_);
+    }
+}
+
+PafWriter::~PafWriter() {
+    flush();
+    if (own_out_ && out_ != NULL) fclose(out_);
+}
+
+bool PafWriter::is_open() const {
+    return out_ != NULL;
+}
+
+PafWriter::Format PafWriter::get_format() const {
+    return fmt_;
+}
+
+void PafWriter::write(const Paf &p) {
+    buffer_.write(p);
+}
+
+void PafWriter::flush() {
+    buffer_.flush();
+    std::lock_guard<std::mutex> lock(out_mtx_);
+    if (out_ != NULL) fflush(out_);
+}
+
+void PafWriter::write_block(const std::string &block) {
+    std::lock_guard<std::mutex> lock(out_mtx_);
+    if (out_ == NULL) return;
+    fwrite(block.data(), 1, block.size(), out_);
+}
+
+void PafWriter::write_strs(u32 max_id) {
+    std::lock_guard<std::mutex> lock(out_mtx_);
+    if (out_ == NULL) return;
+
+    std::string block;
+    for (u32 id = strs_written_; id <= max_id; id++) {
+        Paf::write_binary_str(block, id);
+    }
+    fwrite(block.data(), 1, block.size(), out_);
+
+    if (max_id >= strs_written_) strs_written_ = max_id + 1;
+}
+
+u64 PafWriter::convert_binary(const std::string &fname) {
+    FILE *in = (fname.empty() || fname == "-") ? stdin : fopen(fname.c_str(), "rb");
+    if (in == NULL) {
+        std::cerr << "Error: failed to open \"" << fname << "\"\n";
+        return 0;
+    }
+
+    char magic[sizeof(BINARY_MAGIC)];
+    u16 version = 0;
+    if (fread(magic, 1, sizeof(magic), in) != sizeof(magic) ||
+        memcmp(magic, BINARY_MAGIC, sizeof(magic)) != 0 ||
+        fread(&version, sizeof(version), 1, in) != 1) {
+        std::cerr << "Error: \"" << fname << "\" is not a binary PAF file\n";
+        if (in != stdin) fclose(in);
+        return 0;
+    }
+
+    if (version != BINARY_VERSION) {
+        std::cerr << "Error: unsupported binary PAF version " << version << "\n";
+        if (in != stdin) fclose(in);
+        return 0;
+    }
+
+    //Read in blocks, keeping any partial record for the next block
+    std::vector<char> block(block_size_);
+    size_t len = 0;
+    u64 count = 0;
+    Paf p;
+
+    //Maps string ids in the file to ids interned here
+    std::vector<u32> str_ids;
+
+    while (true) {
+        size_t n = fread(block.data() + len, 1, block.size() - len, in);
+        len += n;
+
+        const char *st = block.data(), *end = st + len;
+        while (p.read_binary(st, end, str_ids)) {
+            write(p);
+            count++;
+        }
+
+        len = end - st;
+
+        //Full record present but failed to parse
+        u32 rec_len;
+        if (len >= sizeof(rec_len)) {
+            memcpy(&rec_len, st, sizeof(rec_len));
+            if (len - sizeof(rec_len) >= rec_len) {
+                std::cerr << "Error: malformed record in \"" << fname << "\"\n";
+                len = 0;
+                break;
+            }
+        }
+
+        if (n == 0) break;
+
+        memmove(block.data(), st, len);
+
+        //Record larger than block, grow buffer
+        if (len == block.size()) block.resize(block.size() * 2);
+    }
+
+    if (len > 0) {
+        std::cerr << "Warning: ignoring truncated record at end of \"" 
+                  << fname << "\"\n";
+    }
+
+    if (in != stdin) fclose(in);
+    flush();
+
+    return count;
+}
@@ -0,0 +1,127 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _INCL_PAF_WRITER
+#define _INCL_PAF_WRITER
+
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <cstdio>
+#include "read_buffer.hpp"
+#include "util.hpp"
+
+#ifdef PYBIND
+#include <pybind11/pybind11.h>
+#endif
+
+//Writes alignments as text or binary PAF in large blocks
+//Each thread formats into its own Buffer, which only locks the
+//writer when a full block is ready to be written
+class PafWriter {
+    public:
+
+    enum class Format {TEXT, BINARY, NUM};
+
+    //Binary files start with magic string followed by u16 version
+    static const char BINARY_MAGIC[];
+    static const u16 BINARY_VERSION = 2;
+
+    static const u32 DEF_BLOCK_SIZE = 1 << 16;
+
+    class Buffer {
+        public:
+        Buffer(PafWriter &writer);
+        ~Buffer();
+
+        void write(const Paf &p);
+        void flush();
+
+        private:
+        PafWriter &writer_;
+        std::string buf_;
+    };
+
+    //Writes to stdout if fname is empty or "-"
+    PafWriter(Format fmt = Format::TEXT, 
+              const std::string &fname = "",
+              u32 block_size = DEF_BLOCK_SIZE);
+    ~PafWriter();
+
+    PafWriter(const PafWriter &) = delete;
+    PafWriter &operator=(const PafWriter &) = delete;
+
+    bool is_open() const;
+    Format get_format() const;
+
+    //Writes to the writer's own buffer, not thread safe
+    //Threads writing concurrently should each use a Buffer
+    void write(const Paf &p);
+
+    //Writes all buffered data through to the output file
+    void flush();
+
+    //Converts a binary PAF file to this writer's format
+    //Returns the number of records converted
+    u64 convert_binary(const std::string &fname);
+
+    #ifdef PYBIND
+
+    #define PY_PAF_WRITER_METH(P) c.def(#P, &PafWriter::P);
+    #define PY_PAF_WRITER_FMT(P) f.value(#P, PafWriter::Format::P);
+
+    static void pybind_defs(pybind11::class_<PafWriter> &c) {
+        c.def(pybind11::init<Format, const std::string &>(),
+              pybind11::arg("fmt") = Format::TEXT,
+              pybind11::arg("fname") = "");
+        PY_PAF_WRITER_METH(is_open);
+        PY_PAF_WRITER_METH(get_format);
+        PY_PAF_WRITER_METH(write);
+        PY_PAF_WRITER_METH(flush);
+        PY_PAF_WRITER_METH(convert_binary);
+
+        pybind11::enum_<PafWriter::Format> f(c, "Format");
+        PY_PAF_WRITER_FMT(TEXT);
+        PY_PAF_WRITER_FMT(BINARY);
+        f.export_values();
+    }
+
+    #endif
+
+    private:
+    void write_block(const std::string &block);
+
+    //Writes records for interned strings up to max_id, which must be 
+    //output before any alignment referencing them
+    void write_strs(u32 max_id);
+
+    Format fmt_;
+    u32 block_size_;
+    FILE *out_;
+    bool own_out_;
+    std::mutex out_mtx_;
+    std::atomic<u32> strs_written_;
+    Buffer buffer_;
+};
+
+#endif
@@ -21,120 +21,354 @@
  * SOFTWARE.
  */
 
+
 #ifndef _INCL_KMER_MODEL
 #define _INCL_KMER_MODEL
 
 #include <array>
+#include <vector>
+#include <algorithm>
 #include <utility>
+#include <memory>
+#include <type_traits>
+#include <fstream>
+#include <cstring>
 #include <cmath>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "event_detector.hpp"
 #include "util.hpp"
 #include "bp.hpp"
 
+//Arrays of a model in one orientation, indexed by k-mer
+//Built-in presets are generated as constexpr arrays by uncalled_model
 typedef struct {
-    KmerLen k;
-    std::vector<float> means_stdvs;
+    u32 k;
+    float model_mean, model_stdv;
+    const float *lv_means, *lv_vars_x2, *lognorm_denoms, *sorted_means;
+    const u32 *sorted_kmers;
 } ModelPreset;
 
+//Binary model files start with this header, followed by the arrays of
+//the template and then complement orientation in ModelPreset order. 
+//Each array has 4^k 4-byte values, so arrays stay 64-byte aligned
+const char PORE_MODEL_MAGIC[8] = "UNCLMDL";
+const u32 PORE_MODEL_VERSION = 1;
+
+typedef struct {
+    char magic[8];
+    u32 version, k;
+    float model_means[2], model_stdvs[2]; //template, complement
+    u8 pad[32];
+} PoreModelHeader;
+
 template<KmerLen KLEN>
 class PoreModel {
 
     private:
-    std::vector<float> lv_means_, lv_vars_x2_, lognorm_denoms_;
+    const float *lv_means_, *lv_vars_x2_, *lognorm_denoms_;
     float model_mean_, model_stdv_;
-    u16 kmer_count_;
+    u32 kmer_count_;
     bool loaded_, complement_;
 
-    void init_stdv() {
-        model_stdv_ = 0;
+    //K-mers sorted by mean level, to find k-mers near an event
+    //without scoring all of them (see get_window)
+    const u32 *sorted_kmers_;
+    const float *sorted_means_;
+
+    //Memory the arrays point to, shared between copies. Either computed
+    //from a text model, a mapped binary model, or empty for presets
+    std::shared_ptr<const void> storage_;
+
+    //match_prob precomputed for evenly spaced event levels, one row of
+    //kmer_count_ values per level plus a final row of -inf (see init_prob_lut)
+    std::vector<float> prob_lut_;
+    float lut_min_, lut_scale_;
+    u32 lut_bins_;
+
+    typedef struct {
+        float model_mean, model_stdv;
+        std::vector<float> lv_means, lv_vars_x2, lognorm_denoms, sorted_means;
+        std::vector<u32> sorted_kmers;
+    } Arrays;
+
+    //Mean is summed in template k-mer order, as the model file lists 
+    //them, so both orientations match models loaded from text
+    void init_stats(Arrays &a, bool cmpl) const {
+        a.model_mean = 0;
+        for (u32 kmer = 0; kmer < kmer_count_; kmer++) {
+            a.model_mean += a.lv_means[cmpl ? kmer_comp<KLEN>(kmer) : kmer];
+        }
+        a.model_mean /= kmer_count_;
+
+        a.model_stdv = 0;
+        for (u32 kmer = 0; kmer < kmer_count_; kmer++) {
+            a.model_stdv += pow(a.lv_means[kmer] - a.model_mean, 2);
+        }
+        a.model_stdv = sqrt(a.model_stdv / kmer_count_);
+    }
+
+    //Computes all arrays from the level mean and stdv of each k-mer
+    void init_arrays(const std::vector<float> &means, 
+                     const std::vector<float> &stdvs) {
 
-        for (u16 kmer = 0; kmer < kmer_count_; kmer++) {
-            model_stdv_ += pow(lv_means_[kmer] - model_mean_, 2);
+        std::shared_ptr<Arrays> a(new Arrays());
+        a->lv_means = means;
+        a->lv_vars_x2.resize(kmer_count_);
+        a->lognorm_denoms.resize(kmer_count_);
+
+        for (u32 kmer = 0; kmer < kmer_count_; kmer++) {
+            a->lv_vars_x2[kmer] = 2 * stdvs[kmer] * stdvs[kmer];
+            a->lognorm_denoms[kmer] = log(sqrt(M_PI * a->lv_vars_x2[kmer]));
         }
 
-        model_stdv_ = sqrt(model_stdv_ / kmer_count_);
+        init_stats(*a, complement_);
+        model_mean_ = a->model_mean;
+        model_stdv_ = a->model_stdv;
+
+        a->sorted_kmers.resize(kmer_count_);
+        for (u32 kmer = 0; kmer < kmer_count_; kmer++) {
+            a->sorted_kmers[kmer] = kmer;
+        }
+
+        std::sort(a->sorted_kmers.begin(), a->sorted_kmers.end(), 
+                  [&means](u32 a, u32 b) {return means[a] < means[b];});
+
+        a->sorted_means.resize(kmer_count_);
+        for (u32 i = 0; i < kmer_count_; i++) {
+            a->sorted_means[i] = means[a->sorted_kmers[i]];
+        }
+
+        lv_means_ = a->lv_means.data();
+        lv_vars_x2_ = a->lv_vars_x2.data();
+        lognorm_denoms_ = a->lognorm_denoms.data();
+        sorted_means_ = a->sorted_means.data();
+        sorted_kmers_ = a->sorted_kmers.data();
+        storage_ = a;
+
+        loaded_ = true;
     }
 
-    void init_kmer(u16 k, float mean, float stdv) {
-        lv_means_[k] = mean;
-        lv_vars_x2_[k] = 2 * stdv * stdv;
-        lognorm_denoms_[k] = log(sqrt(M_PI * lv_vars_x2_[k]));
+    void init_preset(const ModelPreset &p) {
+        if (p.k != KLEN) {
+            std::cerr << "Error: " << p.k << "-mer model loaded for " 
+                      << KLEN << "-mers\n";
+            return;
+        }
+
+        model_mean_ = p.model_mean;
+        model_stdv_ = p.model_stdv;
+        lv_means_ = p.lv_means;
+        lv_vars_x2_ = p.lv_vars_x2;
+        lognorm_denoms_ = p.lognorm_denoms;
+        sorted_means_ = p.sorted_means;
+        sorted_kmers_ = p.sorted_kmers;
+        loaded_ = true;
     }
 
-    public:
+    //Maps a binary model and points to the arrays for one orientation
+    bool load_binary(const std::string &model_fname, bool cmpl) {
+        int fd = open(model_fname.c_str(), O_RDONLY);
+        struct stat st;
+        if (fd < 0 || fstat(fd, &st) != 0) {
+            std::cerr << "Error: failed to open model \"" << model_fname << "\"\n";
+            if (fd >= 0) close(fd);
+            return false;
+        }
 
-    PoreModel() 
-        :  loaded_(false) {
+        u64 size = st.st_size;
+        void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (map == MAP_FAILED) {
+            std::cerr << "Error: failed to map model \"" << model_fname << "\"\n";
+            return false;
+        }
+
+        storage_ = std::shared_ptr<const void>(map, 
+            [size](const void *m) {munmap((void *) m, size);});
+
+        const PoreModelHeader *h = (const PoreModelHeader *) map;
+        u64 arrays_len = 5 * sizeof(float) * (u64) kmer_count_;
+
+        if (size < sizeof(PoreModelHeader) || 
+            memcmp(h->magic, PORE_MODEL_MAGIC, sizeof(h->magic)) != 0) {
+            std::cerr << "Error: \"" << model_fname << "\" is not a binary model\n";
+            return false;
+        }
+
+        if (h->version != PORE_MODEL_VERSION) {
+            std::cerr << "Error: model \"" << model_fname << "\" is version " 
+                      << h->version << ", expected " << PORE_MODEL_VERSION << "\n";
+            return false;
+        }
+
+        if (h->k != KLEN || size != sizeof(PoreModelHeader) + 2 * arrays_len) {
+            std::cerr << "Error: model \"" << model_fname << "\" has " 
+                      << h->k << "-mers, expected " << KLEN << "-mers\n";
+            return false;
+        }
+
+        const float *arrs = (const float *) ((const char *) map + 
+                                             sizeof(PoreModelHeader) + 
+                                             cmpl * arrays_len);
+        ModelPreset p = {
+            h->k, h->model_means[cmpl], h->model_stdvs[cmpl],
+            arrs, 
+            arrs + kmer_count_, 
+            arrs + 2 * kmer_count_, 
+            arrs + 3 * kmer_count_,
+            (const u32 *) (arrs + 4 * kmer_count_)
+        };
+        init_preset(p);
+
+        return loaded_;
+    }
+
+    static bool is_binary(const std::string &model_fname) {
+        std::ifstream in(model_fname, std::ios::binary);
+        char magic[sizeof(PORE_MODEL_MAGIC)];
+        return in.read(magic, sizeof(magic)) && 
+               memcmp(magic, PORE_MODEL_MAGIC, sizeof(magic)) == 0;
+    }
+
+    //Both orientations in binary file order: template, then complement
+    //Complement arrays hold the same values at complemented k-mers
+    std::array<Arrays, 2> get_oriented_arrays() const {
+        std::array<Arrays, 2> arrs;
+
+        for (u32 c = 0; c < 2; c++) {
+            bool flip = (c == 1) != complement_;
+            Arrays &o = arrs[c];
+
+            o.lv_means.resize(kmer_count_);
+            o.lv_vars_x2.resize(kmer_count_);
+            o.lognorm_denoms.resize(kmer_count_);
+            for (u32 kmer = 0; kmer < kmer_count_; kmer++) {
+                u32 dst = flip ? kmer_comp<KLEN>(kmer) : kmer;
+                o.lv_means[dst] = lv_means_[kmer];
+                o.lv_vars_x2[dst] = lv_vars_x2_[kmer];
+                o.lognorm_denoms[dst] = lognorm_denoms_[kmer];
+            }
+
+            o.sorted_means.assign(sorted_means_, sorted_means_ + kmer_count_);
+            o.sorted_kmers.resize(kmer_count_);
+            for (u32 i = 0; i < kmer_count_; i++) {
+                u32 kmer = sorted_kmers_[i];
+                o.sorted_kmers[i] = flip ? kmer_comp<KLEN>(kmer) : kmer;
+            }
+
+            init_stats(o, c == 1);
+        }
+
+        return arrs;
+    }
+
+    template <typename T>
+    static void write_array(std::ostream &out, const std::vector<T> &arr) {
+        out.write((const char *) arr.data(), arr.size() * sizeof(T));
+    }
+
+    //Literals for generated presets, floats print enough digits to
+    //read back exactly
+    static std::string literal(float v) {
+        char s[32];
+        snprintf(s, sizeof(s), "%.9gf", v);
+        return s;
+    }
 
-        kmer_count_ = kmer_count<KLEN>();
+    static std::string literal(u32 v) {
+        return std::to_string(v);
+    }
+
+    template <typename T>
+    static void write_preset_array(std::ostream &out, const std::string &name, 
+                                   const std::vector<T> &arr) {
+        out << "\nalignas(64) constexpr " 
+            << (std::is_same<T, float>::value ? "float " : "u32 ") 
+            << name << "[] = {";
+        for (u32 i = 0; i < arr.size(); i++) {
+            out << (i % 8 == 0 ? "\n    " : " ") << literal(arr[i]) 
+                << (i+1 < arr.size() ? "," : "");
+        }
+        out << "\n};\n";
+    }
 
-        lv_means_.resize(kmer_count_);
-        lv_vars_x2_.resize(kmer_count_);
-        lognorm_denoms_.resize(kmer_count_);
+    public:
+
+    PoreModel() 
+        :  lv_means_(NULL), 
+           lv_vars_x2_(NULL),
+           lognorm_denoms_(NULL),
+           model_mean_(0),
+           model_stdv_(0),
+           kmer_count_(kmer_count<KLEN>()),
+           loaded_(false),
+           complement_(false),
+           sorted_kmers_(NULL),
+           sorted_means_(NULL),
+           lut_bins_(0) {}
+
+    //Built-in model, uses the preset's arrays in place
+    PoreModel(const ModelPreset &p, bool cmpl) : PoreModel() {
+        complement_ = cmpl;
+        init_preset(p);
     }
     
-    //PoreModel(const ModelPreset &p, bool cmpl) : PoreModel() {
     PoreModel(const std::vector<float> &means_stdvs, bool cmpl) 
         : PoreModel() {
 
-        //if (p.k != KLEN) return;
+        complement_ = cmpl;
 
-        model_mean_ = 0;
+        std::vector<float> means(kmer_count_), stdvs(kmer_count_);
 
-        u16 kmer = 0;
-        for (u32 i = 0; i < means_stdvs.size(); i += 2) {
-            float mean = means_stdvs[i],
-                  stdv = means_stdvs[i+1];
-
-            if (cmpl) {
-                init_kmer(kmer_comp<KLEN>(kmer), mean, stdv);
-            } else { 
-                init_kmer(kmer, mean, stdv);
-            }
-            
+        u32 kmer = 0;
+        for (u32 i = 0; i+1 < means_stdvs.size() && kmer < kmer_count_; i += 2) {
+            u32 k = cmpl ? kmer_comp<KLEN>(kmer) : kmer;
+            means[k] = means_stdvs[i];
+            stdvs[k] = means_stdvs[i+1];
             kmer++;
-            model_mean_ += mean;
         }
 
-        model_mean_ /= kmer_count_;
-        init_stdv();
-
-        loaded_ = true;
+        init_arrays(means, stdvs);
     }
 
-    //TODO: clean up IO
-    //maybe load from toml and/or header file
-    //make scripts for model to toml and header?
+    //Loads a binary model (see write_binary) or a text model with a 
+    //header line, then one k-mer, level mean and stdv per line
     PoreModel(const std::string &model_fname, bool cmpl) : PoreModel () {
 
+        complement_ = cmpl;
+
+        if (is_binary(model_fname)) {
+            load_binary(model_fname, cmpl);
+            return;
+        }
+
         std::ifstream model_in(model_fname);
+        if (!model_in.is_open()) {
+            std::cerr << "Error: failed to open model \"" << model_fname << "\"\n";
+            return;
+        }
 
         std::string _;
         std::getline(model_in, _);
 
         //Variables for reading model
-        std::string kmer_str, neighbor_kmer;
-        u16 kmer;
+        std::string kmer_str;
+        u32 kmer;
         float lv_mean, lv_stdv;
 
-        model_mean_ = 0;
+        std::vector<float> means(kmer_count_), stdvs(kmer_count_);
 
         //Read and store rest of the model
         for (u32 i = 0; i < kmer_count_; i++) {
-        //while (!model_in.eof()) {
-        //
-            if (model_in.eof()) {
+            if (!(model_in >> kmer_str >> lv_mean >> lv_stdv)) {
                 std::cerr << "Error: ran out of k-mers\n";
                 return;
             }
 
-            model_in >> kmer_str >> lv_mean >> lv_stdv; 
-
-            std::cerr << "setting "
-                      << kmer_str << " "
-                      << lv_mean << " "
-                      << lv_stdv << "\n";
-
             //Get unique ID for the kmer
             kmer = str_to_kmer<KLEN>(kmer_str);
 
@@ -148,24 +382,130 @@ class PoreModel {
                 kmer = kmer_comp<KLEN>(kmer);
             }
 
-            init_kmer(kmer, lv_mean, lv_stdv);
+            means[kmer] = lv_mean;
+            stdvs[kmer] = lv_stdv;
+        }
+
+        init_arrays(means, stdvs);
+    }
 
-            model_mean_ += lv_mean;
+    //Writes the model in both orientations, to be mapped by the 
+    //loading constructor
+    bool write_binary(const std::string &fname) const {
+        std::ofstream out(fname, std::ios::binary);
+        if (!out.is_open()) return false;
+
+        PoreModelHeader h;
+        memset(&h, 0, sizeof(h));
+        memcpy(h.magic, PORE_MODEL_MAGIC, sizeof(h.magic));
+        h.version = PORE_MODEL_VERSION;
+        h.k = KLEN;
+
+        auto arrs = get_oriented_arrays();
+        for (u32 c = 0; c < 2; c++) {
+            h.model_means[c] = arrs[c].model_mean;
+            h.model_stdvs[c] = arrs[c].model_stdv;
+        }
+        out.write((const char *) &h, sizeof(h));
+
+        for (const Arrays &a : arrs) {
+            write_array(out, a.lv_means);
+            write_array(out, a.lv_vars_x2);
+            write_array(out, a.lognorm_denoms);
+            write_array(out, a.sorted_means);
+            write_array(out, a.sorted_kmers);
         }
 
-        //Compute model level mean and stdv
-        model_mean_ /= kmer_count_;
-        init_stdv();
+        return out.good();
+    }
 
-        loaded_ = true;
+    //Writes a header defining constexpr arrays for both orientations 
+    //and ModelPresets named MODEL_<NAME>_TEMPLATE/COMPLEMENT, which 
+    //load with no parsing or math at startup
+    void write_preset(std::ostream &out, const std::string &name) const {
+        const std::array<std::string, 2> ORIENTS = {{"TEMPLATE", "COMPLEMENT"}};
+
+        std::string upper(name);
+        for (char &c : upper) c = toupper(c);
+
+        auto arrs = get_oriented_arrays();
+
+        out << "//Generated by uncalled_model, do not edit\n\n"
+            << "#ifndef _INCL_MODEL_" << upper << "\n"
+            << "#define _INCL_MODEL_" << upper << "\n\n"
+            << "#include \"pore_model.hpp\"\n";
+
+        for (u32 c = 0; c < 2; c++) {
+            std::string prefix = "MODEL_" + upper + "_" + ORIENTS[c];
+
+            write_preset_array(out, prefix + "_MEANS", arrs[c].lv_means);
+            write_preset_array(out, prefix + "_VARS_X2", arrs[c].lv_vars_x2);
+            write_preset_array(out, prefix + "_LOGNORM_DENOMS", arrs[c].lognorm_denoms);
+            write_preset_array(out, prefix + "_SORTED_MEANS", arrs[c].sorted_means);
+            write_preset_array(out, prefix + "_SORTED_KMERS", arrs[c].sorted_kmers);
+
+            out << "\nconstexpr ModelPreset " << prefix << " = {\n"
+                << "    " << KLEN << ", " << literal(arrs[c].model_mean) 
+                <<              ", " << literal(arrs[c].model_stdv) << ",\n"
+                << "    " << prefix << "_MEANS, " << prefix << "_VARS_X2,\n"
+                << "    " << prefix << "_LOGNORM_DENOMS, " << prefix << "_SORTED_MEANS,\n"
+                << "    " << prefix << "_SORTED_KMERS\n"
+                << "};\n";
+        }
+
+        out << "\nconst PoreModel<KmerLen::k" << KLEN << "> \n"
+            << "    pmodel_" << name << "_template(MODEL_" << upper << "_TEMPLATE, false);\n\n"
+            << "const PoreModel<KmerLen::k" << KLEN << "> \n"
+            << "    pmodel_" << name << "_complement(MODEL_" << upper << "_COMPLEMENT, true);\n\n"
+            << "#endif\n";
     }
 
-    float match_prob(float samp, u16 kmer) const {
-        return (-pow(samp - lv_means_[kmer], 2) / lv_vars_x2_[kmer]) - lognorm_denoms_[kmer];
+    //Precomputes match_prob for bins levels spanning win beyond the
+    //lowest and highest k-mer means. Levels outside that range map to a 
+    //row of -inf, so win should be get_window() of the lowest probability 
+    //match_prob is compared to
+    void init_prob_lut(u32 bins, float win) {
+        lut_bins_ = bins;
+        lut_min_ = sorted_means_[0] - win;
+
+        float lut_max = sorted_means_[kmer_count_-1] + win;
+        lut_scale_ = (bins - 1) / (lut_max - lut_min_);
+
+        prob_lut_.resize((u64) (bins + 1) * kmer_count_);
+
+        for (u32 b = 0; b < bins; b++) {
+            float samp = lut_min_ + b / lut_scale_;
+            float *row = &prob_lut_[(u64) b * kmer_count_];
+            for (u32 kmer = 0; kmer < kmer_count_; kmer++) {
+                row[kmer] = match_prob(samp, kmer);
+            }
+        }
+
+        std::fill(prob_lut_.begin() + (u64) bins * kmer_count_, 
+                  prob_lut_.end(), -INFINITY);
+    }
+
+    bool has_prob_lut() const {
+        return lut_bins_ > 0;
+    }
+
+    //Row of match probabilities for the nearest precomputed level
+    const float *get_prob_row(float samp) const {
+        float b = (samp - lut_min_) * lut_scale_ + 0.5f;
+
+        //Also false for NaN
+        if (!(b >= 0 && b < lut_bins_)) {
+            b = lut_bins_;
+        }
+
+        return &prob_lut_[(u64) b * kmer_count_];
     }
 
+    float match_prob(float samp, u32 kmer) const {
+        return (-pow(samp - lv_means_[kmer], 2) / lv_vars_x2_[kmer]) - lognorm_denoms_[kmer];
+    }
     //TODO should be able to overload
-    float match_prob_evt(const Event &evt, u16 kmer) const {
+    float match_prob_evt(const Event &evt, u32 kmer) const {
         return match_prob(evt.mean, kmer);
     }
 
@@ -177,10 +517,42 @@ class PoreModel {
         return model_stdv_;
     }
 
-    float get_mean(u16 kmer) const {
+    float get_mean(u32 kmer) const {
         return lv_means_[kmer];
     }
 
+    float get_stdv(u32 kmer) const {
+        return sqrt(lv_vars_x2_[kmer] / 2);
+    }
+
+    u32 get_kmer_count() const {
+        return kmer_count_;
+    }
+
+    //Largest distance between an event and a k-mer's mean level where 
+    //match_prob can still be at least prob_thresh
+    float get_window(float prob_thresh) const {
+        float win = 0;
+        for (u32 kmer = 0; kmer < kmer_count_; kmer++) {
+            float d2 = lv_vars_x2_[kmer] * (-prob_thresh - lognorm_denoms_[kmer]);
+            if (d2 > 0) win = std::max(win, (float) sqrt(d2));
+        }
+        return win;
+    }
+
+    //Range [st, en) of sorted k-mers with means within win of samp
+    std::pair<u32, u32> get_sorted_range(float samp, float win) const {
+        const float *end = sorted_means_ + kmer_count_,
+                    *st = std::lower_bound(sorted_means_, end, samp - win),
+                    *en = std::upper_bound(st, end, samp + win);
+        return {st - sorted_means_, en - sorted_means_};
+    }
+
+    //K-mer at position i in order of mean level
+    u32 get_sorted_kmer(u32 i) const {
+        return sorted_kmers_[i];
+    }
+
     bool is_loaded() const {
         return loaded_;
     }
@@ -195,6 +567,7 @@ class PoreModel {
         PY_PORE_MODEL_METH(get_means_mean);
         PY_PORE_MODEL_METH(get_means_stdv);
         PY_PORE_MODEL_METH(get_mean);
+        PY_PORE_MODEL_METH(get_stdv);
     }
 
     #endif
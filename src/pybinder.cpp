@@ -3,8 +3,10 @@
 #include <pybind11/stl.h>
 #include "map_pool.hpp"
 #include "self_align_ref.hpp"
+#include "kmer_masker.hpp"
 #include "realtime_pool.hpp"
 #include "client_sim.hpp"
+#include "squiggle_sim.hpp"
 #include "model_r94.inl"
 #include "dtw.hpp"
 
@@ -20,15 +22,36 @@ PYBIND11_MODULE(_uncalled, m) {
     py::class_<MapPool> map_pool(m, "MapPool");
     MapPool::pybind_defs(map_pool);
 
+    py::class_<MapEngine> map_engine(m, "MapEngine");
+    MapEngine::pybind_defs(map_engine);
+
     py::class_<RealtimePool> realtime_pool(m, "RealtimePool");
     RealtimePool::pybind_defs(realtime_pool);
 
     py::class_<ClientSim> client_sim(m, "ClientSim");
     ClientSim::pybind_defs(client_sim);
 
+    py::class_<SquiggleSim> squiggle_sim(m, "SquiggleSim");
+    SquiggleSim::pybind_defs(squiggle_sim);
+
     py::class_<Paf> paf(m, "Paf");
     Paf::pybind_defs(paf);
 
+    py::class_<PafWriter> paf_writer(m, "PafWriter");
+    PafWriter::pybind_defs(paf_writer);
+
+    py::class_<IndexPresets> index_presets(m, "IndexPresets");
+    IndexPresets::pybind_defs(index_presets);
+
+    py::class_<SignalSketch> signal_sketch(m, "SignalSketch");
+    SignalSketch::pybind_defs(signal_sketch);
+
+    py::class_<KmerMasker> kmer_masker(m, "KmerMasker");
+    KmerMasker::pybind_defs(kmer_masker);
+
+    py::class_<IndexBuilder> index_builder(m, "IndexBuilder");
+    IndexBuilder::pybind_defs(index_builder);
+
     py::class_<BwaIndex<KLEN>> bwa_index(m, "BwaIndex");
     BwaIndex<KLEN>::pybind_defs(bwa_index);
 
@@ -56,7 +79,15 @@ PYBIND11_MODULE(_uncalled, m) {
     m.attr("pmodel_r94_template") = py::cast(pmodel_r94_template);
     m.attr("pmodel_r94_complement") = py::cast(pmodel_r94_complement);
 
-    m.def("self_align", &self_align);
+    m.def("self_align", &self_align, 
+          "bwa_prefix"_a, "sample_dist"_a, "threads"_a=1, "seed"_a=0);
+
+    py::class_<SelfAlignHist> sa_hist(m, "SelfAlignHist");
+    sa_hist.def_readonly("len_counts", &SelfAlignHist::len_counts);
+    sa_hist.def_readonly("fm_len_counts", &SelfAlignHist::fm_len_counts);
+    m.def("self_align_hist", &self_align_hist, 
+          "bwa_prefix"_a, "sample_dist"_a, "kmer_len"_a, "max_len"_a, 
+          "threads"_a=1, "seed"_a=0);
 
     //BP operation functions
     m.def("kmer_count",    &kmer_count<KLEN>);
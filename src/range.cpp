@@ -21,6 +21,8 @@
  * SOFTWARE.
  */
 
+#include <algorithm>
+#include <type_traits>
 #include "range.hpp"
 
 size_t max(size_t a, size_t b) {
@@ -31,30 +33,30 @@ size_t min(size_t a, size_t b) {
     return a < b ? a : b;
 }
 
-Range::Range(const Range &prev)
-    : start_(prev.start_), 
-      end_(prev.end_) {}
+template <typename T>
+RangeT<T>::RangeT(T start, T end) : start_(start), end_(end) {}
 
-Range::Range(size_t start, size_t end) : start_(start), end_(end) {}
+template <typename T>
+RangeT<T>::RangeT() : start_(1), end_(0) {}
 
-
-Range::Range() : start_(1), end_(0) {}
-
-bool Range::intersects(const Range &q) const {
+template <typename T>
+bool RangeT<T>::intersects(const RangeT &q) const {
     return is_valid() && q.is_valid() &&
            !(start_ > q.end_ || end_ < q.start_) &&
            !(q.start_ > end_ || q.end_ < start_);
 }
 
-size_t Range::length() const {
+template <typename T>
+T RangeT<T>::length() const {
     return end_ - start_ + 1;
 }
 
-Range Range::split_range(const Range &r) { 
+template <typename T>
+RangeT<T> RangeT<T>::split_range(const RangeT &r) { 
 
-    Range left;
+    RangeT left;
     if (start_ < r.start_) {
-        left = Range(*this);
+        left = RangeT(*this);
         left.end_ = r.start_ - 1;
     }
 
@@ -70,23 +72,26 @@ Range Range::split_range(const Range &r) {
     return left;
 }
 
-Range Range::intersect(const Range &r) const {
+template <typename T>
+RangeT<T> RangeT<T>::intersect(const RangeT &r) const {
     if (!intersects(r)) {
-        return Range();
+        return RangeT();
     }
     
-    return Range(max(start_, r.start_), min(end_, r.end_));
+    return RangeT(std::max(start_, r.start_), std::min(end_, r.end_));
 }
 
-Range Range::merge(const Range &r) const {
+template <typename T>
+RangeT<T> RangeT<T>::merge(const RangeT &r) const {
     if (!intersects(r)) {
-        return Range();
+        return RangeT();
     }
 
-    return Range(min(start_, r.start_), max(end_, r.end_));
+    return RangeT(std::min(start_, r.start_), std::max(end_, r.end_));
 }
 
-float Range::get_recp_overlap(const Range &r) const {
+template <typename T>
+float RangeT<T>::get_recp_overlap(const RangeT &r) const {
     if (!intersects(r)) {
         return 0;
     }
@@ -94,26 +99,19 @@ float Range::get_recp_overlap(const Range &r) const {
     return float(intersect(r).length()) / float(merge(r).length());
 }
 
-Range& Range::operator=(const Range& prev) {
-    start_ = prev.start_;
-    end_ = prev.end_;
-    return *this;
-}
-
-
-bool Range::same_range(const Range &q) const {
+template <typename T>
+bool RangeT<T>::same_range(const RangeT &q) const {
     return start_ == q.start_ && end_ == q.end_;
 }
 
-bool Range::is_valid() const {
+template <typename T>
+bool RangeT<T>::is_valid() const {
     return start_ <= end_;
 }
 
-bool operator< (const Range &q1, const Range &q2) {
-    return q1.start_ < q2.start_ ||
-           (q1.start_ == q2.start_ && q1.end_ < q2.end_);
-}
+template class RangeT<u64>;
+template class RangeT<u32>;
 
-bool operator== (const Range &q1, const Range &q2) {
-    return q1.start_ == q2.start_ && q1.end_ == q2.end_;
-}
+static_assert(std::is_trivially_copyable<Range>::value &&
+              std::is_trivially_copyable<Range32>::value,
+              "Ranges must be trivially copyable");
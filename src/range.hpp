@@ -31,40 +31,52 @@ u64 max(u64 a, u64 b);
 
 u64 min(u64 a, u64 b);
 
-class Range {
+//Closed interval of FM index or reference coordinates
+//Coordinate width is a template parameter so paths in indexes under
+//2^32 bases can use 32-bit ranges (see Mapper::PathBuffer)
+//Trivially copyable, so arrays of ranges can be moved with memcpy
+template <typename T>
+class RangeT {
     
     public:
-    u64 start_, end_; 
+    T start_, end_; 
 
-    //Copy constructor
-    Range(const Range &prev);
+    RangeT(T start, T end);
 
-    Range(u64 start, u64 end);
+    RangeT();
 
-    Range();
+    //Converts between coordinate widths
+    template <typename U>
+    explicit RangeT(const RangeT<U> &r) : start_(r.start_), end_(r.end_) {}
 
-    Range& operator=(const Range &r);
+    RangeT split_range(const RangeT &r);
 
-    Range split_range(const Range &r);
+    RangeT intersect(const RangeT &r) const;
 
-    Range intersect(const Range &r) const;
+    RangeT merge(const RangeT &r) const;
 
-    Range merge(const Range &r) const;
+    float get_recp_overlap(const RangeT &r) const;
 
-    float get_recp_overlap(const Range &r) const;
+    bool same_range(const RangeT &r) const;
 
-    bool same_range(const Range &r) const;
-
-    bool intersects(const Range &r) const;
+    bool intersects(const RangeT &r) const;
 
     bool is_valid() const;
 
-    u64 length() const;
+    T length() const;
+
+    friend bool operator< (const RangeT &q1, const RangeT &q2) {
+        return q1.start_ < q2.start_ ||
+               (q1.start_ == q2.start_ && q1.end_ < q2.end_);
+    }
 
-    friend bool operator< (const Range &q1, const Range &q2);
+    friend bool operator== (const RangeT &q1, const RangeT &q2) {
+        return q1.start_ == q2.start_ && q1.end_ == q2.end_;
+    }
 };
 
-bool operator< (const Range &q1, const Range &q2);
-bool operator== (const Range &q1, const Range &q2);
+//Instantiated in range.cpp
+typedef RangeT<u64> Range;
+typedef RangeT<u32> Range32;
 
 #endif
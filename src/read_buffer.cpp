@@ -21,6 +21,8 @@
  * SOFTWARE.
  */
 
+#include <cstring>
+#include <type_traits>
 #include "read_buffer.hpp"
 
 ReadBuffer::Params ReadBuffer::PRMS = {
@@ -31,6 +33,8 @@ ReadBuffer::Params ReadBuffer::PRMS = {
     max_chunks   : 1000000,
 };
 
+std::mutex ReadBuffer::HDF5_MTX;
+
 const std::string Paf::PAF_TAGS[] = {
     "mt", //MAP_TIME
     "wt", //WAIT_TIME
@@ -46,14 +50,33 @@ const std::string Paf::PAF_TAGS[] = {
     "kp", //KEEP
     "dl", //DELAY
     "sc", //SEED_CLUSTER
-    "ce"  //CONFIDENT_EVENT
+    "ce", //CONFIDENT_EVENT
+    "ix", //INDEX
+    "ne", //EVENTS
+    "np", //PATHS
+    "nr", //RANKS
+    "ns", //SA_LOOKUPS
+    "nd", //SEEDS
+    "nc", //CLUSTERS
+    "mp", //MAX_PATHS
+    "hs"  //HOST
 };
 
+std::mutex Paf::STRS_MTX;
+std::deque<std::string> Paf::STRS;
+std::unordered_map<std::string, u32> Paf::STR_IDS;
+
+static_assert(std::is_trivially_copyable<Paf>::value, 
+              "Paf should copy without allocating");
+
+static_assert(Paf::NUM_TAGS <= 32, "Paf tag masks are 32 bits");
+
 Paf::Paf() 
     : is_mapped_(false),
       ended_(false),
-      rd_name_(""),
-      rf_name_(""),
+      long_rd_name_(false),
+      rd_name_id_(0),
+      rf_id_(0),
       rd_st_(0),
       rd_en_(0),
       rd_len_(0),
@@ -61,26 +84,67 @@ Paf::Paf()
       rf_en_(0),
       rf_len_(0),
       fwd_(false),
-      matches_(0) {}
+      matches_(0),
+      int_mask_(0),
+      float_mask_(0),
+      str_mask_(0) {
+    rd_name_[0] = '\0';
+}
 
 Paf::Paf(const std::string &rd_name, u16 channel, u64 start_sample)
-    : is_mapped_(false),
-      ended_(false),
-      rd_name_(rd_name),
-      rf_name_(""),
-      rd_st_(0),
-      rd_en_(0),
-      rd_len_(0),
-      rf_st_(0),
-      rf_en_(0),
-      rf_len_(0),
-      fwd_(false),
-      matches_(0) {
-    
+    : Paf() {
+    set_rd_name(rd_name);
     set_int(Tag::CHANNEL, channel);
     set_int(Tag::READ_START, start_sample);
 }
 
+//Long names are rare, so interning them costs little memory and keeps
+//every name intact without records allocating
+void Paf::set_rd_name(const std::string &rd_name) {
+    long_rd_name_ = rd_name.size() > RD_NAME_MAX;
+
+    if (long_rd_name_) {
+        rd_name_id_ = intern(rd_name);
+        rd_name_[0] = '\0';
+    } else {
+        memcpy(rd_name_, rd_name.data(), rd_name.size());
+        rd_name_[rd_name.size()] = '\0';
+    }
+}
+
+const char *Paf::get_rd_name(size_t &len) const {
+    if (long_rd_name_) {
+        const std::string &name = get_str(rd_name_id_);
+        len = name.size();
+        return name.data();
+    }
+    len = strlen(rd_name_);
+    return rd_name_;
+}
+
+u32 Paf::intern(const std::string &str) {
+    std::lock_guard<std::mutex> lock(STRS_MTX);
+
+    auto it = STR_IDS.find(str);
+    if (it != STR_IDS.end()) return it->second;
+
+    u32 id = STRS.size();
+    STRS.push_back(str);
+    STR_IDS[str] = id;
+    return id;
+}
+
+//Deque elements don't move when strings are added
+const std::string &Paf::get_str(u32 id) {
+    std::lock_guard<std::mutex> lock(STRS_MTX);
+    return STRS[id];
+}
+
+u32 Paf::str_count() {
+    std::lock_guard<std::mutex> lock(STRS_MTX);
+    return STRS.size();
+}
+
 bool Paf::is_mapped() const {
     return is_mapped_;
 }
@@ -89,45 +153,239 @@ bool Paf::is_ended() const {
     return ended_;
 }
 
+bool Paf::is_host() const {
+    return is_mapped_ && (int_mask_ & (1 << HOST)) && int_tags_[HOST];
+}
+
 void Paf::print_paf() const {
-    std::cout << rd_name_ << "\t"
-       << rd_len_ << "\t";
+    std::string out;
+    write_text(out);
+    std::cout << out;
+}
+
+void Paf::write_text(std::string &out) const {
+    size_t name_len;
+    const char *name = get_rd_name(name_len);
+    out.append(name, name_len);
+    out.push_back('\t');
+    fmt_uint(out, rd_len_);
+
     if (is_mapped_) {
-       std::cout 
-           << rd_st_ << "\t"
-           << rd_en_ << "\t"
-           << (fwd_ ? '+' : '-') << "\t"
-           << rf_name_ << "\t"
-           << rf_len_ << "\t"
-           << rf_st_ << "\t"
-           << rf_en_ << "\t"
-           << matches_ << "\t"
-           << (rf_en_ - rf_st_ + 1) << "\t"
-           << 255;
+        out.push_back('\t'); fmt_uint(out, rd_st_);
+        out.push_back('\t'); fmt_uint(out, rd_en_);
+        out.push_back('\t'); out.push_back(fwd_ ? '+' : '-');
+        out.push_back('\t'); out.append(get_str(rf_id_));
+        out.push_back('\t'); fmt_uint(out, rf_len_);
+        out.push_back('\t'); fmt_uint(out, rf_st_);
+        out.push_back('\t'); fmt_uint(out, rf_en_);
+        out.push_back('\t'); fmt_uint(out, matches_);
+        out.push_back('\t'); fmt_uint(out, rf_en_ - rf_st_ + 1);
+        out.append("\t255");
     } else {
-        std::cout << "*" << "\t"
-           << "*" << "\t"
-           << "*" << "\t"
-           << "*" << "\t"
-           << "*" << "\t"
-           << "*" << "\t"
-           << "*" << "\t"
-           << "*" << "\t"
-           << "*" << "\t"
-           << "255";
+        out.append("\t*\t*\t*\t*\t*\t*\t*\t*\t*\t255");
     }
 
-    for (auto t : int_tags_) { 
-        std::cout << std::fixed << "\t" << PAF_TAGS[t.first] << ":i:" << t.second;
+    for (u8 t = 0; t < NUM_TAGS; t++) {
+        if (!(int_mask_ & (1 << t))) continue;
+        out.push_back('\t');
+        out.append(PAF_TAGS[t]);
+        out.append(":i:");
+        fmt_int(out, int_tags_[t]);
     }
-    for (auto t : float_tags_) { 
-        std::cout << std::fixed << "\t" << PAF_TAGS[t.first] << ":f:" << t.second;
+    for (u8 t = 0; t < NUM_TAGS; t++) {
+        if (!(float_mask_ & (1 << t))) continue;
+        out.push_back('\t');
+        out.append(PAF_TAGS[t]);
+        out.append(":f:");
+        fmt_float(out, float_tags_[t]);
     }
-    for (auto t : str_tags_) { 
-        std::cout << "\t" << PAF_TAGS[t.first] << ":Z:" << t.second;
+    for (u8 t = 0; t < NUM_TAGS; t++) {
+        if (!(str_mask_ & (1 << t))) continue;
+        out.push_back('\t');
+        out.append(PAF_TAGS[t]);
+        out.append(":Z:");
+        out.append(get_str(str_tags_[t]));
     }
 
-    std::cout << "\n";
+    out.push_back('\n');
+}
+
+//Binary records are stored in host byte order:
+//u32 record length (excluding itself), u8 flags, then either
+//  String record (BIN_STR): u32 id, string
+//  Alignment: read name, u64 read length, mapped fields (if mapped),
+//  u32 int tag mask + values, u32 float tag mask + values,
+//  u32 string tag mask + string ids
+//Strings are stored as u16 length + characters, and each interned
+//string's record precedes the first alignment that uses it
+
+enum {BIN_MAPPED = 1, BIN_ENDED = 2, BIN_FWD = 4, BIN_STR = 8};
+
+template <typename T>
+static void put_bin(std::string &out, T v) {
+    out.append(reinterpret_cast<const char *>(&v), sizeof(T));
+}
+
+static void put_bin(std::string &out, const char *v, u16 len) {
+    put_bin<u16>(out, len);
+    out.append(v, len);
+}
+
+template <typename T>
+static bool get_bin(const char *&in, const char *end, T &v) {
+    if (end - in < (i64) sizeof(T)) return false;
+    memcpy(&v, in, sizeof(T));
+    in += sizeof(T);
+    return true;
+}
+
+static bool get_bin(const char *&in, const char *end, std::string &v) {
+    u16 len;
+    if (!get_bin(in, end, len) || end - in < len) return false;
+    v.assign(in, len);
+    in += len;
+    return true;
+}
+
+void Paf::write_binary_str(std::string &out, u32 id) {
+    const std::string &str = get_str(id);
+
+    put_bin<u32>(out, sizeof(u8) + sizeof(u32) + sizeof(u16) + str.size());
+    put_bin<u8>(out, BIN_STR);
+    put_bin<u32>(out, id);
+    put_bin(out, str.data(), str.size());
+}
+
+i64 Paf::max_str_id() const {
+    i64 ret = is_mapped_ ? (i64) rf_id_ : -1;
+    for (u8 t = 0; t < NUM_TAGS; t++) {
+        if ((str_mask_ & (1 << t)) && str_tags_[t] > ret) {
+            ret = str_tags_[t];
+        }
+    }
+    return ret;
+}
+
+void Paf::write_binary(std::string &out) const {
+    size_t st = out.size();
+    put_bin<u32>(out, 0);
+
+    put_bin<u8>(out, (is_mapped_ ? BIN_MAPPED : 0) | 
+                     (ended_ ? BIN_ENDED : 0) | 
+                     (fwd_ ? BIN_FWD : 0));
+    size_t name_len;
+    const char *name = get_rd_name(name_len);
+    put_bin(out, name, name_len);
+    put_bin<u64>(out, rd_len_);
+
+    if (is_mapped_) {
+        put_bin<u64>(out, rd_st_);
+        put_bin<u64>(out, rd_en_);
+        put_bin<u32>(out, rf_id_);
+        put_bin<u64>(out, rf_len_);
+        put_bin<u64>(out, rf_st_);
+        put_bin<u64>(out, rf_en_);
+        put_bin<u16>(out, matches_);
+    }
+
+    put_bin<u32>(out, int_mask_);
+    for (u8 t = 0; t < NUM_TAGS; t++) {
+        if (int_mask_ & (1 << t)) put_bin<i32>(out, int_tags_[t]);
+    }
+
+    put_bin<u32>(out, float_mask_);
+    for (u8 t = 0; t < NUM_TAGS; t++) {
+        if (float_mask_ & (1 << t)) put_bin<float>(out, float_tags_[t]);
+    }
+
+    put_bin<u32>(out, str_mask_);
+    for (u8 t = 0; t < NUM_TAGS; t++) {
+        if (str_mask_ & (1 << t)) put_bin<u32>(out, str_tags_[t]);
+    }
+
+    u32 len = out.size() - st - sizeof(u32);
+    memcpy(&out[st], &len, sizeof(len));
+}
+
+//Parses string records and one alignment, advancing in past each
+//record parsed. Returns false if the next record is truncated or malformed
+bool Paf::read_binary(const char *&in, const char *end, 
+                      std::vector<u32> &str_ids) {
+    *this = Paf();
+
+    while (true) {
+        const char *rec = in;
+        u32 len;
+        if (!get_bin(rec, end, len) || end - rec < len) return false;
+        const char *rec_end = rec + len;
+
+        u8 flags;
+        if (!get_bin(rec, rec_end, flags)) return false;
+
+        if (flags & BIN_STR) {
+            u32 id;
+            std::string str;
+            if (!get_bin(rec, rec_end, id) || 
+                !get_bin(rec, rec_end, str)) return false;
+
+            if (id >= str_ids.size()) str_ids.resize(id+1, 0);
+            str_ids[id] = intern(str);
+
+            in = rec_end;
+            continue;
+        }
+
+        u16 name_len;
+        if (!get_bin(rec, rec_end, name_len) || rec_end - rec < name_len) {
+            return false;
+        }
+        set_rd_name(std::string(rec, name_len));
+        rec += name_len;
+
+        if (!get_bin(rec, rec_end, rd_len_)) return false;
+
+        is_mapped_ = flags & BIN_MAPPED;
+        ended_ = flags & BIN_ENDED;
+        fwd_ = flags & BIN_FWD;
+
+        if (is_mapped_) {
+            if (!(get_bin(rec, rec_end, rd_st_) &&
+                  get_bin(rec, rec_end, rd_en_) &&
+                  get_bin(rec, rec_end, rf_id_) &&
+                  get_bin(rec, rec_end, rf_len_) &&
+                  get_bin(rec, rec_end, rf_st_) &&
+                  get_bin(rec, rec_end, rf_en_) &&
+                  get_bin(rec, rec_end, matches_)) ||
+                rf_id_ >= str_ids.size()) return false;
+            rf_id_ = str_ids[rf_id_];
+        }
+
+        if (!get_bin(rec, rec_end, int_mask_)) return false;
+        int_mask_ &= (1 << NUM_TAGS) - 1;
+        for (u8 t = 0; t < NUM_TAGS; t++) {
+            if ((int_mask_ & (1 << t)) && 
+                !get_bin(rec, rec_end, int_tags_[t])) return false;
+        }
+
+        if (!get_bin(rec, rec_end, float_mask_)) return false;
+        float_mask_ &= (1 << NUM_TAGS) - 1;
+        for (u8 t = 0; t < NUM_TAGS; t++) {
+            if ((float_mask_ & (1 << t)) && 
+                !get_bin(rec, rec_end, float_tags_[t])) return false;
+        }
+
+        if (!get_bin(rec, rec_end, str_mask_)) return false;
+        str_mask_ &= (1 << NUM_TAGS) - 1;
+        for (u8 t = 0; t < NUM_TAGS; t++) {
+            if (!(str_mask_ & (1 << t))) continue;
+            if (!get_bin(rec, rec_end, str_tags_[t]) || 
+                str_tags_[t] >= str_ids.size()) return false;
+            str_tags_[t] = str_ids[str_tags_[t]];
+        }
+
+        in = rec_end;
+        return true;
+    }
 }
 
 void Paf::set_read_len(u64 rd_len) {
@@ -140,13 +398,13 @@ void Paf::set_ended() {
 }
 
 void Paf::set_mapped(u64 rd_st, u64 rd_en,
-                          std::string rf_name,
+                          u32 rf_id,
                           u64 rf_st, u64 rf_en, u64 rf_len,
                           bool fwd, u16 matches) {
     is_mapped_ = true;
     rd_st_ = rd_st;
     rd_en_ = rd_en;
-    rf_name_ = rf_name;
+    rf_id_ = rf_id;
     rf_st_ = rf_st;
     rf_en_ = rf_en;
     rf_len_ = rf_len;
@@ -155,15 +413,22 @@ void Paf::set_mapped(u64 rd_st, u64 rd_en,
 }
 
 void Paf::set_int(Tag t, int v) {
-    int_tags_.emplace_back(t, v);
+    int_mask_ |= 1 << t;
+    int_tags_[t] = v;
 }
 
 void Paf::set_float(Tag t, float v) {
-    float_tags_.emplace_back(t, v);
+    float_mask_ |= 1 << t;
+    float_tags_[t] = v;
+}
+
+float Paf::get_float(Tag t) const {
+    return (float_mask_ & (1 << t)) ? float_tags_[t] : 0;
 }
 
 void Paf::set_str(Tag t, std::string v) {
-    str_tags_.emplace_back(t, v);
+    str_mask_ |= 1 << t;
+    str_tags_[t] = intern(v);
 }
 
 
@@ -185,9 +450,23 @@ void ReadBuffer::swap(ReadBuffer &r) {
     std::swap(chunk_count_, r.chunk_count_);
     std::swap(chunk_processed_, r.chunk_processed_);
     std::swap(loc_, r.loc_);
+    std::swap(fast5_name_, r.fast5_name_);
+    std::swap(sig_path_, r.sig_path_);
+    std::swap(sig_len_, r.sig_len_);
+    std::swap(sig_loaded_, r.sig_loaded_);
+    std::swap(sig_file_, r.sig_file_);
+    std::swap(sig_dset_, r.sig_dset_);
+    std::swap(cal_digit_, r.cal_digit_);
+    std::swap(cal_range_, r.cal_range_);
+    std::swap(cal_offset_, r.cal_offset_);
 }
 
 void ReadBuffer::clear() {
+    close_signal();
+    fast5_name_.clear();
+    sig_path_.clear();
+    sig_len_ = sig_loaded_ = 0;
+
     raw_len_ = 0;
     full_signal_.clear();
     chunk_.clear();
@@ -197,7 +476,8 @@ void ReadBuffer::clear() {
 
 ReadBuffer::ReadBuffer(const hdf5_tools::File &file, 
                        const std::string &raw_path, 
-                       const std::string &ch_path) {
+                       const std::string &ch_path,
+                       bool stream_signal) {
 
     for (auto a : file.get_attr_map(raw_path)) {
         if (a.first == "read_id") {
@@ -209,20 +489,33 @@ ReadBuffer::ReadBuffer(const hdf5_tools::File &file,
         }
     }
 
-	float cal_digit = 1, cal_range = 1, cal_offset = 0;
     for (auto a : file.get_attr_map(ch_path)) {
         if (a.first == "channel_number") {
             channel_idx_ = atoi(a.second.c_str()) - 1;
         } else if (a.first == "digitisation") {
-            cal_digit = atof(a.second.c_str());
+            cal_digit_ = atof(a.second.c_str());
         } else if (a.first == "range") {
-            cal_range = atof(a.second.c_str());
+            cal_range_ = atof(a.second.c_str());
         } else if (a.first == "offset") {
-            cal_offset = atof(a.second.c_str());
+            cal_offset_ = atof(a.second.c_str());
         }
     }
 
     std::string sig_path = raw_path + "/Signal";
+
+    if (stream_signal) {
+        fast5_name_ = file.file_name();
+        sig_path_ = sig_path;
+        chunk_count_ = 0;
+        chunk_processed_ = true;
+        loc_ = Paf(id_, get_channel(), start_sample_);
+
+        //Only get signal length, Fast5Reader holds HDF5_MTX
+        set_raw_len(0);
+        if (open_signal()) close_handles();
+        return;
+    }
+
     std::vector<i16> int_data; 
     file.read(sig_path, int_data);
 
@@ -237,7 +530,7 @@ ReadBuffer::ReadBuffer(const hdf5_tools::File &file,
 
     //full_signal_.assign(int_data.begin(), int_data.end());
     for (u16 raw : int_data) {
-		float calibrated = (cal_range * raw / cal_digit) + cal_offset;
+		float calibrated = (cal_range_ * raw / cal_digit_) + cal_offset_;
         full_signal_.push_back(calibrated);
     }
 
@@ -260,6 +553,23 @@ ReadBuffer::ReadBuffer(Chunk &first_chunk)
     first_chunk.pop(chunk_);
 }
 
+ReadBuffer::ReadBuffer(const std::string &id, u16 channel, u32 number, 
+                       u64 start_sample, const std::vector<float> &signal)
+    : channel_idx_(channel-1),
+      id_(id),
+      number_(number),
+      start_sample_(start_sample),
+      full_signal_(signal),
+      chunk_processed_(false),
+      loc_(id_, channel, start_sample_) {
+
+    u64 max_len = (u64) PRMS.max_chunks * PRMS.chunk_len();
+    if (full_signal_.size() > max_len) full_signal_.resize(max_len);
+
+    chunk_count_ = (full_signal_.size() / PRMS.chunk_len()) + (full_signal_.size() % PRMS.chunk_len() != 0);
+    set_raw_len(full_signal_.size());
+}
+
 void ReadBuffer::set_raw_len(u64 raw_len) {
     raw_len_ = raw_len;
     loc_.set_read_len(raw_len_ * PRMS.bp_per_samp());
@@ -280,7 +590,116 @@ bool ReadBuffer::add_chunk(Chunk &c) {
 }
 
 bool ReadBuffer::empty() const {
-    return full_signal_.empty() && chunk_.empty();
+    return full_signal_.empty() && chunk_.empty() && !is_streamed();
+}
+
+//Opens streamed signal dataset, caller must hold HDF5_MTX
+bool ReadBuffer::open_signal() {
+    if (sig_dset_ >= 0) return true;
+
+    sig_file_ = H5Fopen(fast5_name_.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (sig_file_ < 0) {
+        std::cerr << "Error: failed to open \"" << fast5_name_ << "\"\n";
+        return false;
+    }
+
+    sig_dset_ = H5Dopen2(sig_file_, sig_path_.c_str(), H5P_DEFAULT);
+    if (sig_dset_ < 0) {
+        std::cerr << "Error: failed to open \"" << sig_path_ 
+                  << "\" in \"" << fast5_name_ << "\"\n";
+        close_handles();
+        return false;
+    }
+
+    hsize_t len = 0;
+    hid_t space = H5Dget_space(sig_dset_);
+    H5Sget_simple_extent_dims(space, &len, NULL);
+    H5Sclose(space);
+
+    sig_len_ = std::min<u64>(len, (u64) PRMS.max_chunks * PRMS.chunk_len());
+    set_raw_len(sig_len_);
+
+    return true;
+}
+
+//Reads and calibrates len samples starting at st, caller must hold HDF5_MTX
+bool ReadBuffer::read_signal(u64 st, u64 len, std::vector<float> &out) {
+    hsize_t h_st = st, h_len = len;
+
+    std::vector<i16> int_data(len);
+
+    hid_t file_space = H5Dget_space(sig_dset_),
+          mem_space = H5Screate_simple(1, &h_len, NULL);
+    H5Sselect_hyperslab(file_space, H5S_SELECT_SET, &h_st, NULL, &h_len, NULL);
+
+    herr_t err = H5Dread(sig_dset_, H5T_NATIVE_INT16, mem_space, 
+                         file_space, H5P_DEFAULT, int_data.data());
+
+    H5Sclose(mem_space);
+    H5Sclose(file_space);
+
+    if (err < 0) {
+        std::cerr << "Error: failed to read signal for '" << id_ << "'\n";
+        return false;
+    }
+
+    out.clear();
+    out.reserve(len);
+    for (u16 raw : int_data) {
+		float calibrated = (cal_range_ * raw / cal_digit_) + cal_offset_;
+        out.push_back(calibrated);
+    }
+
+    return true;
+}
+
+//Closes signal dataset, caller must hold HDF5_MTX
+void ReadBuffer::close_handles() {
+    if (sig_dset_ >= 0) H5Dclose(sig_dset_);
+    if (sig_file_ >= 0) H5Fclose(sig_file_);
+    sig_dset_ = sig_file_ = -1;
+}
+
+//Loads next chunk of a streamed read into chunk_
+//Returns false if all signal (up to max_chunks) has been loaded
+bool ReadBuffer::load_chunk() {
+    std::lock_guard<std::mutex> lock(HDF5_MTX);
+
+    if (!is_streamed() || sig_loaded_ >= sig_len_) return false;
+
+    u64 len = std::min<u64>(PRMS.chunk_len(), sig_len_ - sig_loaded_);
+
+    if (!open_signal() || !read_signal(sig_loaded_, len, chunk_)) {
+        sig_loaded_ = sig_len_;
+        return false;
+    }
+
+    sig_loaded_ += len;
+    chunk_count_++;
+    chunk_processed_ = false;
+
+    return true;
+}
+
+//Loads all signal of a streamed read into full_signal_
+bool ReadBuffer::load_signal() {
+    if (!is_streamed()) return !full_signal_.empty();
+
+    std::lock_guard<std::mutex> lock(HDF5_MTX);
+
+    bool ret = open_signal() && read_signal(0, sig_len_, full_signal_);
+    close_handles();
+
+    chunk_count_ = (sig_len_ / PRMS.chunk_len()) + (sig_len_ % PRMS.chunk_len() != 0);
+
+    return ret;
+}
+
+void ReadBuffer::close_signal() {
+    if (sig_file_ < 0) return;
+
+    std::lock_guard<std::mutex> lock(HDF5_MTX);
+    close_handles();
 }
 
 u16 ReadBuffer::get_channel() const {
@@ -27,6 +27,9 @@
 #include <string>
 #include <vector>
 #include <unordered_set>
+#include <unordered_map>
+#include <deque>
+#include <mutex>
 #include <fast5/hdf5_tools.hpp>
 #include "util.hpp"
 #include "chunk.hpp"
@@ -53,29 +56,80 @@ class Paf {
         KEEP,
         DELAY,
         SEED_CLUSTER,
-        CONFIDENT_EVENT
+        CONFIDENT_EVENT,
+        INDEX,
+
+        //Work counters, see MapCounters
+        EVENTS,
+        PATHS,
+        RANKS,
+        SA_LOOKUPS,
+        SEEDS,
+        CLUSTERS,
+        MAX_PATHS,
+
+        //Set if mapped to a host index, see Mapper::RefIndex
+        HOST,
+
+        NUM_TAGS
     };
 
+    //Longest read name stored in the record, longer names are interned
+    static const u16 RD_NAME_MAX = 63;
+
     Paf();
     Paf(const std::string &rd_name, u16 channel = 0, u64 start_sample = 0);
 
+    //Interned strings (reference names and string tags)
+    //Added at index load time, so records only store u32 ids
+    static u32 intern(const std::string &str);
+    static const std::string &get_str(u32 id);
+    static u32 str_count();
+
     bool is_mapped() const;
     bool is_ended() const;
+
+    //Mapped to an index whose reads are always ejected
+    bool is_host() const;
     void print_paf() const;
+
+    //Appends PAF line to output buffer
+    void write_text(std::string &out) const;
+
+    //Appends/parses record in binary PAF format (see PafWriter)
+    //Interned string ids in the input are mapped through str_ids, which 
+    //is filled from string records preceding the alignment
+    void write_binary(std::string &out) const;
+    bool read_binary(const char *&in, const char *end, 
+                     std::vector<u32> &str_ids);
+
+    //Binary record defining an interned string
+    static void write_binary_str(std::string &out, u32 id);
+
+    //Largest interned string id used by this record, -1 if none
+    i64 max_str_id() const;
+
     void set_read_len(u64 rd_len);
     void set_mapped(u64 rd_st, u64 rd_en, 
-                    std::string rf_name,
+                    u32 rf_id,
                     u64 rf_st, u64 rf_en, u64 rf_len,
                     bool fwd, u16 matches);
     void set_ended();
     void set_unmapped();
 
+    //Tags are stored in fixed arrays, setting one twice overwrites it
+    //String values are interned, so records hold only their ids
     void set_int(Tag t, int v);
     void set_float(Tag t, float v);
     void set_str(Tag t, std::string v);
 
-    std::string get_rd_name() {
-        return rd_name_;
+    //Zero if the tag isn't set
+    float get_float(Tag t) const;
+
+    std::string get_rd_name() const {
+        size_t len;
+        const char *name = get_rd_name(len);
+        return std::string(name, len);
     }
 
     #ifdef PYBIND
@@ -87,9 +141,11 @@ class Paf {
         PY_PAF_METH(print_paf);
         PY_PAF_METH(is_mapped);
         PY_PAF_METH(is_ended);
+        PY_PAF_METH(is_host);
         PY_PAF_METH(set_int);
         PY_PAF_METH(set_float);
         PY_PAF_METH(set_str);
+        PY_PAF_METH(get_float);
 
         pybind11::enum_<Paf::Tag> t(c, "Tag");
         PY_PAF_TAG(MAP_TIME);
@@ -98,6 +154,8 @@ class Paf {
         PY_PAF_TAG(ENDED);
         PY_PAF_TAG(KEEP);
         PY_PAF_TAG(DELAY);
+        PY_PAF_TAG(INDEX);
+        PY_PAF_TAG(HOST);
         t.export_values();
     }
 
@@ -106,16 +164,30 @@ class Paf {
     private:
     static const std::string PAF_TAGS[];
 
-    bool is_mapped_, ended_;
-    std::string rd_name_, rf_name_;
+    static std::mutex STRS_MTX;
+    static std::deque<std::string> STRS;
+    static std::unordered_map<std::string, u32> STR_IDS;
+
+    void set_rd_name(const std::string &rd_name);
+    const char *get_rd_name(size_t &len) const;
+
+    //Only fixed size fields, so records copy without allocating
+    //Read names over RD_NAME_MAX are stored by interned id instead
+    bool is_mapped_, ended_, long_rd_name_;
+    char rd_name_[RD_NAME_MAX+1];
+    u32 rd_name_id_;
+    u32 rf_id_;
     u64 rd_st_, rd_en_, rd_len_,
         rf_st_, rf_en_, rf_len_;
     bool fwd_;
     u16 matches_;
 
-    std::vector< std::pair<Tag, int> > int_tags_;
-    std::vector< std::pair<Tag, float> > float_tags_;
-    std::vector< std::pair<Tag, std::string> > str_tags_;
+    //Tags stored by index, set bits mark which are present
+    //String tag values are interned ids
+    u32 int_mask_, float_mask_, str_mask_;
+    i32 int_tags_[NUM_TAGS];
+    float float_tags_[NUM_TAGS];
+    u32 str_tags_[NUM_TAGS];
 };
 
 class ReadBuffer {
@@ -142,10 +214,17 @@ class ReadBuffer {
     //TODO private outside Fast5Reader (friend?)
     ReadBuffer();
     ReadBuffer(const std::string &filename);
-    ReadBuffer(const hdf5_tools::File &file, const std::string &raw_path, const std::string &ch_path);
+    ReadBuffer(const hdf5_tools::File &file, 
+               const std::string &raw_path, 
+               const std::string &ch_path,
+               bool stream_signal=false);
     
     ReadBuffer(Chunk &first_chunk);
 
+    //Read with signal already in memory, e.g. from SquiggleSim
+    ReadBuffer(const std::string &id, u16 channel, u32 number, 
+               u64 start_sample, const std::vector<float> &signal);
+
     bool empty() const;
     std::string get_id() const {return id_;}
     u64 get_start() const;
@@ -169,6 +248,17 @@ class ReadBuffer {
     void set_channel(u16 ch) {channel_idx_ = ch-1;}
     u16 get_channel_idx() const;
 
+    //Streamed reads only store where their signal is in the fast5 and
+    //load it one chunk at a time with load_chunk(), into chunk_,
+    //or all at once with load_signal(), into full_signal_
+    bool is_streamed() const {return !sig_path_.empty();}
+    bool load_chunk();
+    bool load_signal();
+    void close_signal();
+
+    //HDF5 may not be built thread-safe, so all fast5 access is serialized
+    static std::mutex HDF5_MTX;
+
     u32 get_number() const {
         return number_;
     }
@@ -210,7 +300,18 @@ class ReadBuffer {
 
     Paf loc_;
 
+    //Location of streamed signal and how much has been loaded
+    std::string fast5_name_, sig_path_;
+    u64 sig_len_ = 0, sig_loaded_ = 0;
+    hid_t sig_file_ = -1, sig_dset_ = -1;
+    float cal_digit_ = 1, cal_range_ = 1, cal_offset_ = 0;
+
     friend bool operator< (const ReadBuffer &r1, const ReadBuffer &r2);
+
+    private:
+    bool open_signal();
+    bool read_signal(u64 st, u64 len, std::vector<float> &out);
+    void close_handles();
 };
 
 bool operator< (const ReadBuffer &r1, const ReadBuffer &r2);
@@ -37,25 +37,55 @@
 //    max_active_reads = 512
 //};
 
-RealtimePool::RealtimePool(Conf &conf) :
-    PRMS(conf.realtime_prms),
-    stopped_(false) {
+RealtimePool::RealtimePool(Conf &conf) : 
+    RealtimePool(conf, (MapEngine *) NULL) {}
+
+RealtimePool::RealtimePool(Conf &conf, MapEngine &engine) : 
+    RealtimePool(conf, &engine) {}
 
-    for (u16 t = 0; t < conf.threads; t++) {
-        threads_.emplace_back(mappers_);
+RealtimePool::RealtimePool(Conf &conf, MapEngine *engine) :
+    PRMS(conf.realtime_prms),
+    own_engine_(engine == NULL ? new MapEngine(conf) : NULL),
+    engine_(engine == NULL ? *own_engine_ : *engine),
+    engine_id_(engine_.add_pool()),
+    stopped_(false),
+    active_count_(0),
+    events_mapped_(0) {
+
+    mappers_.resize(PRMS.max_active_reads);
+
+    //Mapper params aren't per pool, so a pool with different ones
+    //would silently change how every other pool maps
+    if (!Mapper::check_static()) {
+        abort();
+    }
+    free_mappers_.reserve(mappers_.size());
+    for (u32 m = mappers_.size()-1; m < mappers_.size(); m--) {
+        free_mappers_.push_back(m);
     }
 
-    mappers_.resize(conf.get_num_channels());
+    chs_mappers_.resize(conf.get_num_channels(), NO_MAPPER);
     chunk_buffer_.resize(conf.get_num_channels());
     buffer_queue_.reserve(conf.get_num_channels());
     active_queue_.reserve(conf.get_num_channels());
 
-
-    for (u16 t = 0; t < conf.threads; t++) {
-        threads_[t].start();
+    u32 seed = conf.sim_prms.seed;
+    srand(seed != 0 ? seed : time(NULL));
+
+    if (!PRMS.chunk_trace.empty()) {
+        ChunkTrace::Header h = {
+            num_channels     : conf.get_num_channels(),
+            max_active_reads : PRMS.max_active_reads,
+            realtime_mode    : (u8) PRMS.realtime_mode,
+            chunk_time       : conf.get_chunk_time(),
+            sample_rate      : conf.get_sample_rate()
+        };
+        trace_.reset(new ChunkTrace::Writer(PRMS.chunk_trace, h));
     }
+}
 
-    srand(time(NULL));
+RealtimePool::~RealtimePool() {
+    stop_all();
 }
 
 void RealtimePool::buffer_chunk(Chunk &c) {
@@ -70,72 +100,107 @@ void RealtimePool::buffer_chunk(Chunk &c) {
 }
 
 
+//Check out a mapper from the pool and start mapping a new read
+//Returns false if all mappers are in use
+bool RealtimePool::start_read(Chunk &c) {
+    if (free_mappers_.empty()) return false;
+
+    u32 m = free_mappers_.back();
+    free_mappers_.pop_back();
+
+    chs_mappers_[c.get_channel_idx()] = m;
+    mappers_[m].new_read(c);
+    active_queue_.push_back(&mappers_[m]);
+
+    return true;
+}
+
+//Return a finished mapper to the pool
+void RealtimePool::release_mapper(u32 m) {
+    u16 ch = mappers_[m].get_read().get_channel_idx();
+    if (chs_mappers_[ch] == m) {
+        chs_mappers_[ch] = NO_MAPPER;
+    }
+
+    //TODO rename set_inactive?
+    mappers_[m].deactivate();
+    free_mappers_.push_back(m);
+}
+
 //Add chunk to master buffer
 bool RealtimePool::add_chunk(Chunk &c) {
+    if (trace_) trace_->write_chunk(ChunkTrace::Type::ADD_CHUNK, c);
+
     u16 ch = c.get_channel_idx();
+    u32 m = chs_mappers_[ch];
+
+    //No mapper assigned - need to check one out of the pool
+    //Store chunk in pool buffer if none are free, or if an
+    //earlier chunk is already waiting for one
+    if (m == NO_MAPPER) {
+        if (!chunk_buffer_[ch].empty() || !start_read(c)) {
+            buffer_chunk(c);
+        }
+        return true;
+    }
+
+    Mapper &mapper = mappers_[m];
 
     //Check if previous read is still aligning
     //If so, tell thread to reset, store chunk in pool buffer
-    if (mappers_[ch].prev_unfinished(c.get_number())) {
-        mappers_[ch].request_reset();
+    if (mapper.prev_unfinished(c.get_number())) {
+        mapper.request_reset();
         buffer_chunk(c);
         return true;
 
-    //Previous alignment finished but mapper hasn't reset
+    //Previous alignment finished but mapper hasn't been released
     //Happens if update hasn't been called yet
-    } else if (mappers_[ch].finished()) {
-        if (mappers_[ch].get_read().number_ != c.get_number()){ 
+    } else if (mapper.finished()) {
+        if (mapper.get_read().number_ != c.get_number()){ 
             buffer_chunk(c);
         }
         return true;
-
-    //Mapper inactive - need to reset graph and assign to thread
-    } else if (mappers_[ch].get_state() == Mapper::State::INACTIVE) {
-        mappers_[ch].new_read(c);
-        active_queue_.push_back(ch);
-        return true;
-
     }
     
-    return mappers_[ch].add_chunk(c);
-    
-
-    return false;
+    return mapper.add_chunk(c);
 }
 
 bool RealtimePool::is_read_finished(const ReadBuffer &r) {
-    u16 ch = r.get_channel_idx();
-    return (mappers_[ch].finished() && 
-            mappers_[ch].get_read().get_number() == r.get_number());
+    u32 m = chs_mappers_[r.get_channel_idx()];
+    return (m != NO_MAPPER &&
+            mappers_[m].finished() && 
+            mappers_[m].get_read().get_number() == r.get_number());
 }
 
 bool RealtimePool::try_add_chunk(Chunk &c) {
-    u16 ch = c.get_channel_idx();
+    if (trace_) trace_->write_chunk(ChunkTrace::Type::TRY_ADD_CHUNK, c);
+
+    u32 m = chs_mappers_[c.get_channel_idx()];
 
     //Chunk is empty if all read chunks were output
     if (c.empty()) {
 
         //Give up if previous chunk done mapping
-        if (mappers_[ch].chunk_mapped() && !mappers_[ch].finished()) {
-            mappers_[ch].request_reset();
+        if (m != NO_MAPPER && 
+            mappers_[m].chunk_mapped() && 
+            !mappers_[m].finished()) {
+            mappers_[m].request_reset();
         }
         return false;
     }
 
-    //Start new read if mapper inactive
-    if (mappers_[ch].get_state() == Mapper::State::INACTIVE) {
-        mappers_[ch].new_read(c);
-        active_queue_.push_back(ch);
-        return true;
+    //Start new read if no mapper assigned
+    if (m == NO_MAPPER) {
+        return start_read(c);
 
-    } else if (mappers_[ch].get_read().number_ == c.get_number()) {
+    } else if (mappers_[m].get_read().number_ == c.get_number()) {
 
         //Don't add if previous chunk is still mapping
-        if (!mappers_[ch].chunk_mapped()) {
+        if (!mappers_[m].chunk_mapped()) {
             return false;
         }
 
-        return mappers_[ch].add_chunk(c);
+        return mappers_[m].add_chunk(c);
     }
 
     return false;
@@ -144,34 +209,21 @@ bool RealtimePool::try_add_chunk(Chunk &c) {
 //TODO: make sure update is the same
 std::vector<MapResult> RealtimePool::update() {
 
-    std::vector< u16 > read_counts(threads_.size(), 0);
-    active_count_ = 0;
     std::vector<MapResult> ret;
 
     //Get alignment outputs
-    for (u16 t = 0; t < threads_.size(); t++) {
-        if (!threads_[t].out_chs_.empty()) {
-
-            //Store and empty thread output buffer
-            threads_[t].out_mtx_.lock();
-            out_chs_.swap(threads_[t].out_chs_);
-            threads_[t].out_mtx_.unlock();
-
-            //Loop over alignments
-            for (auto ch : out_chs_) {
-                ReadBuffer &r = mappers_[ch].get_read();
-                ret.emplace_back(r.get_channel(), r.number_, r.loc_);
-
-                //TODO rename set_inactive?
-                mappers_[ch].deactivate();
-            }
-            out_chs_.clear();
-        }
-
-        //Count reads aligning in each thread
-        read_counts[t] = threads_[t].read_count();
-        active_count_ += read_counts[t];
+    engine_.get_finished(engine_id_, out_mappers_);
+    ret.reserve(out_mappers_.size());
+    for (Mapper *mapper : out_mappers_) {
+        ReadBuffer &r = mapper->get_read();
+        ret.emplace_back(r.get_channel(), r.number_, r.loc_);
+        events_mapped_ += mapper->events_mapped();
+        release_mapper(mapper - mappers_.data());
     }
+    active_count_ -= out_mappers_.size();
+    out_mappers_.clear();
+
+    if (trace_) trace_->write_update(ret.size());
 
     //Buffer queue should be ordered in "ord" mode
     for (u16 i = buffer_queue_.size()-1; i < buffer_queue_.size(); i--) {
@@ -179,13 +231,12 @@ std::vector<MapResult> RealtimePool::update() {
         Chunk &c = chunk_buffer_[ch];
 
         bool added = false;
+        u32 m = chs_mappers_[ch];
 
-        if (mappers_[ch].get_state() == Mapper::State::INACTIVE) {
-            mappers_[ch].new_read(c);
-            active_queue_.push_back(ch);
-            added = true;
-        } else if (!mappers_[ch].finished()) {
-            added = mappers_[ch].add_chunk(c);
+        if (m == NO_MAPPER) {
+            added = start_read(c);
+        } else if (!mappers_[m].finished()) {
+            added = mappers_[m].add_chunk(c);
         }
 
         if (added) {
@@ -196,66 +247,12 @@ std::vector<MapResult> RealtimePool::update() {
         }
     }
 
-    #ifdef DEBUG_THREADS
-    //TODO user defined refresh
-    if (time_.get() >= 500 && active_count_ > 0) {
-        std::cout << "#prefill_threads " 
-                  << active_count_;
-        for (u16 c : read_counts) std::cout << " " << c;
-        std::cout << "\n";
-        std::cout.flush();
-    }
-    #endif
-
-    //Estimate how much to fill each thread
-    u16 target = min(active_queue_.size() + active_count_, PRMS.max_active_reads);
-
-    u16 min_per_thread = target / threads_.size(), // + (target % threads_.size() > 0);
-        remain = target % threads_.size();
-
-    for (u32 c : read_counts) remain -= (c > min_per_thread);
-
-    u16 st = (u16) rand();
-
-    for (u16 i = 0; i < threads_.size(); i++) {
-        if (active_queue_.empty()) break;
-
-        u16 t = (st+i) % threads_.size();
-
-        u32 n = min_per_thread + (remain > 0) - read_counts[t];
-
-        //If thread not full
-        if (n > 0 && n <= active_queue_.size()) {
-            u32 r0 = active_queue_.size() - n,
-                rn = active_queue_.size();
-
-            threads_[t].in_mtx_.lock();
-
-            std::vector<u16> &in_chs = threads_[t].in_chs_;
-            in_chs.insert(in_chs.end(),
-                          &(active_queue_[r0]),
-                          &(active_queue_[rn]));
-
-            threads_[t].in_mtx_.unlock();
-
-            active_queue_.resize(r0);
-            remain -= (remain > 0);
-
-            read_counts[t] += n;
-            active_count_ += n;
-        }
-    }
-
-    #ifdef DEBUG_THREADS
-    if (time_.get() >= 500 && active_count_ > 0) {
-        time_.reset();
-        std::cout << "#pstfill_threads "
-                  << active_count_;
-        for (u16 c : read_counts) std::cout << " " << c;
-        std::cout << "\n";
-        std::cout.flush();
+    //Send new reads to engine threads
+    if (!active_queue_.empty()) {
+        engine_.add_mappers(engine_id_, active_queue_);
+        active_count_ += active_queue_.size();
+        active_queue_.clear();
     }
-    #endif
 
     return ret;
 }
@@ -264,127 +261,65 @@ u32 RealtimePool::active_count() const {
     return active_count_;
 }
 
+u64 RealtimePool::events_mapped() const {
+    return events_mapped_;
+}
+
+bool RealtimePool::set_preset(const std::string &name, u16 index) {
+    return Mapper::set_preset(name, index);
+}
+
 //void u32 ReadBuffer::end_read(u16 ch, u32 number) {
 //    ch--;
 //    if (!mappers_[ch].finished() && mappers_[ch].get_read()
 //}
 
 bool RealtimePool::all_finished() {
-    if (!buffer_queue_.empty()) return false;
+    return buffer_queue_.empty() && 
+           active_queue_.empty() && 
+           active_count_ == 0;
+}
 
-    for (MapperThread &t : threads_) {
-        if (t.read_count() > 0 || !t.out_chs_.empty()) return false;
+bool RealtimePool::is_idle() {
+    //Buffered chunks can only wait if no mappers are free
+    if (!active_queue_.empty() || 
+        (!buffer_queue_.empty() && !free_mappers_.empty())) {
+        return false;
     }
 
-    return true;
-}
-
-void RealtimePool::stop_all() {
-    if (!stopped_) {
-        stopped_ = true;
-        for (MapperThread &t : threads_) {
-            t.running_ = false;
-            t.thread_.join();
+    for (Mapper &m : mappers_) {
+        if (m.get_state() != Mapper::State::INACTIVE && !m.is_waiting()) {
+            return false;
         }
-
-        active_queue_.clear();
-        buffer_queue_.clear();
     }
-}
-
-u16 RealtimePool::MapperThread::num_threads = 0;
 
-RealtimePool::MapperThread::MapperThread(std::vector<Mapper> &mappers)
-    : tid_(num_threads++),
-      mappers_(mappers),
-      running_(true) {}
-
-RealtimePool::MapperThread::MapperThread(MapperThread &&mt) 
-    : tid_(mt.tid_),
-      mappers_(mt.mappers_),
-      running_(mt.running_), 
-      thread_(std::move(mt.thread_)) {}
-
-void RealtimePool::MapperThread::start() {
-    thread_ = std::thread(&RealtimePool::MapperThread::run, this);
-}
-
-
-u16 RealtimePool::MapperThread::read_count() const {
-    return in_chs_.size() + active_chs_.size();
+    return true;
 }
 
-void RealtimePool::MapperThread::run() {
-    std::string fast5_id;
-    std::vector<float> fast5_signal;
-
-    std::vector<u16> finished;
-
-    Timer t;
-
-    while (running_) {
-        if (read_count() == 0) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-            continue;
-        }
-
-        //Read inputs (pop, lock, and swap it)
-        if (!in_chs_.empty()) {
-
-
-            in_mtx_.lock();
-            in_tmp_.swap(in_chs_);
-            in_mtx_.unlock();
-
-
-            for (auto ch : in_tmp_) {
-                active_chs_.push_back(ch);
-            }
-
-            in_tmp_.clear(); //(pop)
-        }
-
-        //TODO: reads are in here
-        //Map chunks
-        for (u16 i = 0; i < active_chs_.size() && running_; i++) {
-            u16 ch = active_chs_[i];
-
+void RealtimePool::stop_all() {
+    if (stopped_) return;
+    stopped_ = true;
 
-            mappers_[ch].process_chunk();
+    if (own_engine_) {
+        own_engine_->stop();
 
-            if (mappers_[ch].map_chunk()) {
-                out_tmp_.push_back(i);
+    //Engine is shared, reset reads still mapping and wait to get
+    //them back so no thread is left pointing at this pool's mappers
+    } else {
+        for (Mapper &m : mappers_) {
+            if (m.get_state() == Mapper::State::MAPPING) {
+                m.request_reset();
             }
         }
 
-        //Add finished to output
-        if (!out_tmp_.empty()) {
-
-            t.reset();
-
-            out_mtx_.lock();
-            for (auto i : out_tmp_) {
-                out_chs_.push_back(active_chs_[i]);
-            }
-            out_mtx_.unlock();
-
-            std::sort(out_tmp_.begin(), out_tmp_.end(),
-                      [](u32 a, u32 b) { return a > b; });
-            for (auto i : out_tmp_) {
-                active_chs_[i] = active_chs_.back();
-                active_chs_.pop_back();
-            }
-            out_tmp_.clear();
+        while (active_count_ > 0 && !engine_.is_stopped()) {
+            engine_.get_finished(engine_id_, out_mappers_);
+            active_count_ -= out_mappers_.size();
+            out_mappers_.clear();
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
         }
     }
 
-    active_chs_.clear();
-
-    in_mtx_.lock();
-    in_chs_.clear();
-    in_mtx_.unlock();
-
-    out_mtx_.lock();
-    out_chs_.clear();
-    out_mtx_.unlock();
+    active_queue_.clear();
+    buffer_queue_.clear();
 }
@@ -27,8 +27,12 @@
 #include <thread>
 #include <vector>
 #include <deque>
+#include <climits>
+#include <memory>
 #include "mapper.hpp"
+#include "map_engine.hpp"
 #include "conf.hpp"
+#include "chunk_trace.hpp"
 
 using MapResult = std::tuple<u16, u32, Paf>;
 
@@ -38,7 +42,14 @@ class RealtimePool {
     //static Params const PRMS_DEF;
     RealtimeParams PRMS;
 
+    //Pool with its own mapping threads
     RealtimePool(Conf &conf);
+
+    //Pool sharing threads with other pools, e.g. for multiple flow cells
+    //Each pool has its own channels, mappers, and realtime parameters
+    RealtimePool(Conf &conf, MapEngine &engine);
+
+    ~RealtimePool();
     
     bool add_chunk(Chunk &chunk);
     bool try_add_chunk(Chunk &chunk);
@@ -49,10 +60,22 @@ class RealtimePool {
 
     std::vector<MapResult> update();
     bool all_finished();
+
+    //True if all chunks added so far have been mapped and all finished 
+    //reads have been returned by update(). Used to step virtual time
+    bool is_idle();
     void stop_all(); //TODO: just name stop
 
     u32 active_count() const; 
 
+    //Total events mapped by reads returned from update()
+    u64 events_mapped() const;
+
+    //Switches the threshold preset of an index (0 is the main index) for
+    //reads started after this call. Indexes are shared, so this affects
+    //all pools in the process
+    bool set_preset(const std::string &name, u16 index=0);
+
     #ifdef PYBIND
 
     #define PY_REALTIME_METH(P) c.def(#P, &RealtimePool::P);
@@ -62,11 +85,16 @@ class RealtimePool {
 
     static void pybind_defs(pybind11::class_<RealtimePool> &c) {
         c.def(pybind11::init<Conf &>());
+        c.def(pybind11::init<Conf &, MapEngine &>(), 
+              pybind11::keep_alive<1, 3>());
         PY_REALTIME_METH(add_chunk);
         PY_REALTIME_METH(try_add_chunk);
         PY_REALTIME_METH(update);
         PY_REALTIME_METH(all_finished);
+        PY_REALTIME_METH(is_idle);
         PY_REALTIME_METH(stop_all);
+        c.def("set_preset", &RealtimePool::set_preset, 
+              pybind11::arg("name"), pybind11::arg("index") = 0);
 
         pybind11::class_<RealtimeParams> p(c, "RealtimeParams");
         PY_REALTIME_PRM(host);
@@ -92,52 +120,46 @@ class RealtimePool {
 
     private:
 
-    class MapperThread {
-        public:
-        MapperThread(std::vector<Mapper> &mappers);
-        MapperThread(MapperThread &&mt);
-
-        void start();
-        void stop();
-
-        void run();
-
-        u16 read_count() const;
-
-        static u16 num_threads;
-        u16 tid_;
-
-        std::vector<Mapper> &mappers_;
+    static const u32 NO_MAPPER = UINT_MAX;
 
-        bool running_;
-
-        //Corrasponding inputs/output
-        std::vector< u16 > in_chs_, in_tmp_, 
-                           out_chs_, out_tmp_,
-                           active_chs_;
-        std::mutex in_mtx_, out_mtx_;
+    void buffer_chunk(Chunk &c);
+    bool start_read(Chunk &c);
+    void release_mapper(u32 m);
 
-        std::thread thread_;
+    RealtimePool(Conf &conf, MapEngine *engine);
 
-        float mtx_time_;
-    };
-
-    void buffer_chunk(Chunk &c);
+    //Set if pool created its own engine
+    std::unique_ptr<MapEngine> own_engine_;
+    MapEngine &engine_;
+    u16 engine_id_;
 
     bool stopped_;
 
+    //Number of mappers handed to the engine and not yet returned
     u32 active_count_;
 
-    //List of mappers - one for each channel
+    u64 events_mapped_;
+
+    //Pool of max_active_reads mappers, shared by all channels
+    //Checked out by start_read, returned by release_mapper
     std::vector<Mapper> mappers_;
-    std::vector<MapperThread> threads_;
+    std::vector<u32> free_mappers_;
+
+    //Index of mapper assigned to each channel, or NO_MAPPER
+    std::vector<u32> chs_mappers_;
+
     std::vector<Chunk> chunk_buffer_;
 
-    std::vector<u16> buffer_queue_, out_chs_, active_queue_;
+    std::vector<u16> buffer_queue_;
+    std::vector<Mapper *> out_mappers_, active_queue_;
     //std::deque<u16> ;
     //std::vector<u16> active_queue_;
 
     Timer time_;
+
+    //Set if recording a chunk trace
+    std::unique_ptr<ChunkTrace::Writer> trace_;
+
     //Store threads in order of # active mappers
 };
 
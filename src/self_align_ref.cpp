@@ -23,70 +23,169 @@
 
 #include <iostream>
 #include <string>
-#include <list>
-#include <cstdlib>
+#include <thread>
+#include <atomic>
 #include "range.hpp"
 #include "bwa_index.hpp"
 #include "self_align_ref.hpp"
 
 const KmerLen KLEN = KmerLen::k5;
 
+//Positions are aligned in blocks, which threads take in turn
+const u64 BLOCK_LEN = 1 << 20;
+
+typedef struct {
+    u64 seq_st, seq_len, st, en;
+} Block;
+
+//splitmix64, so sampling needs no shared RNG state
+inline bool is_sampled(u64 pos, u32 sample_dist, u64 seed) {
+    u64 z = pos + seed + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z = z ^ (z >> 31);
+    return z % sample_dist == 0;
+}
+
+std::vector<Block> get_blocks(const BwaIndex<KLEN> &fmi) {
+    std::vector<Block> blocks;
+    u64 seq_st = 0;
+    for (auto &s : fmi.get_seqs()) {
+        u64 len = s.second;
+        for (u64 st = 0; st < len; st += BLOCK_LEN) {
+            blocks.push_back({seq_st, len, st, std::min(st + BLOCK_LEN, len)});
+        }
+        seq_st += len;
+    }
+    return blocks;
+}
+
+//Aligns sampled positions of one block, calling fn(path) for each
+template <typename F>
+void align_block(BwaIndex<KLEN> &fmi, const Block &b, u32 sample_dist, 
+                 u64 seed, std::vector<u64> &path, F fn) {
+
+    u64 st = b.seq_st;
+
+    for (u64 i = b.st; i < b.en; i++) {
+        if (!is_sampled(st + i, sample_dist, seed)) continue;
+
+        path.clear();
+
+        //TODO: start with kmers, not bases
+        Range r = fmi.get_base_range(BASE_COMP_B[fmi.get_base(st+i)]);
+        u64 j = i+1;
+        for (; j < b.seq_len && r.length() > 1 ; j++) {
+            path.push_back(r.length());
+            r = fmi.get_neighbor(r, BASE_COMP_B[fmi.get_base(st+j)]);
+        }
+        //Happens on Ns
+        if (r.length() > 0) {
+            path.push_back(r.length());
+        }
+
+        fn(path);
+    }
+}
+
+//Runs align_block on all blocks across threads
+//fn(thread, block, path) is called for each path
+template <typename F>
+void align_blocks(BwaIndex<KLEN> &fmi, const std::vector<Block> &blocks,
+                  u32 sample_dist, u16 threads, u64 seed, F fn) {
+
+    std::atomic<u64> next_block(0);
+
+    auto run = [&](u16 t) {
+        std::vector<u64> path;
+        u64 b;
+        while ((b = next_block++) < blocks.size()) {
+            align_block(fmi, blocks[b], sample_dist, seed, path, 
+                        [&](const std::vector<u64> &p) {fn(t, b, p);});
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (u16 t = 1; t < threads; t++) {
+        workers.emplace_back(run, t);
+    }
+    run(0);
+
+    for (auto &w : workers) w.join();
+}
+
 std::vector< std::vector<u64> > self_align(const std::string &bwa_prefix,
-                                           u32 sample_dist) {
-
-    srand(0);
-
-    BwaIndex<KLEN> fmi(bwa_prefix);
-
-    //std::vector< std::vector<u8> > seqs;
-    //std::ifstream fasta_in(fasta_fname);
-    //std::string fasta_line;
-    //while (getline(fasta_in, fasta_line)) {
-    //    if (fasta_line[0] == '>') {
-    //        seqs.push_back(std::vector<u8>());
-    //    } else {
-    //        for (char c : fasta_line) {
-    //            seqs.back().push_back(BASE_COMP_B[BASE_BYTES[(u8)c]]);
-    //        }
-    //    }
-    //}
-
-    fmi.load_pacseq();
-    auto seqs = fmi.get_seqs();
-    u64 st = 0;
-    
+                                           u32 sample_dist, u16 threads,
+                                           u64 seed) {
+
+    //SA is not needed, and may still be written by IndexBuilder
+    BwaIndex<KLEN> fmi(bwa_prefix, true, false);
+
+    std::vector<Block> blocks = get_blocks(fmi);
+
+    //Kept per block so paths are in reference order
+    std::vector< std::vector< std::vector<u64> > > block_paths(blocks.size());
+
+    align_blocks(fmi, blocks, sample_dist, std::max<u16>(threads, 1), seed,
+        [&](u16 t, u64 b, const std::vector<u64> &path) {
+            block_paths[b].push_back(path);
+        });
+
     std::vector< std::vector<u64> > ret;
+    for (auto &paths : block_paths) {
+        for (auto &p : paths) ret.push_back(std::move(p));
+    }
 
-    for (auto s : seqs) {
-        std::string name = s.first;
-        u64 len = s.second;
+    return ret;
+}
 
-        for (u64 i = 0; i < len; i++) {
-            
+SelfAlignHist self_align_hist(const std::string &bwa_prefix,
+                              u32 sample_dist, u32 kmer_len, u32 max_len,
+                              u16 threads, u64 seed) {
 
-            if (rand() % sample_dist != 0) {
-                continue;
-            }
+    //SA is not needed, and may still be written by IndexBuilder
+    BwaIndex<KLEN> fmi(bwa_prefix, true, false);
 
-            ret.push_back(std::vector<u64>());
+    std::vector<Block> blocks = get_blocks(fmi);
+    threads = std::max<u16>(threads, 1);
+    kmer_len = std::max<u32>(kmer_len, 1);
 
+    SelfAlignHist empty = {
+        std::vector<u64>(max_len + 2, 0),
+        std::vector< std::vector<u64> >(64, std::vector<u64>(max_len, 0))
+    };
+    std::vector<SelfAlignHist> hists(threads, empty);
 
-            //TODO: start with kmers, not bases
-            Range r = fmi.get_base_range(BASE_COMP_B[fmi.get_base(st+i)]);
-            u64 j = i+1;
-            for (; j < len && r.length() > 1 ; j++) { //&& (j-i) <= 1000
-                ret.back().push_back(r.length());
-                r = fmi.get_neighbor(r, BASE_COMP_B[fmi.get_base(st+j)]);
+    align_blocks(fmi, blocks, sample_dist, threads, seed,
+        [&](u16 t, u64 b, const std::vector<u64> &path) {
+            SelfAlignHist &h = hists[t];
+
+            if (path.size() < kmer_len) {
+                h.len_counts[1]++;
+                if (max_len > 0) h.fm_len_counts[0][0]++;
+                return;
             }
-            //Happens on Ns
-            if (r.length() > 0) {
-                ret.back().push_back(r.length());
+
+            u64 len = path.size() - (kmer_len - 1);
+            h.len_counts[std::min<u64>(len, max_len + 1)]++;
+
+            for (u64 i = 0; i < len && i < max_len; i++) {
+                u64 fmlen = path[i + kmer_len - 1];
+                h.fm_len_counts[63 - __builtin_clzll(fmlen)][i]++;
             }
-        }
+        });
 
-        st += len;
+    SelfAlignHist &ret = hists[0];
+    for (u16 t = 1; t < threads; t++) {
+        for (u32 l = 0; l < ret.len_counts.size(); l++) {
+            ret.len_counts[l] += hists[t].len_counts[l];
+        }
+        for (u32 e = 0; e < ret.fm_len_counts.size(); e++) {
+            for (u32 i = 0; i < max_len; i++) {
+                ret.fm_len_counts[e][i] += hists[t].fm_len_counts[e][i];
+            }
+        }
     }
 
     return ret;
 }
-
@@ -28,7 +28,30 @@
 #include <string>
 #include "util.hpp"
 
+//Aligns sampled reference positions back to the reference, to find how 
+//FM range lengths shrink along paths for index parameterization. Each 
+//position is kept with probability 1/sample_dist. Sampling is a hash of 
+//the position and seed, so results don't depend on the thread count
+
+//FM range length at each base of every sampled path
 std::vector< std::vector<u64> > self_align(const std::string &bwa_prefix,
-                                         u32 sample_dist);
+                                           u32 sample_dist, u16 threads=1,
+                                           u64 seed=0);
+
+//Paths summarized as they are aligned, without storing them. Paths are 
+//measured in k-mers, starting from the range of their first k-mer. 
+//Paths shorter than one k-mer are counted as a single range of length 1
+typedef struct {
+    //Paths by length, with paths longer than max_len counted at max_len+1
+    std::vector<u64> len_counts;
+
+    //Paths by floor(log2(range length)) at each of the first max_len 
+    //k-mers, indexed [log2 length][k-mer]
+    std::vector< std::vector<u64> > fm_len_counts;
+} SelfAlignHist;
+
+SelfAlignHist self_align_hist(const std::string &bwa_prefix,
+                              u32 sample_dist, u32 kmer_len, u32 max_len,
+                              u16 threads=1, u64 seed=0);
 
 #endif
@@ -0,0 +1,368 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+#include "signal_sketch.hpp"
+#include "bwa_index.hpp"
+
+const char SignalSketch::MAGIC[] = "UNCLSKT";
+const u16 SignalSketch::VERSION;
+const u32 SignalSketch::LEVEL_BINS;
+const u32 SignalSketch::SEED_INTV;
+
+const SignalSketch::Params SignalSketch::PRMS_DEF = {
+    window_len      : 0,  //see build()
+    path_len        : 0,  //window_len + 8
+    bits_per_window : 32 //about 1 in 40 windows falsely found
+};
+
+//Paths are followed in a table of this size, so at most 3/4 as many
+//are kept per event. Far more than real reads need
+const u32 PATH_SLOTS = 4096, MAX_PATHS = PATH_SLOTS * 3 / 4;
+
+SignalSketch::SignalSketch()
+    : window_len_(0),
+      path_len_(0),
+      hash_bits_(0),
+      window_count_(0),
+      window_mask_(0),
+      k_(0),
+      max_stays_(0),
+      kmer_words_(0),
+      bin_min_(0),
+      bin_scale_(0) {}
+
+bool SignalSketch::check_params() {
+    if (window_len_ < 1 || window_len_ > 32) {
+        std::cerr << "Error: sketch window length must be 1-32\n";
+        return false;
+    }
+
+    //Path lengths are stored in a u8
+    if (path_len_ < window_len_ || path_len_ > 255) {
+        std::cerr << "Error: sketch path length must be at least the "
+                  << "window length and at most 255\n";
+        return false;
+    }
+
+    if (hash_bits_ < 6 || hash_bits_ > 40) {
+        std::cerr << "Error: sketch must have 2^6-2^40 bits\n";
+        return false;
+    }
+
+    window_mask_ = window_len_ == 32 ? ~0ull : (1ull << (2*window_len_)) - 1;
+
+    return true;
+}
+
+//Reads are mapped from the end of the BWA text's forward strand to its
+//start, and from the start of the reverse complement to its end (as in
+//self_align), appending one base per k-mer (see kmer_neighbor)
+bool SignalSketch::build(const std::string &bwa_prefix, Params prms) {
+    BwaIndex<KmerLen::k5> fmi(bwa_prefix, true, false);
+    if (!fmi.is_loaded()) {
+        std::cerr << "Error: failed to load \"" << bwa_prefix << "\"\n";
+        return false;
+    }
+
+    u64 ref_len = 0;
+    for (auto &s : fmi.get_seqs()) {
+        ref_len += s.second;
+    }
+
+    //Both strands have a window at nearly every base
+    u64 window_count = 2 * ref_len;
+
+    //By default windows are long enough that few are in the reference
+    //by chance, e.g. 12 bases for 200kb or 14 for 2Mb
+    window_len_ = prms.window_len;
+    if (window_len_ == 0) {
+        window_len_ = 1;
+        while (window_len_ < 32 && (1ull << (2*window_len_)) < 32 * window_count) {
+            window_len_++;
+        }
+    }
+
+    path_len_ = prms.path_len > 0 ? prms.path_len : window_len_ + 8;
+
+    hash_bits_ = 6;
+    while ((1ull << hash_bits_) < window_count * prms.bits_per_window) {
+        hash_bits_++;
+    }
+
+    if (!check_params()) {
+        fmi.destroy();
+        return false;
+    }
+
+    bits_.assign((1ull << hash_bits_) / 64, 0);
+    window_count_ = 0;
+
+    u64 seq_st = 0;
+    for (auto &s : fmi.get_seqs()) {
+        u64 len = s.second;
+
+        for (u8 strand = 0; strand < 2; strand++) {
+            bool rev = strand == 1;
+
+            u64 window = 0;
+            for (u64 j = 0; j < len; j++) {
+                u64 i = rev ? seq_st + j : seq_st + len - 1 - j;
+                u8 b = fmi.get_base(i);
+                window = ((window << 2) | (rev ? BASE_COMP_B[b] : b)) & window_mask_;
+
+                if (j+1 >= window_len_) {
+                    u64 h = hash(window);
+                    bits_[h >> 6] |= 1ull << (h & 63);
+                    window_count_++;
+                }
+            }
+        }
+
+        seq_st += len;
+    }
+
+    fmi.destroy();
+
+    return true;
+}
+
+u64 SignalSketch::hash(u64 window) const {
+    return (window * 0x9E3779B97F4A7C15ull) >> (64 - hash_bits_);
+}
+
+bool SignalSketch::contains(u64 window) const {
+    u64 h = hash(window);
+    return (bits_[h >> 6] >> (h & 63)) & 1;
+}
+
+const u64 *SignalSketch::get_bin_kmers(float level) const {
+    float b = (level - bin_min_) * bin_scale_ + 0.5f;
+
+    //Also false for NaN
+    if (!(b >= 0 && b < LEVEL_BINS)) {
+        b = LEVEL_BINS;
+    }
+
+    return &bin_kmers_[(u64) b * kmer_words_];
+}
+
+bool SignalSketch::load(const std::string &fname) {
+    bits_.clear();
+
+    FILE *in = fopen(fname.c_str(), "rb");
+    if (in == NULL) {
+        std::cerr << "Error: failed to open \"" << fname << "\"\n";
+        return false;
+    }
+
+    char magic[sizeof(MAGIC)];
+    u16 version;
+    bool ok = fread(magic, 1, sizeof(MAGIC), in) == sizeof(MAGIC) &&
+              memcmp(magic, MAGIC, sizeof(MAGIC)) == 0 &&
+              fread(&version, sizeof(version), 1, in) == 1;
+
+    if (!ok) {
+        std::cerr << "Error: \"" << fname << "\" is not a signal sketch\n";
+        fclose(in);
+        return false;
+    }
+
+    if (version != VERSION) {
+        std::cerr << "Error: \"" << fname << "\" is version " << version
+                  << ", expected " << VERSION << "\n";
+        fclose(in);
+        return false;
+    }
+
+    ok = fread(&window_len_, sizeof(window_len_), 1, in) == 1 &&
+         fread(&path_len_, sizeof(path_len_), 1, in) == 1 &&
+         fread(&hash_bits_, sizeof(hash_bits_), 1, in) == 1 &&
+         fread(&window_count_, sizeof(window_count_), 1, in) == 1;
+
+    if (ok && !check_params()) {
+        fclose(in);
+        return false;
+    }
+
+    if (ok) {
+        std::vector<u64> bits((1ull << hash_bits_) / 64);
+        ok = fread(bits.data(), sizeof(u64), bits.size(), in) == bits.size() &&
+             fgetc(in) == EOF;
+        if (ok) bits_.swap(bits);
+    }
+
+    fclose(in);
+
+    if (!ok) {
+        std::cerr << "Error: \"" << fname << "\" is truncated or has "
+                  << "unexpected data\n";
+    }
+
+    return ok;
+}
+
+bool SignalSketch::write(const std::string &fname) const {
+    FILE *out = fopen(fname.c_str(), "wb");
+    if (out == NULL) {
+        std::cerr << "Error: failed to open \"" << fname << "\"\n";
+        return false;
+    }
+
+    fwrite(MAGIC, 1, sizeof(MAGIC), out);
+    fwrite(&VERSION, sizeof(VERSION), 1, out);
+    fwrite(&window_len_, sizeof(window_len_), 1, out);
+    fwrite(&path_len_, sizeof(path_len_), 1, out);
+    fwrite(&hash_bits_, sizeof(hash_bits_), 1, out);
+    fwrite(&window_count_, sizeof(window_count_), 1, out);
+    fwrite(bits_.data(), sizeof(u64), bits_.size(), out);
+
+    bool ok = !ferror(out);
+    return fclose(out) == 0 && ok;
+}
+
+bool SignalSketch::is_loaded() const {
+    return !bits_.empty();
+}
+
+bool SignalSketch::is_scoring() const {
+    return is_loaded() && !bin_kmers_.empty();
+}
+
+u32 SignalSketch::get_window_len() const {
+    return window_len_;
+}
+
+u32 SignalSketch::get_path_len() const {
+    return path_len_;
+}
+
+u64 SignalSketch::get_window_count() const {
+    return window_count_;
+}
+
+float SignalSketch::get_density() const {
+    u64 set = 0;
+    for (u64 w : bits_) set += __builtin_popcountll(w);
+    return bits_.empty() ? 0 : (float) set / (bits_.size() * 64);
+}
+
+SignalSketch::Scorer::Scorer() : stamp_(0) {
+    reset();
+}
+
+void SignalSketch::Scorer::reset() {
+    events_ = hits_ = longest_ = 0;
+    paths_.clear();
+}
+
+void SignalSketch::Scorer::add_path(u64 bases, u8 length, u8 stays) {
+    u32 slot = (u32) ((bases * 0x9E3779B97F4A7C15ull) >> 52) & (PATH_SLOTS-1);
+
+    while (slot_stamps_[slot] == stamp_) {
+        Path &p = next_paths_[slot_paths_[slot]];
+        if (p.bases == bases) {
+            if (length > p.length || (length == p.length && stays < p.stays)) {
+                p.length = length;
+                p.stays = stays;
+            }
+            return;
+        }
+        slot = (slot + 1) & (PATH_SLOTS-1);
+    }
+
+    if (next_paths_.size() == MAX_PATHS) return;
+
+    slot_stamps_[slot] = stamp_;
+    slot_paths_[slot] = next_paths_.size();
+    next_paths_.push_back({bases, length, stays});
+}
+
+bool SignalSketch::Scorer::add(const SignalSketch &sketch, float level) {
+    if (slot_stamps_.empty()) {
+        slot_stamps_.assign(PATH_SLOTS, 0);
+        slot_paths_.resize(PATH_SLOTS);
+        paths_.reserve(MAX_PATHS);
+        next_paths_.reserve(MAX_PATHS);
+    }
+
+    //Stamps are only reused after wrapping around
+    if (++stamp_ == 0) {
+        std::fill(slot_stamps_.begin(), slot_stamps_.end(), 0);
+        stamp_ = 1;
+    }
+
+    const u64 *kmers = sketch.get_bin_kmers(level);
+    u64 kmask = (1ull << (2 * sketch.k_)) - 1;
+
+    next_paths_.clear();
+
+    for (const Path &p : paths_) {
+        u32 kmer = (u32) (p.bases & kmask);
+        if (p.stays < sketch.max_stays_ && ((kmers[kmer >> 6] >> (kmer & 63)) & 1)) {
+            add_path(p.bases, p.length, p.stays + 1);
+        }
+
+        //Neighbors of a k-mer are 4 consecutive bits (see kmer_neighbor)
+        u32 next = (u32) ((p.bases << 2) & kmask);
+        u32 matches = (kmers[next >> 6] >> (next & 63)) & 0xF;
+
+        for (; matches != 0; matches &= matches - 1) {
+            u8 b = __builtin_ctz(matches);
+            u64 bases = ((p.bases << 2) | b) & sketch.window_mask_;
+
+            u32 length = p.length + 1;
+            if (length >= sketch.window_len_ && !sketch.contains(bases)) {
+                continue;
+            }
+
+            add_path(bases, std::min(length, sketch.path_len_), 0);
+        }
+    }
+
+    if (events_ % SEED_INTV == 0) {
+        for (u32 w = 0; w < sketch.kmer_words_; w++) {
+            for (u64 bits = kmers[w]; bits != 0; bits &= bits - 1) {
+                add_path(w * 64 + __builtin_ctzll(bits), sketch.k_, 0);
+            }
+        }
+    }
+
+    paths_.swap(next_paths_);
+    events_++;
+
+    u32 longest = 0;
+    for (const Path &p : paths_) {
+        longest = std::max<u32>(longest, p.length);
+    }
+    longest_ = std::max(longest_, longest);
+
+    if (longest == sketch.path_len_) {
+        hits_++;
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,200 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _INCL_SIGNAL_SKETCH
+#define _INCL_SIGNAL_SKETCH
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "util.hpp"
+#include "pore_model.hpp"
+
+#ifdef PYBIND
+#include <pybind11/pybind11.h>
+#endif
+
+//Compact sketch of a (small) target reference, used to end reads which
+//clearly don't come from it before they pay for the full FM index search
+//(see Mapper::PRMS.sketch_events)
+//
+//Every window of window_len bases along both strands of the reference,
+//in the order reads are mapped, is hashed into a bitset. Events are
+//quantized into level bins, each with the set of k-mers matching it above
+//a probability threshold. Scoring extends paths through those k-mers
+//with the same stay/move steps as the mapper, but checks each full window
+//against the bitset instead of the FM index. An event hits the sketch if
+//a path of path_len bases ends at it. Off-target reads rarely have any
+//hits, since their paths must stay in the target for path_len bases.
+//
+//File starts with magic string and u16 version, then u32 window_len,
+//path_len and hash bits, u64 window count, and the bitset as u64 words
+class SignalSketch {
+    public:
+
+    static const char MAGIC[];
+    static const u16 VERSION = 1;
+
+    typedef struct {
+        u32 window_len;
+        u32 path_len;
+        u32 bits_per_window;
+    } Params;
+
+    static const Params PRMS_DEF;
+
+    //Per-read paths and hit count
+    class Scorer {
+        public:
+        Scorer();
+        void reset();
+
+        //Returns true if the event hits the sketch
+        bool add(const SignalSketch &sketch, float level);
+
+        u32 events_, hits_;
+
+        //Longest path so far
+        u32 longest_;
+
+        private:
+        typedef struct {
+            u64 bases;
+            u8 length, stays;
+        } Path;
+
+        //Adds to next_paths_, keeping the longest path ending in
+        //the same bases
+        void add_path(u64 bases, u8 length, u8 stays);
+
+        std::vector<Path> paths_, next_paths_;
+
+        //Open addressing table of next_paths_ indexes, entries are
+        //only valid if their stamp matches stamp_
+        std::vector<u32> slot_paths_, slot_stamps_;
+        u32 stamp_;
+    };
+
+    SignalSketch();
+
+    //Builds from the reference of a BWA index
+    bool build(const std::string &bwa_prefix, Params prms = PRMS_DEF);
+
+    bool load(const std::string &fname);
+    bool write(const std::string &fname) const;
+
+    //Sets the k-mers matching each event level bin, which must be done
+    //before scoring reads. Paths stay at most max_stays events
+    template <KmerLen KLEN>
+    void init_scoring(const PoreModel<KLEN> &model, float prob_thresh,
+                      u32 max_stays) {
+        k_ = KLEN;
+        max_stays_ = max_stays;
+
+        kmer_words_ = (model.get_kmer_count() + 63) / 64;
+        bin_kmers_.assign((u64) (LEVEL_BINS + 1) * kmer_words_, 0);
+
+        float win = model.get_window(prob_thresh);
+        bin_min_ = model.get_mean(0);
+        float bin_max = bin_min_;
+        for (u32 kmer = 0; kmer < model.get_kmer_count(); kmer++) {
+            bin_min_ = std::min(bin_min_, model.get_mean(kmer));
+            bin_max = std::max(bin_max, model.get_mean(kmer));
+        }
+        bin_min_ -= win;
+        bin_scale_ = (LEVEL_BINS - 1) / (bin_max + win - bin_min_);
+
+        //Last bin is left empty for out of range levels
+        for (u32 b = 0; b < LEVEL_BINS; b++) {
+            float level = bin_min_ + b / bin_scale_;
+            u64 *row = &bin_kmers_[(u64) b * kmer_words_];
+            for (u32 kmer = 0; kmer < model.get_kmer_count(); kmer++) {
+                if (model.match_prob(level, kmer) >= prob_thresh) {
+                    row[kmer >> 6] |= 1ull << (kmer & 63);
+                }
+            }
+        }
+    }
+
+    bool is_loaded() const;
+    bool is_scoring() const;
+    u32 get_window_len() const;
+    u32 get_path_len() const;
+    u64 get_window_count() const;
+
+    //Fraction of bitset set, the chance a window not in the reference
+    //is mistakenly found
+    float get_density() const;
+
+    //Window is the last window_len bases of a path, 2 bits per base
+    bool contains(u64 window) const;
+
+    #ifdef PYBIND
+
+    #define PY_SKETCH_METH(P) c.def(#P, &SignalSketch::P);
+
+    static void pybind_defs(pybind11::class_<SignalSketch> &c) {
+        c.def(pybind11::init());
+        c.def("build",
+              [](SignalSketch &s, const std::string &prefix,
+                 u32 window_len, u32 path_len, u32 bits_per_window) {
+                  return s.build(prefix, {window_len, path_len, bits_per_window});
+              },
+              pybind11::arg("bwa_prefix"),
+              pybind11::arg("window_len")=PRMS_DEF.window_len,
+              pybind11::arg("path_len")=PRMS_DEF.path_len,
+              pybind11::arg("bits_per_window")=PRMS_DEF.bits_per_window);
+        PY_SKETCH_METH(load);
+        PY_SKETCH_METH(write);
+        PY_SKETCH_METH(is_loaded);
+        PY_SKETCH_METH(get_window_len);
+        PY_SKETCH_METH(get_path_len);
+        PY_SKETCH_METH(get_window_count);
+        PY_SKETCH_METH(get_density);
+    }
+
+    #endif
+
+    private:
+    static const u32 LEVEL_BINS = 1024;
+
+    //Paths are started from every k-mer matching every SEED_INTV'th
+    //event, which bounds how many are followed at once
+    static const u32 SEED_INTV = 4;
+
+    bool check_params();
+    u64 hash(u64 window) const;
+
+    const u64 *get_bin_kmers(float level) const;
+
+    u32 window_len_, path_len_, hash_bits_;
+    u64 window_count_, window_mask_;
+    std::vector<u64> bits_;
+
+    //Set by init_scoring
+    u32 k_, max_stays_, kmer_words_;
+    float bin_min_, bin_scale_;
+    std::vector<u64> bin_kmers_;
+};
+
+#endif
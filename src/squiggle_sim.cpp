@@ -0,0 +1,278 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <ctime>
+#include "squiggle_sim.hpp"
+#include "model_r94.inl"
+
+const SquiggleSim::Params SquiggleSim::PRMS_DEF = {
+    bwa_prefix  : "",
+    model_path  : "",
+    min_len     : 1000,
+    max_len     : 20000,
+    dwell_mean  : 0,
+    dwell_shape : 2.0,
+    noise       : 1.0,
+    drift       : 0,
+    off_target  : 0,
+    seed        : 0
+};
+
+//Typical MinION calibration
+const float SquiggleSim::CAL_DIGIT  = 8192,
+            SquiggleSim::CAL_RANGE  = 1402.882,
+            SquiggleSim::CAL_OFFSET = 10;
+
+SquiggleSim::SquiggleSim(const Params &p) 
+    : PRMS(p),
+      #if KMER_LEN == 5
+      model_(pmodel_r94_template),
+      #endif
+      rng_(p.seed != 0 ? p.seed : time(NULL)),
+      ref_len_(0),
+      read_count_(0) {
+
+    //Index contains forward and reverse strands
+    if (!PRMS.bwa_prefix.empty()) {
+        fmi_.load_index(PRMS.bwa_prefix);
+        fmi_.load_pacseq();
+        ref_len_ = fmi_.size() / 2;
+
+        for (auto &seq : fmi_.get_seqs()) {
+            ref_ids_.push_back(Paf::intern(seq.first));
+        }
+    } else {
+        std::cerr << "Warning: no index given, all reads will be off-target\n";
+    }
+
+    //Sequence is simulated in read order, so use template model
+    if (!PRMS.model_path.empty()) {
+        model_ = PoreModel<KLEN>(PRMS.model_path, false);
+    }
+
+    if (!model_.is_loaded()) {
+        std::cerr << "Error: model_path must be specified for " 
+                  << KLEN << "-mers\n";
+    }
+
+    if (PRMS.dwell_mean <= 0) {
+        PRMS.dwell_mean = ReadBuffer::PRMS.sample_rate / 
+                          ReadBuffer::PRMS.bp_per_sec;
+    }
+
+    if (PRMS.max_len < PRMS.min_len) {
+        std::cerr << "Warning: max_len less than min_len, using min_len\n";
+        PRMS.max_len = PRMS.min_len;
+    }
+}
+
+ReadBuffer SquiggleSim::next_read(Paf &truth, u16 channel) {
+    std::string id = "sim_" + std::to_string(read_count_);
+    u32 number = read_count_++;
+
+    truth = Paf(id, channel, 0);
+
+    std::uniform_real_distribution<float> unif(0, 1);
+
+    std::vector<u32> kmers;
+    if (unif(rng_) < PRMS.off_target || !sample_ref(kmers, truth)) {
+        sample_random(kmers);
+    }
+
+    std::vector<float> signal;
+    kmers_to_signal(kmers, signal);
+
+    return ReadBuffer(id, channel, number, 0, signal);
+}
+
+bool SquiggleSim::sample_ref(std::vector<u32> &kmers, Paf &truth) {
+    if (ref_len_ < MIN_REF_LEN) return false;
+
+    std::uniform_int_distribution<u32> len_dist(PRMS.min_len, PRMS.max_len);
+    std::uniform_int_distribution<u64> st_dist(0, ref_len_ - MIN_REF_LEN);
+    std::bernoulli_distribution fwd_dist(0.5);
+
+    //Resample reads which would start too close to a reference end
+    for (u32 tries = 0; tries < 100; tries++) {
+        u64 st = st_dist(rng_), ref_st;
+        i32 rid;
+
+        u64 rf_len = fmi_.translate_rid(st, rid, ref_st);
+        if (rid < 0) continue;
+
+        u64 len = std::min<u64>(len_dist(rng_), rf_len - ref_st);
+        if (len < MIN_REF_LEN) continue;
+
+        kmers = fmi_.get_kmers(st, st + len);
+
+        bool fwd = fwd_dist(rng_);
+        if (!fwd) kmers = kmers_revcomp<KLEN>(kmers);
+
+        truth.set_read_len(len);
+        truth.set_mapped(0, len, ref_ids_[rid], ref_st, ref_st + len, 
+                         rf_len, fwd, 0);
+        return true;
+    }
+
+    return false;
+}
+
+void SquiggleSim::sample_random(std::vector<u32> &kmers) {
+    std::uniform_int_distribution<u32> len_dist(PRMS.min_len, PRMS.max_len);
+    std::uniform_int_distribution<u16> base_dist(0, BASE_COUNT-1);
+
+    u32 len = len_dist(rng_);
+
+    kmers.clear();
+    kmers.reserve(len);
+
+    u32 kmer = 0;
+    for (u32 i = 0; i < len + KLEN - 1; i++) {
+        kmer = kmer_neighbor<KLEN>(kmer, base_dist(rng_));
+        if (i + 1 >= KLEN) kmers.push_back(kmer);
+    }
+}
+
+void SquiggleSim::kmers_to_signal(const std::vector<u32> &kmers, 
+                                  std::vector<float> &signal) {
+
+    std::gamma_distribution<float> dwell(PRMS.dwell_shape, 
+                                         PRMS.dwell_mean / PRMS.dwell_shape);
+    std::normal_distribution<float> noise(0, 1);
+
+    float drift_per_samp = PRMS.drift / ReadBuffer::PRMS.sample_rate;
+
+    signal.clear();
+    signal.reserve(kmers.size() * (PRMS.dwell_mean + 1));
+
+    for (u32 k : kmers) {
+        u32 n = std::max<u32>(1, std::round(dwell(rng_)));
+        float mean = model_.get_mean(k),
+              stdv = model_.get_stdv(k) * PRMS.noise;
+
+        for (u32 i = 0; i < n; i++) {
+            signal.push_back(mean + stdv * noise(rng_) + 
+                             drift_per_samp * signal.size());
+        }
+    }
+}
+
+//Writes string attribute to an open HDF5 object
+static void write_str_attr(hid_t obj, const char *name, const std::string &val) {
+    hid_t type = H5Tcopy(H5T_C_S1);
+    H5Tset_size(type, val.size() + 1);
+    hid_t space = H5Screate(H5S_SCALAR),
+          attr = H5Acreate2(obj, name, type, space, H5P_DEFAULT, H5P_DEFAULT);
+    H5Awrite(attr, type, val.c_str());
+    H5Aclose(attr);
+    H5Sclose(space);
+    H5Tclose(type);
+}
+
+//Writes numeric attribute to an open HDF5 object
+template <typename T>
+static void write_num_attr(hid_t obj, const char *name, hid_t type, T val) {
+    hid_t space = H5Screate(H5S_SCALAR),
+          attr = H5Acreate2(obj, name, type, space, H5P_DEFAULT, H5P_DEFAULT);
+    H5Awrite(attr, type, &val);
+    H5Aclose(attr);
+    H5Sclose(space);
+}
+
+bool SquiggleSim::write_fast5(const std::string &fname, 
+                              const std::vector<ReadBuffer> &reads) {
+
+    std::lock_guard<std::mutex> lock(ReadBuffer::HDF5_MTX);
+
+    hid_t file = H5Fcreate(fname.c_str(), H5F_ACC_TRUNC, 
+                           H5P_DEFAULT, H5P_DEFAULT);
+    if (file < 0) {
+        std::cerr << "Error: failed to create \"" << fname << "\"\n";
+        return false;
+    }
+
+    write_str_attr(file, "file_version", "2.0");
+
+    std::vector<i16> raw;
+
+    for (const ReadBuffer &r : reads) {
+        std::string read_path = "/read_" + r.get_id();
+
+        hid_t read_grp = H5Gcreate2(file, read_path.c_str(), 
+                                    H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT),
+              raw_grp = H5Gcreate2(read_grp, "Raw", 
+                                   H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT),
+              ch_grp = H5Gcreate2(read_grp, "channel_id", 
+                                  H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+        write_str_attr(raw_grp, "read_id", r.get_id());
+        write_num_attr(raw_grp, "read_number", H5T_NATIVE_INT32, 
+                       (i32) r.get_number());
+        write_num_attr(raw_grp, "start_time", H5T_NATIVE_UINT64, 
+                       (u64) r.get_start());
+
+        write_str_attr(ch_grp, "channel_number", 
+                       std::to_string(r.get_channel()));
+        write_num_attr(ch_grp, "digitisation", H5T_NATIVE_DOUBLE, 
+                       (double) CAL_DIGIT);
+        write_num_attr(ch_grp, "range", H5T_NATIVE_DOUBLE, 
+                       (double) CAL_RANGE);
+        write_num_attr(ch_grp, "offset", H5T_NATIVE_DOUBLE, 
+                       (double) CAL_OFFSET);
+        write_num_attr(ch_grp, "sampling_rate", H5T_NATIVE_DOUBLE, 
+                       (double) ReadBuffer::PRMS.sample_rate);
+
+        const std::vector<float> &sig = r.get_raw();
+        raw.resize(sig.size());
+        for (u32 i = 0; i < sig.size(); i++) {
+            float v = std::round((sig[i] - CAL_OFFSET) * CAL_DIGIT / CAL_RANGE);
+            raw[i] = std::max<float>(INT16_MIN, std::min<float>(INT16_MAX, v));
+        }
+
+        hsize_t len = raw.size();
+        hid_t space = H5Screate_simple(1, &len, NULL),
+              dset = H5Dcreate2(raw_grp, "Signal", H5T_STD_I16LE, space, 
+                                H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+        herr_t err = H5Dwrite(dset, H5T_NATIVE_INT16, H5S_ALL, H5S_ALL, 
+                              H5P_DEFAULT, raw.data());
+
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Gclose(ch_grp);
+        H5Gclose(raw_grp);
+        H5Gclose(read_grp);
+
+        if (err < 0) {
+            std::cerr << "Error: failed to write signal for '" 
+                      << r.get_id() << "'\n";
+            H5Fclose(file);
+            return false;
+        }
+    }
+
+    H5Fclose(file);
+    return true;
+}
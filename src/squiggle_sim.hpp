@@ -0,0 +1,138 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _INCL_SQUIGGLE_SIM
+#define _INCL_SQUIGGLE_SIM
+
+#include <string>
+#include <vector>
+#include <random>
+#include "bwa_index.hpp"
+#include "pore_model.hpp"
+#include "read_buffer.hpp"
+#include "mapper.hpp"
+#include "util.hpp"
+
+#ifdef PYBIND
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#endif
+
+//Generates synthetic raw signal from reference sequence and a pore model
+//Reads have known true locations, so mapping can be tested at any scale
+//without real fast5 files
+class SquiggleSim {
+    public:
+
+    typedef struct {
+        std::string bwa_prefix, model_path;
+
+        //Read length range in bases
+        u32 min_len, max_len;
+
+        //Gamma distributed samples per base, mean 0 to use 
+        //sample_rate / bp_per_sec
+        float dwell_mean, dwell_shape;
+
+        //Signal noise as a multiple of the model stdv
+        float noise;
+
+        //Linear signal drift in pA per second
+        float drift;
+
+        //Fraction of reads with random sequence instead of reference
+        float off_target;
+
+        //Random seed, 0 to seed from time
+        u32 seed;
+    } Params;
+
+    static const Params PRMS_DEF;
+    Params PRMS;
+
+    SquiggleSim(const Params &p);
+
+    //Simulates the next read on the given channel
+    //truth is set to the read's reference location, or unmapped if 
+    //the read is off-target
+    ReadBuffer next_read(Paf &truth, u16 channel = 1);
+
+    //Writes reads in multi-read fast5 format, readable by Fast5Reader
+    static bool write_fast5(const std::string &fname, 
+                            const std::vector<ReadBuffer> &reads);
+
+    #ifdef PYBIND
+
+    #define PY_SQUIG_PRM(P) p.def_readwrite(#P, &SquiggleSim::Params::P);
+
+    static void pybind_defs(pybind11::class_<SquiggleSim> &c) {
+        c.def(pybind11::init<const Params &>());
+        c.def("next_read", [](SquiggleSim &s, u16 channel) {
+            Paf truth;
+            ReadBuffer read = s.next_read(truth, channel);
+            return std::make_pair(read, truth);
+        }, pybind11::arg("channel") = 1);
+        c.def_static("write_fast5", &SquiggleSim::write_fast5);
+
+        pybind11::class_<Params> p(c, "Params");
+        p.def(pybind11::init([]() {return SquiggleSim::PRMS_DEF;}));
+        PY_SQUIG_PRM(bwa_prefix);
+        PY_SQUIG_PRM(model_path);
+        PY_SQUIG_PRM(min_len);
+        PY_SQUIG_PRM(max_len);
+        PY_SQUIG_PRM(dwell_mean);
+        PY_SQUIG_PRM(dwell_shape);
+        PY_SQUIG_PRM(noise);
+        PY_SQUIG_PRM(drift);
+        PY_SQUIG_PRM(off_target);
+        PY_SQUIG_PRM(seed);
+    }
+
+    #endif
+
+    private:
+
+    //Fast5 calibration used when writing signal as int16
+    static const float CAL_DIGIT, CAL_RANGE, CAL_OFFSET;
+
+    //Minimum bases simulated from a reference sequence
+    static const u32 MIN_REF_LEN = 100;
+
+    //Samples reference kmers in read order, setting truth location
+    bool sample_ref(std::vector<u32> &kmers, Paf &truth);
+    void sample_random(std::vector<u32> &kmers);
+    void kmers_to_signal(const std::vector<u32> &kmers, 
+                         std::vector<float> &signal);
+
+    BwaIndex<KLEN> fmi_;
+
+    //Interned Paf ids of reference names, indexed by BWA reference id
+    std::vector<u32> ref_ids_;
+
+    PoreModel<KLEN> model_;
+    std::mt19937 rng_;
+    u64 ref_len_;
+    u32 read_count_;
+};
+
+#endif
@@ -0,0 +1,377 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstring>
+#include <cstdlib>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include "suffix_sorter.hpp"
+#include "index_builder.hpp"
+
+const u32 SuffixSorter::KEY_MAX;
+const u64 SuffixSorter::PASS_LEN;
+const u32 SuffixSorter::COVER_PERIOD;
+
+//Bucket groups handed to threads at once, since most buckets are small
+const u64 BUCKET_STEP = 1024;
+
+SuffixSorter::SuffixSorter(const std::vector<u8> &pac, u64 len, u16 threads)
+    : pac_(pac),
+      len_(len),
+      threads_(std::max<u16>(threads, 1)) {
+    init_cover();
+}
+
+template <typename Fn>
+void SuffixSorter::run_threads(Fn fn) const {
+    std::vector<std::thread> workers;
+    for (u16 i = 1; i < threads_; i++) {
+        workers.emplace_back(fn, i);
+    }
+    fn(0);
+    for (auto &w : workers) w.join();
+}
+
+u8 SuffixSorter::get_base(u64 i) const {
+    return (pac_[i >> 2] >> ((~i & 3) << 1)) & 3;
+}
+
+u64 SuffixSorter::get_bases(u64 i) const {
+    const u8 *p = &pac_[i >> 2];
+    u64 w;
+    memcpy(&w, p, sizeof(w));
+    w = __builtin_bswap64(w);
+
+    u32 sh = (i & 3) << 1;
+    if (sh > 0) w = (w << sh) | (p[8] >> (8 - sh));
+    return w;
+}
+
+int SuffixSorter::compare(u64 a, u64 b, u64 d, u64 len) const {
+    while (d < len) {
+        u64 ra = len_ - a - d,
+            rb = len_ - b - d,
+            m = std::min(std::min(ra, rb), std::min<u64>(len - d, 32));
+
+        if (m == 0) return ra < rb ? -1 : 1;
+
+        u64 wa = get_bases(a + d),
+            wb = get_bases(b + d);
+        if (m < 32) {
+            wa >>= (32 - m) << 1;
+            wb >>= (32 - m) << 1;
+        }
+
+        if (wa != wb) return wa < wb ? -1 : 1;
+        d += m;
+    }
+    return 0;
+}
+
+//Suffixes sharing COVER_PERIOD bases are ordered like the sampled
+//suffixes the same distance into them
+bool SuffixSorter::suffix_less(u64 a, u64 b, u64 d) const {
+    if (a == b) return false;
+
+    int c = compare(a, b, d, COVER_PERIOD);
+    if (c != 0) return c < 0;
+
+    u32 ra = a % COVER_PERIOD, rb = b % COVER_PERIOD,
+        r = cover_offs_[(rb + COVER_PERIOD - ra) % COVER_PERIOD],
+        off = (r + COVER_PERIOD - ra) % COVER_PERIOD;
+
+    return cover_ranks_[cover_index(a + off)] < cover_ranks_[cover_index(b + off)];
+}
+
+u64 SuffixSorter::cover_index(u64 pos) const {
+    return (pos / COVER_PERIOD) * cover_.size() + cover_idx_[pos % COVER_PERIOD];
+}
+
+//Residues below s and multiples of s, for s = sqrt(COVER_PERIOD). Any
+//difference q*s + r is (q+1)*s - (s-r), so this covers them all, with
+//about 2*sqrt(COVER_PERIOD) residues
+void SuffixSorter::init_cover() {
+    u32 s = 1;
+    while (s * s < COVER_PERIOD) s++;
+
+    cover_idx_.assign(COVER_PERIOD, (u32) -1);
+    for (u32 r = 0; r < COVER_PERIOD; r++) {
+        if (r < s || r % s == 0) {
+            cover_idx_[r] = cover_.size();
+            cover_.push_back(r);
+        }
+    }
+
+    cover_offs_.assign(COVER_PERIOD, 0);
+    for (u32 d = 0; d < COVER_PERIOD; d++) {
+        for (u32 r : cover_) {
+            if (cover_idx_[(r + d) % COVER_PERIOD] != (u32) -1) {
+                cover_offs_[d] = r;
+                break;
+            }
+        }
+    }
+}
+
+//Prefix doubling, starting from the sample sorted by COVER_PERIOD bases.
+//Sampled positions COVER_PERIOD (or any multiple) apart are both sampled,
+//so ranks are only ever needed for the sample. Ranks are the index of
+//the first suffix of a group plus one, with 0 for the empty suffix
+void SuffixSorter::sort_cover() {
+    std::vector<u64> sa;
+    for (u64 p = 0; p < len_; p += COVER_PERIOD) {
+        for (u32 r : cover_) {
+            if (p + r < len_) sa.push_back(p + r);
+        }
+    }
+    cover_ranks_.assign(sa.size(), 0);
+
+    auto prefix_less = [&](u64 a, u64 b) -> bool {
+        return compare(a, b, 0, COVER_PERIOD) < 0;
+    };
+
+    //Each thread sorts an even share, then pairs of shares are merged
+    std::vector<u64> bounds(threads_ + 1);
+    for (u16 i = 0; i <= threads_; i++) {
+        bounds[i] = sa.size() * i / threads_;
+    }
+    run_threads([&](u16 i) {
+        std::sort(&sa[bounds[i]], &sa[bounds[i+1]], prefix_less);
+    });
+    for (u16 w = 1; w < threads_; w <<= 1) {
+        run_threads([&](u16 i) {
+            u32 st = 2 * w * i;
+            if (st + w >= threads_) return;
+            u32 en = std::min<u32>(st + 2*w, threads_);
+            std::inplace_merge(sa.begin() + bounds[st], sa.begin() + bounds[st+w],
+                               sa.begin() + bounds[en], prefix_less);
+        });
+    }
+
+    //Unsorted groups of suffixes, [start, end) in sa
+    typedef std::pair<u64, u64> Group;
+    std::vector<Group> groups;
+
+    std::vector<u8> new_group(sa.size());
+    run_threads([&](u16 i) {
+        for (u64 s = bounds[i]; s < bounds[i+1]; s++) {
+            new_group[s] = s == 0 || compare(sa[s-1], sa[s], 0, COVER_PERIOD) != 0;
+        }
+    });
+
+    u64 group_st = 0;
+    for (u64 s = 0; s < sa.size(); s++) {
+        if (new_group[s]) {
+            if (s - group_st > 1) groups.push_back({group_st, s});
+            group_st = s;
+        }
+        cover_ranks_[cover_index(sa[s])] = group_st + 1;
+    }
+    if (sa.size() - group_st > 1) groups.push_back({group_st, sa.size()});
+    std::vector<u8>().swap(new_group);
+
+    //Ranks of the suffixes h bases in, stored in sorted order so they
+    //can be compared after ranks are updated
+    std::vector<u64> keys(sa.size());
+
+    for (u64 h = COVER_PERIOD; !groups.empty(); h <<= 1) {
+        std::atomic<u64> next(0);
+        run_threads([&](u16 i) {
+            std::vector<Group> suffs;
+            u64 g;
+            while ((g = next++) < groups.size()) {
+                suffs.clear();
+                for (u64 s = groups[g].first; s < groups[g].second; s++) {
+                    u64 p = sa[s] + h;
+                    suffs.push_back({p < len_ ? cover_ranks_[cover_index(p)] : 0, sa[s]});
+                }
+                std::sort(suffs.begin(), suffs.end());
+                for (u64 j = 0; j < suffs.size(); j++) {
+                    keys[groups[g].first + j] = suffs[j].first;
+                    sa[groups[g].first + j] = suffs[j].second;
+                }
+            }
+        });
+
+        std::vector<std::vector<Group>> split(threads_);
+        next = 0;
+        run_threads([&](u16 i) {
+            u64 g;
+            while ((g = next++) < groups.size()) {
+                u64 st = groups[g].first, en = groups[g].second, sub_st = st;
+                for (u64 s = st; s < en; s++) {
+                    if (keys[s] != keys[sub_st]) {
+                        if (s - sub_st > 1) split[i].push_back({sub_st, s});
+                        sub_st = s;
+                    }
+                    cover_ranks_[cover_index(sa[s])] = sub_st + 1;
+                }
+                if (en - sub_st > 1) split[i].push_back({sub_st, en});
+            }
+        });
+
+        groups.clear();
+        for (auto &gs : split) {
+            groups.insert(groups.end(), gs.begin(), gs.end());
+        }
+    }
+}
+
+//Suffix ranks count the sentinel suffix as 0, which is the first BWT
+//character, and skip the primary (suffix 0) as bwt_pac2bwt does. Every
+//bucket's ranks are known from bucket sizes, so threads scatter
+//positions into buckets, sort each bucket, and fill in their BWT
+//characters without further coordination
+bwt_t *SuffixSorter::get_bwt() {
+    Timer t;
+    u64 n = len_;
+
+    sort_cover();
+    log_stage("bwt cover", t.lap());
+
+    //About 16 suffixes per bucket
+    u32 k = 1;
+    while (k < KEY_MAX && (4ull << (2*k)) * 16 <= n) k++;
+    u64 nbuckets = 1ull << (2*k);
+
+    auto get_key = [&](u64 i) -> u64 {
+        return get_bases(i) >> (64 - 2*k);
+    };
+
+    //Text is split evenly between threads
+    auto thread_st = [&](u16 i) -> u64 {
+        return n * i / threads_;
+    };
+
+    //Suffixes shorter than k are keyed as if padded with A's, which still
+    //orders them before their bucket's other suffixes
+    std::vector<u64> bucket_st(nbuckets + 1, 0);
+    u64 base_counts[4] = {0, 0, 0, 0};
+
+    run_threads([&](u16 i) {
+        u64 counts[4] = {0, 0, 0, 0};
+        u64 en = thread_st(i+1);
+        for (u64 j = thread_st(i); j < en; j++) {
+            __atomic_fetch_add(&bucket_st[get_key(j)], 1, __ATOMIC_RELAXED);
+            counts[get_base(j)]++;
+        }
+        for (u8 c = 0; c < 4; c++) {
+            __atomic_fetch_add(&base_counts[c], counts[c], __ATOMIC_RELAXED);
+        }
+    });
+
+    u64 rank = 1;
+    for (u64 b = 0; b <= nbuckets; b++) {
+        u64 count = bucket_st[b];
+        bucket_st[b] = rank;
+        rank += count;
+    }
+    log_stage("bwt count", t.lap());
+
+    bwt_t *bwt = (bwt_t *) calloc(1, sizeof(bwt_t));
+    bwt->seq_len = n;
+    bwt->bwt_size = (n + 15) >> 4;
+    bwt->bwt = (u32 *) calloc(bwt->bwt_size, sizeof(u32));
+    bwt->primary = (bwtint_t) -1;
+    for (u8 c = 0; c < 4; c++) {
+        bwt->L2[c+1] = bwt->L2[c] + base_counts[c];
+    }
+
+    //Neighboring buckets can share a word
+    auto set_bwt = [&](u64 j, u8 c) {
+        __atomic_fetch_or(&bwt->bwt[j >> 4], (u32) c << ((15 - (j & 15)) << 1),
+                          __ATOMIC_RELAXED);
+    };
+
+    //BWT character of the sentinel suffix
+    set_bwt(0, get_base(n - 1));
+
+    //Suffixes in the same bucket share k bases, unless one is shorter
+    auto less = [&](u64 a, u64 b) -> bool {
+        return suffix_less(a, b, n - std::max(a, b) >= k ? k : 0);
+    };
+
+    u64 key0 = get_key(0);
+    std::vector<u64> sa, cursors;
+    double scatter_ms = 0, sort_ms = 0, fill_ms = 0;
+
+    for (u64 lo = 0, hi; lo < nbuckets; lo = hi) {
+        hi = lo + 1;
+        while (hi < nbuckets && bucket_st[hi+1] - bucket_st[lo] <= PASS_LEN) hi++;
+
+        u64 pass_st = bucket_st[lo],
+            pass_len = bucket_st[hi] - pass_st;
+
+        sa.resize(pass_len);
+        cursors.resize(hi - lo);
+        for (u64 b = lo; b < hi; b++) {
+            cursors[b - lo] = bucket_st[b] - pass_st;
+        }
+
+        run_threads([&](u16 i) {
+            u64 en = thread_st(i+1);
+            for (u64 j = thread_st(i); j < en; j++) {
+                u64 key = get_key(j);
+                if (key < lo || key >= hi) continue;
+                u64 slot = __atomic_fetch_add(&cursors[key - lo], 1, __ATOMIC_RELAXED);
+                sa[slot] = j;
+            }
+        });
+        scatter_ms += t.lap();
+
+        std::atomic<u64> next_bucket(lo);
+        run_threads([&](u16 i) {
+            u64 st;
+            while ((st = next_bucket.fetch_add(BUCKET_STEP)) < hi) {
+                for (u64 b = st; b < std::min(st + BUCKET_STEP, hi); b++) {
+                    std::sort(sa.begin() + (bucket_st[b] - pass_st),
+                              sa.begin() + (bucket_st[b+1] - pass_st), less);
+                }
+            }
+        });
+        sort_ms += t.lap();
+
+        if (key0 >= lo && key0 < hi) {
+            u64 s = bucket_st[key0] - pass_st;
+            while (sa[s] != 0) s++;
+            bwt->primary = pass_st + s;
+        }
+
+        run_threads([&](u16 i) {
+            u64 en = pass_len * (i+1) / threads_;
+            for (u64 s = pass_len * i / threads_; s < en; s++) {
+                if (sa[s] == 0) continue;
+                u64 r = pass_st + s;
+                set_bwt(r - (r > bwt->primary), get_base(sa[s] - 1));
+            }
+        });
+        fill_ms += t.lap();
+    }
+
+    log_stage("bwt scatter", scatter_ms);
+    log_stage("bwt sort", sort_ms);
+    log_stage("bwt fill", fill_ms);
+
+    return bwt;
+}
@@ -0,0 +1,98 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _INCL_SUFFIX_SORTER
+#define _INCL_SUFFIX_SORTER
+
+#include <vector>
+#include <bwa/bwt.h>
+#include "util.hpp"
+
+//Multi-threaded suffix sort of a packed text, giving the same BWT as
+//bwt_pac2bwt. Any exact suffix sort does, since suffixes are distinct.
+//
+//Suffixes are bucketed by their first few bases, and threads sort each
+//bucket by comparing 32 bases at a time. Comparisons stop after
+//COVER_PERIOD bases, since repeats would otherwise make them very long.
+//Instead, the order of suffixes sharing that many bases is found from
+//the ranks of a difference cover sample, as in Bowtie's blockwise sort:
+//positions in a fixed set of residues mod COVER_PERIOD, chosen so any two
+//suffixes are the same distance from sampled ones. The sample is sorted
+//first by prefix doubling, which only takes a few rounds
+class SuffixSorter {
+    public:
+
+    //Text is 2 bits per base as in a BWA .pac, first base in the high
+    //bits, and must have 8 bytes after its last base
+    SuffixSorter(const std::vector<u8> &pac, u64 len, u16 threads=1);
+
+    //Returns the BWT without occurrences, like bwt_pac2bwt
+    bwt_t *get_bwt();
+
+    private:
+
+    //Buckets are keyed by at most this many bases, and sorted in passes
+    //over at most PASS_LEN suffixes to bound memory
+    static const u32 KEY_MAX = 12;
+    static const u64 PASS_LEN = 1ull << 28;
+
+    static const u32 COVER_PERIOD = 1024;
+
+    u8 get_base(u64 i) const;
+
+    //32 bases starting at i, first in the high bits, 0 past the end
+    u64 get_bases(u64 i) const;
+
+    //Compares bases [d, len) of two suffixes, given their first d bases
+    //are equal. Returns 0 if both have len bases which are all equal.
+    //Shorter suffixes are first when one is a prefix of the other, as if
+    //the text ends with the sentinel
+    int compare(u64 a, u64 b, u64 d, u64 len) const;
+
+    //Full suffix comparison, given their first d bases are equal
+    bool suffix_less(u64 a, u64 b, u64 d) const;
+
+    //Index of a sampled position in cover_ranks_
+    u64 cover_index(u64 pos) const;
+
+    void init_cover();
+    void sort_cover();
+
+    //Runs fn(i) for each i < threads_, in as many threads
+    template <typename Fn>
+    void run_threads(Fn fn) const;
+
+    const std::vector<u8> &pac_;
+    u64 len_;
+    u16 threads_;
+
+    //Residues mod COVER_PERIOD which are sampled, the index of each
+    //residue among them (or -1), and an offset to a sampled residue
+    //for each difference of residues
+    std::vector<u32> cover_, cover_idx_, cover_offs_;
+
+    //Sample ranks, ordered by position
+    std::vector<u64> cover_ranks_;
+};
+
+#endif
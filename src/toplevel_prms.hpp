@@ -36,6 +36,9 @@ typedef struct {
     float duration;
 
     u32 max_active_reads;
+
+    //File to record incoming chunks and updates to ("" = no trace)
+    std::string chunk_trace;
 } RealtimeParams;
 
 const RealtimeParams REALTIME_PRMS_DEF = {
@@ -44,13 +47,25 @@ const RealtimeParams REALTIME_PRMS_DEF = {
     host             : "127.0.0.1",
     port             : 8000,
     duration         : 72,
-    max_active_reads : 512
+    max_active_reads : 512,
+    chunk_trace      : ""
 };
 
 typedef struct {
     std::string ctl_seqsum, unc_seqsum, unc_paf;
     float sim_speed, scan_time, scan_intv_time, ej_time;
     u32 min_ch_reads;
+
+    //Advance simulated time by sim_step seconds once all chunks are
+    //mapped, instead of following the wall clock
+    bool virtual_clock;
+    float sim_step;
+
+    //Random seed, 0 to seed from time
+    u32 seed;
+
+    //Reads per channel loaded ahead of time, 0 to load all up front
+    u32 read_lookahead;
 } SimParams;
 
 const SimParams SIM_PRMS_DEF = {
@@ -61,7 +76,11 @@ const SimParams SIM_PRMS_DEF = {
     scan_time      : 10,
     scan_intv_time : 10.0,
     ej_time        : 5400.0,
-    min_ch_reads   : 0 //TODO is this needed?
+    min_ch_reads   : 0, //TODO is this needed?
+    virtual_clock  : false,
+    sim_step       : 0.1,
+    seed           : 0,
+    read_lookahead : 2
 };
 
 typedef struct {
@@ -0,0 +1,430 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <unistd.h>
+#include <sys/resource.h>
+#include "conf.hpp"
+#include "client_sim.hpp"
+#include "realtime_pool.hpp"
+#include "read_buffer.hpp"
+
+//Replays a fixed read set through ClientSim and RealtimePool for each
+//combination of channel and thread counts, and prints decision latency,
+//throughput, CPU and memory usage as JSON
+
+typedef struct {
+    std::string read_list;
+    std::vector<u32> channels, threads;
+    float duration, gap, poll;
+} BenchParams;
+
+const BenchParams BENCH_PRMS_DEF = {
+    read_list : "",
+    channels  : {512},
+    threads   : {1},
+    duration  : 60, //simulated seconds per run
+    gap       : 1.0, //simulated seconds between reads
+    poll      : 1.0  //milliseconds between pool updates
+};
+
+typedef struct {
+    u32 channels, threads;
+    u64 chunks, ejected, kept, ended, events;
+    double wall_sec, sim_sec, cpu_sec;
+    u64 peak_rss_kb;
+    std::vector<float> latencies; //milliseconds
+} BenchRun;
+
+bool load_conf(int argc, char** argv, Conf &conf, BenchParams &bench);
+bool load_read_ids(const std::string &fname, std::vector<std::string> &ids);
+bool run_bench(Conf &conf, const BenchParams &bench,
+               const std::vector<std::string> &ids, BenchRun &run);
+void write_json(std::ostream &out, const Conf &conf,
+                const std::vector<BenchRun> &runs, u32 read_count);
+
+int main(int argc, char** argv) {
+    std::cerr << "Loading conf\n";
+
+    Conf conf;
+    BenchParams bench = BENCH_PRMS_DEF;
+
+    if (!load_conf(argc, argv, conf, bench)) {
+        return 1;
+    }
+
+    std::vector<std::string> ids;
+    if (!load_read_ids(bench.read_list, ids)) {
+        return 1;
+    }
+
+    std::vector<BenchRun> runs;
+
+    for (u32 channels : bench.channels) {
+        for (u32 threads : bench.threads) {
+            conf.set_num_channels(channels);
+            conf.set_threads(threads);
+
+            std::cerr << "Running " << channels << " channels, "
+                      << threads << " threads\n";
+
+            runs.emplace_back();
+            if (!run_bench(conf, bench, ids, runs.back())) {
+                return 1;
+            }
+        }
+    }
+
+    write_json(std::cout, conf, runs, ids.size());
+}
+
+double cpu_seconds() {
+    struct rusage u;
+    getrusage(RUSAGE_SELF, &u);
+    return u.ru_utime.tv_sec + u.ru_stime.tv_sec +
+           (u.ru_utime.tv_usec + u.ru_stime.tv_usec) / 1e6;
+}
+
+//Resets VmHWM so each run reports its own peak (Linux 4.0+)
+void reset_peak_rss() {
+    std::ofstream clear("/proc/self/clear_refs");
+    if (clear.is_open()) clear << "5";
+}
+
+//Peak RSS since last reset, or of the whole process if unavailable
+u64 peak_rss_kb() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return std::stoull(line.substr(6));
+        }
+    }
+
+    struct rusage u;
+    getrusage(RUSAGE_SELF, &u);
+    return u.ru_maxrss;
+}
+
+bool load_read_ids(const std::string &fname, std::vector<std::string> &ids) {
+    std::ifstream infile(fname);
+
+    if (!infile.is_open()) {
+        std::cerr << "Error: failed to open read list\n";
+        return false;
+    }
+
+    std::string id;
+    while (infile >> id) {
+        ids.push_back(id);
+    }
+
+    if (ids.empty()) {
+        std::cerr << "Error: read list is empty\n";
+        return false;
+    }
+
+    return true;
+}
+
+bool run_bench(Conf &conf, const BenchParams &bench,
+               const std::vector<std::string> &ids, BenchRun &run) {
+
+    u32 nchs = conf.get_num_channels();
+    float sample_rate = conf.get_sample_rate();
+
+    run = {};
+    run.channels = nchs;
+    run.threads = conf.get_threads();
+
+    ClientSim sim(conf);
+
+    //Reads assigned round-robin, cycled by each channel for whole run
+    for (u32 i = 0; i < ids.size(); i++) {
+        sim.add_read((i % nchs) + 1, ids[i], 0);
+    }
+
+    u32 active_chs = std::min<u32>(nchs, ids.size());
+    if (active_chs < nchs) {
+        std::cerr << "Warning: only " << active_chs
+                  << " channels have reads\n";
+    }
+
+    u32 end = bench.duration * sample_rate,
+        gap = std::max<u32>(1, bench.gap * sample_rate);
+
+    for (u16 c = 1; c <= active_chs; c++) {
+        sim.add_intv(c, 0, 0, end);
+        sim.add_gap(c, 0, gap);
+    }
+
+    //Fast5s come from conf fast5_list
+    sim.load_fast5s();
+
+    std::cerr << "Loading mappers\n";
+    RealtimePool pool(conf);
+
+    bool deplete = conf.get_realtime_mode() == RealtimeParams::Mode::DEPLETE;
+
+    //Wall time each channel's latest chunk was given to the pool
+    std::vector<double> chunk_times(nchs, 0);
+    std::vector<u32> unblocked(nchs, 0);
+
+    reset_peak_rss();
+    double cpu_start = cpu_seconds();
+
+    sim.run();
+    Timer t;
+
+    while (sim.is_running() && sim.get_runtime() < bench.duration) {
+        double t0 = t.get();
+
+        u16 channel;
+        u32 number;
+        Paf paf;
+
+        //With a virtual clock, map everything before the clock steps
+        bool idle;
+        do {
+            for (MapResult m : pool.update()) {
+                std::tie(channel, number, paf) = m;
+                float latency = t.get() - chunk_times[channel-1];
+                float mt = paf.get_float(Paf::Tag::MAP_TIME);
+
+                if (paf.is_ended()) {
+                    sim.stop_receiving_read(channel, number, mt);
+                    run.ended++;
+                    continue;
+
+                } else if (paf.is_host() || (paf.is_mapped() && deplete) || 
+                           (!paf.is_mapped() && !deplete)) {
+                    sim.unblock_read(channel, number, mt);
+                    unblocked[channel-1] = number;
+                    run.ejected++;
+
+                } else {
+                    sim.stop_receiving_read(channel, number, mt);
+                    run.kept++;
+                }
+
+                run.latencies.push_back(latency);
+            }
+
+            idle = !sim.is_virtual() || pool.is_idle();
+            if (!idle) usleep(50);
+        } while (!idle);
+
+        for (auto &r : sim.get_read_chunks()) {
+            Chunk &ch = r.second;
+            if (unblocked[ch.get_channel_idx()] == ch.get_number()) {
+                continue;
+            } else if (pool.add_chunk(ch)) {
+                chunk_times[ch.get_channel_idx()] = t.get();
+                run.chunks++;
+            } else {
+                std::cerr << "Error: failed to add chunk from " << ch.get_id() << std::endl;
+            }
+        }
+
+        //Virtual clock only moves when stepped, so the run would never
+        //reach bench.duration
+        if (sim.is_virtual()) {
+            sim.advance_clock();
+            continue;
+        }
+
+        double dt = t.get() - t0;
+        if (dt < bench.poll) usleep(1000*(bench.poll - dt));
+    }
+
+    run.wall_sec = t.get() / 1000;
+    run.sim_sec = sim.get_runtime();
+    run.cpu_sec = cpu_seconds() - cpu_start;
+    run.peak_rss_kb = peak_rss_kb();
+    run.events = pool.events_mapped();
+
+    pool.stop_all();
+
+    return true;
+}
+
+//Nearest-rank percentile of sorted values
+float percentile(const std::vector<float> &sorted, double p) {
+    if (sorted.empty()) return 0;
+    u64 rank = std::ceil(p * sorted.size());
+    return sorted[rank > 0 ? rank-1 : 0];
+}
+
+void write_json(std::ostream &out, const Conf &conf,
+                const std::vector<BenchRun> &runs, u32 read_count) {
+
+    bool deplete = conf.realtime_prms.realtime_mode == RealtimeParams::Mode::DEPLETE;
+
+    out << "{\n"
+        << "  \"index\": \"" << conf.mapper_prms.bwa_prefix << "\",\n"
+        << "  \"reads\": " << read_count << ",\n"
+        << "  \"mode\": \"" << (deplete ? "deplete" : "enrich") << "\",\n"
+        << "  \"sim_speed\": " << conf.sim_prms.sim_speed << ",\n"
+        << "  \"runs\": [";
+
+    for (u32 i = 0; i < runs.size(); i++) {
+        const BenchRun &r = runs[i];
+
+        std::vector<float> lat(r.latencies);
+        std::sort(lat.begin(), lat.end());
+
+        double mean = 0;
+        for (float l : lat) mean += l;
+        if (!lat.empty()) mean /= lat.size();
+
+        out << (i > 0 ? ",\n" : "\n")
+            << "    {\n"
+            << "      \"channels\": " << r.channels << ",\n"
+            << "      \"threads\": " << r.threads << ",\n"
+            << "      \"wall_sec\": " << r.wall_sec << ",\n"
+            << "      \"sim_sec\": " << r.sim_sec << ",\n"
+            << "      \"chunks\": " << r.chunks << ",\n"
+            << "      \"decisions\": " << lat.size() << ",\n"
+            << "      \"ejected\": " << r.ejected << ",\n"
+            << "      \"kept\": " << r.kept << ",\n"
+            << "      \"ended\": " << r.ended << ",\n"
+            << "      \"latency_ms\": {"
+            <<   "\"mean\": " << mean << ", "
+            <<   "\"p50\": " << percentile(lat, 0.5) << ", "
+            <<   "\"p90\": " << percentile(lat, 0.9) << ", "
+            <<   "\"p99\": " << percentile(lat, 0.99) << ", "
+            <<   "\"p999\": " << percentile(lat, 0.999) << ", "
+            <<   "\"max\": " << (lat.empty() ? 0 : lat.back()) << "},\n"
+            << "      \"events\": " << r.events << ",\n"
+            << "      \"events_per_sec\": " << (r.events / r.wall_sec) << ",\n"
+            << "      \"cpu_sec\": " << r.cpu_sec << ",\n"
+            << "      \"cpu_util\": " << (r.cpu_sec / r.wall_sec) << ",\n"
+            << "      \"peak_rss_kb\": " << r.peak_rss_kb << "\n"
+            << "    }";
+    }
+
+    out << "\n  ]\n}\n";
+}
+
+//Parses comma-separated list of counts, e.g. "128,256,512"
+bool parse_counts(const std::string &str, std::vector<u32> &counts) {
+    counts.clear();
+    std::stringstream ss(str);
+    std::string tok;
+    while (std::getline(ss, tok, ',')) {
+        int n = atoi(tok.c_str());
+        if (n <= 0) return false;
+        counts.push_back(n);
+    }
+    return !counts.empty();
+}
+
+#define FLAG_TO_CONF(C, T, F) { \
+    case C: \
+        conf.set_##F(T(optarg)); \
+        break; \
+}
+
+#define FLAG_TO_COUNTS(C, F) { \
+    case C: \
+        if (!parse_counts(optarg, bench.F)) { \
+            std::cerr << "Error: invalid " << #F << " list\n"; \
+            return false; \
+        } \
+        break; \
+}
+
+#define POSITIONAL_TO_CONF(T, F) {\
+    if (i < argc) { \
+        conf.set_##F(T(argv[i])); \
+        i++; \
+    } else { \
+        std::cerr << "Error: must specify " << #F << "\n"; \
+        return false; \
+    } \
+}
+
+bool load_conf(int argc, char** argv, Conf &conf, BenchParams &bench) {
+    int opt;
+    std::string flagstr = ":t:n:c:p:s:l:g:u:de";
+
+    //parse flags
+    while((opt = getopt(argc, argv, flagstr.c_str())) != -1) {
+        switch(opt) {
+
+            FLAG_TO_CONF('p', std::string, idx_preset)
+            FLAG_TO_CONF('c', atoi, max_chunks)
+            FLAG_TO_CONF('s', atof, sim_speed)
+
+            FLAG_TO_COUNTS('t', threads)
+            FLAG_TO_COUNTS('n', channels)
+
+            case 'l':
+                bench.duration = atof(optarg);
+                break;
+
+            case 'g':
+                bench.gap = atof(optarg);
+                break;
+
+            case 'u':
+                bench.poll = atof(optarg);
+                break;
+
+            case 'd':
+                conf.set_realtime_mode(RealtimeParams::Mode::DEPLETE);
+                break;
+
+            case 'e':
+                conf.set_realtime_mode(RealtimeParams::Mode::ENRICH);
+                break;
+
+            case ':':
+            std::cerr << "Error: failed to load flag value\n";
+            return false;
+
+            case '?':
+            std::cerr << "Error: unknown flag\n";
+            return false;
+        }
+    }
+
+    //parse positionals
+    int i = optind;
+
+    POSITIONAL_TO_CONF(std::string, bwa_prefix)
+    POSITIONAL_TO_CONF(std::string, fast5_list)
+
+    if (i < argc) {
+        bench.read_list = argv[i];
+    } else {
+        std::cerr << "Error: must specify read_list\n";
+        return false;
+    }
+
+    return true;
+}
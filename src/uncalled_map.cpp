@@ -16,21 +16,19 @@ int main(int argc, char** argv) {
 
     MapPool pool(conf);
 
-    u64 MAX_SLEEP = 100;
-
     std::cerr << "Mapping\n";
 
-    Timer t;
+    PafWriter out(conf.get_paf_format());
 
+    //update() waits for alignments, no need to sleep
     while (pool.running()) {
-        u64 t0 = t.get();
-        for (Paf p : pool.update()) {
-            p.print_paf();
+        for (Paf &p : pool.update()) {
+            out.write(p);
         }
-        u64 dt = t.get() - t0;
-        if (dt < MAX_SLEEP) usleep(1000*(MAX_SLEEP - dt));
     }
 
+    out.flush();
+
     std::cerr << "Finishing\n";
 
     pool.stop();
@@ -55,7 +53,7 @@ int main(int argc, char** argv) {
 
 bool load_conf(int argc, char** argv, Conf &conf) {
     int opt;
-    std::string flagstr = ":t:n:l:";
+    std::string flagstr = ":t:n:l:b";
 
     #ifdef DEBUG_OUT
     flagstr += "D:";
@@ -69,6 +67,10 @@ bool load_conf(int argc, char** argv, Conf &conf) {
             FLAG_TO_CONF('n', atoi, max_reads)
             FLAG_TO_CONF('l', std::string, read_list)
 
+            case 'b':
+                conf.set_paf_format(PafWriter::Format::BINARY);
+                break;
+
             #ifdef DEBUG_OUT
             FLAG_TO_CONF('D', std::string, dbg_prefix);
             #endif
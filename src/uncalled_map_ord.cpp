@@ -25,15 +25,19 @@ int main(int argc, char** argv) {
     std::cerr << "Mapping\n";
 
 
+    PafWriter out(conf.get_paf_format());
+
     while (pool.running()) {
         u64 t0 = t.get();
-        for (Paf p : pool.update()) {
-            p.print_paf();
+        for (Paf &p : pool.update()) {
+            out.write(p);
         }
         u64 dt = t.get() - t0;
         if (dt < MAX_SLEEP) usleep(1000*(MAX_SLEEP - dt));
     }
 
+    out.flush();
+
     std::cerr << t.lap() << " mapped\n";
 
     std::cerr << "Finishing\n";
@@ -60,7 +64,7 @@ int main(int argc, char** argv) {
 
 void load_conf(int argc, char** argv, Conf &conf) {
     int opt;
-    std::string flagstr = "C:t:n:r:R:c:l:s:w:p:";
+    std::string flagstr = "C:t:n:r:R:c:l:s:w:p:b";
 
     #ifdef DEBUG_OUT
     flagstr += "D:";
@@ -83,6 +87,10 @@ void load_conf(int argc, char** argv, Conf &conf) {
             FLAG_TO_CONF('D', std::string, dbg_prefix);
             #endif
 
+            case 'b':
+            conf.set_paf_format(PafWriter::Format::BINARY);
+            break;
+
             case 'C':
             std::cerr << "Conf: " << optarg << "\n";
             conf.load_toml(std::string(optarg));
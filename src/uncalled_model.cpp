@@ -0,0 +1,101 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <unistd.h>
+#include "pore_model.hpp"
+
+//Converts a pore model (text or binary) to a binary model, or to a 
+//header of constexpr arrays to build in as a preset (see model_r94.inl)
+
+void usage() {
+    std::cerr << "Usage: uncalled_model [options] model_in out\n"
+              << "  -k INT  k-mer length [5]\n"
+              << "  -p STR  write a preset header named STR instead of a binary model\n";
+}
+
+template <KmerLen K>
+bool convert(const std::string &in, const std::string &out, 
+             const std::string &preset) {
+
+    //Text models list template k-mers
+    PoreModel<K> model(in, false);
+    if (!model.is_loaded()) return false;
+
+    if (!preset.empty()) {
+        std::ofstream header(out);
+        model.write_preset(header, preset);
+        return header.good();
+    }
+
+    return model.write_binary(out);
+}
+
+int main(int argc, char** argv) {
+    int opt, k = 5;
+    std::string preset;
+
+    while((opt = getopt(argc, argv, ":k:p:")) != -1) {
+        switch(opt) {
+            case 'k': k = atoi(optarg); break;
+            case 'p': preset = optarg; break;
+
+            case ':':
+            std::cerr << "Error: failed to load flag value\n";
+            usage();
+            return 1;
+
+            case '?':
+            std::cerr << "Error: unknown flag\n";
+            usage();
+            return 1;
+        }
+    }
+
+    if (optind + 2 != argc) {
+        usage();
+        return 1;
+    }
+
+    std::string in = argv[optind], out = argv[optind+1];
+    bool ok;
+
+    switch (k) {
+        case 5: ok = convert<KmerLen::k5>(in, out, preset); break;
+        case 6: ok = convert<KmerLen::k6>(in, out, preset); break;
+        case 7: ok = convert<KmerLen::k7>(in, out, preset); break;
+        case 8: ok = convert<KmerLen::k8>(in, out, preset); break;
+        case 9: ok = convert<KmerLen::k9>(in, out, preset); break;
+        default:
+        std::cerr << "Error: k-mer length must be between 5 and 9\n";
+        return 1;
+    }
+
+    if (!ok) {
+        std::cerr << "Error: failed to write \"" << out << "\"\n";
+        return 1;
+    }
+
+    return 0;
+}
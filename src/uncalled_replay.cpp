@@ -0,0 +1,222 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <unistd.h>
+#include "conf.hpp"
+#include "realtime_pool.hpp"
+#include "chunk_trace.hpp"
+#include "paf_writer.hpp"
+
+//Replays a chunk trace recorded by RealtimePool (see "chunk_trace" 
+//realtime parameter) through a new pool, either at the original timing 
+//or as fast as possible, and outputs the alignments returned
+
+typedef struct {
+    std::string trace;
+    bool fast;
+    float drain_time;
+} ReplayParams;
+
+const ReplayParams REPLAY_PRMS_DEF = {
+    trace      : "",
+    fast       : false,
+    drain_time : 10 //seconds to wait for reads mapping at end of trace
+};
+
+bool load_conf(int argc, char** argv, Conf &conf, ReplayParams &replay);
+
+int main(int argc, char** argv) {
+    std::cerr << "Loading conf\n";
+
+    Conf conf;
+    ReplayParams replay = REPLAY_PRMS_DEF;
+
+    if (!load_conf(argc, argv, conf, replay)) {
+        return 1;
+    }
+
+    ChunkTrace::Reader trace(replay.trace);
+    if (!trace.is_open()) {
+        return 1;
+    }
+
+    //Match the pool the trace was recorded from
+    const ChunkTrace::Header &h = trace.get_header();
+    conf.set_num_channels(h.num_channels);
+    conf.set_max_active_reads(h.max_active_reads);
+    conf.set_realtime_mode((RealtimeParams::Mode) h.realtime_mode);
+    conf.set_chunk_time(h.chunk_time);
+    conf.set_sample_rate(h.sample_rate);
+
+    //Don't record the replay over the trace being read
+    conf.set_chunk_trace("");
+
+    std::cerr << "Loading mappers\n";
+    RealtimePool pool(conf);
+
+    PafWriter out(conf.get_paf_format());
+
+    u64 chunks = 0, updates = 0, mapped = 0, mismatched = 0;
+    double update_time = 0, max_update = 0;
+
+    std::cerr << "Replaying " << replay.trace << "\n";
+    ChunkTrace::Record r;
+    Timer t;
+
+    while (trace.next(r)) {
+        if (!replay.fast) {
+            double dt = r.time - t.get();
+            if (dt > 0) usleep(1000*dt);
+        }
+
+        switch (r.type) {
+            case ChunkTrace::Type::ADD_CHUNK:
+                pool.add_chunk(r.chunk);
+                chunks++;
+                break;
+
+            case ChunkTrace::Type::TRY_ADD_CHUNK:
+                pool.try_add_chunk(r.chunk);
+                chunks++;
+                break;
+
+            case ChunkTrace::Type::UPDATE: {
+                double t0 = t.get();
+                std::vector<MapResult> results = pool.update();
+                double dt = t.get() - t0;
+
+                update_time += dt;
+                max_update = std::max(max_update, dt);
+                updates++;
+
+                //Mapping speed differs from the recorded run
+                if (results.size() != r.count) mismatched++;
+
+                for (MapResult &m : results) {
+                    out.write(std::get<2>(m));
+                }
+                mapped += results.size();
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    double trace_end = t.get();
+
+    //Collect reads still mapping at end of trace
+    while (!pool.all_finished() && 
+           t.get() - trace_end < replay.drain_time * 1000) {
+        for (MapResult &m : pool.update()) {
+            out.write(std::get<2>(m));
+            mapped++;
+        }
+        usleep(1000);
+    }
+
+    if (!pool.all_finished()) {
+        std::cerr << "Warning: reads still mapping after " 
+                  << replay.drain_time << " sec\n";
+    }
+
+    pool.stop_all();
+    out.flush();
+
+    std::cerr << "Replayed " << chunks << " chunks and " 
+              << updates << " updates (" << (trace_end / 1000) << " sec)\n"
+              << "Reads output: " << mapped << "\n"
+              << "Updates returning different read counts: " 
+              << mismatched << "\n"
+              << "Update time mean: " 
+              << (updates > 0 ? update_time / updates : 0) << " ms"
+              << ", max: " << max_update << " ms\n";
+}
+
+#define FLAG_TO_CONF(C, T, F) { \
+    case C: \
+        conf.set_##F(T(optarg)); \
+        break; \
+}
+
+#define POSITIONAL_TO_CONF(T, F) {\
+    if (i < argc) { \
+        conf.set_##F(T(argv[i])); \
+        i++; \
+    } else { \
+        std::cerr << "Error: must specify " << #F << "\n"; \
+        return false; \
+    } \
+}
+
+bool load_conf(int argc, char** argv, Conf &conf, ReplayParams &replay) {
+    int opt;
+    std::string flagstr = ":t:c:p:w:fb";
+
+    //parse flags
+    while((opt = getopt(argc, argv, flagstr.c_str())) != -1) {
+        switch(opt) {
+
+            FLAG_TO_CONF('p', std::string, idx_preset)
+            FLAG_TO_CONF('t', atoi, threads)
+            FLAG_TO_CONF('c', atoi, max_chunks)
+
+            case 'w':
+                replay.drain_time = atof(optarg);
+                break;
+
+            case 'f':
+                replay.fast = true;
+                break;
+
+            case 'b':
+                conf.set_paf_format(PafWriter::Format::BINARY);
+                break;
+
+            case ':':
+            std::cerr << "Error: failed to load flag value\n";
+            return false;
+
+            case '?':
+            std::cerr << "Error: unknown flag\n";
+            return false;
+        }
+    }
+
+    //parse positionals
+    int i = optind;
+
+    POSITIONAL_TO_CONF(std::string, bwa_prefix)
+
+    if (i < argc) {
+        replay.trace = argv[i];
+    } else {
+        std::cerr << "Error: must specify trace\n";
+        return false;
+    }
+
+    return true;
+}
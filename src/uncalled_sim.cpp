@@ -27,11 +27,13 @@ int main(int argc, char** argv) {
 
     const u64 MAX_SLEEP = 100;
 
+    PafWriter out(conf.get_paf_format());
+
     std::cerr << "Starting simulation\n";
     sim.run();
     Timer t;
 
-    std::vector<float> chunk_times(conf.get_num_channels(), t.get());
+    std::vector<float> chunk_times(conf.get_num_channels(), sim.get_runtime());
     std::vector<u32> unblocked(conf.get_num_channels(), 0);
 
     bool deplete = conf.get_realtime_mode() == RealtimeParams::Mode::DEPLETE;
@@ -44,44 +46,65 @@ int main(int argc, char** argv) {
         u16 channel;
         u32 number;
         Paf paf;
-        for (MapResult m : pool.update()) {
-            std::tie(channel, number, paf) = m;
-            float map_time = (t.get() - chunk_times[channel-1])/1000;
-
-            if (paf.is_ended()) {
-                paf.set_float(Paf::Tag::ENDED, map_time);
-                sim.stop_receiving_read(channel, number);
 
-            } else if ((paf.is_mapped() && deplete) || (!paf.is_mapped() && !deplete)) {
-
-                u32 delay = sim.unblock_read(channel, number);
-                paf.set_float(Paf::Tag::EJECT, map_time); 
-                paf.set_int(Paf::Tag::DELAY, delay); 
+        //With a virtual clock, wait for all chunks to be mapped so 
+        //results don't depend on thread timing
+        bool idle;
+        do {
+            for (MapResult m : pool.update()) {
+                std::tie(channel, number, paf) = m;
+                float map_time = sim.get_runtime() - chunk_times[channel-1];
+                float mt = paf.get_float(Paf::Tag::MAP_TIME);
+
+                if (paf.is_ended()) {
+                    paf.set_float(Paf::Tag::ENDED, map_time);
+                    sim.stop_receiving_read(channel, number, mt);
+
+                } else if (paf.is_host() || (paf.is_mapped() && deplete) || 
+                           (!paf.is_mapped() && !deplete)) {
+
+                    u32 delay = sim.unblock_read(channel, number, mt);
+                    paf.set_float(Paf::Tag::EJECT, map_time); 
+                    paf.set_int(Paf::Tag::DELAY, delay); 
+
+                    unblocked[channel-1] = number;
+
+                } else {
+                    sim.stop_receiving_read(channel, number, mt);
+                    paf.set_float(Paf::Tag::KEEP, map_time);
+                }
+                out.write(paf);
+            }
 
-                unblocked[channel-1] = number;
+            idle = !sim.is_virtual() || pool.is_idle();
+            if (!idle) usleep(50);
+        } while (!idle);
 
-            } else {
-                sim.stop_receiving_read(channel, number);
-                paf.set_float(Paf::Tag::KEEP, map_time);
-            }
-            paf.print_paf();
-            std::cout.flush();
-        }
+        out.flush();
 
         for (auto &r : sim.get_read_chunks()) {
             Chunk &ch = r.second;
             if (unblocked[ch.get_channel_idx()] == ch.get_number()) {
-                std::cout << "# recieved chunk from " 
+                //Keep comments out of binary output
+                std::ostream &msg_out = 
+                    conf.get_paf_format() == PafWriter::Format::BINARY ?
+                    std::cerr : std::cout;
+                msg_out << "# recieved chunk from " 
                           << ch.get_id() 
                           << " after unblocking\n";
                 continue;
             } else if (pool.add_chunk(ch)) {
-                chunk_times[ch.get_channel_idx()] = t.get();
+                chunk_times[ch.get_channel_idx()] = sim.get_runtime();
             } else {
                 std::cerr << "Error: failed to add chunk from " << ch.get_id() << std::endl;
             }
         }
 
+        if (sim.is_virtual()) {
+            sim.advance_clock();
+            continue;
+        }
+
         u64 dt = t.get() - t0;
         if (dt < MAX_SLEEP) usleep(1000*(MAX_SLEEP - dt));
     }
@@ -109,7 +132,7 @@ int main(int argc, char** argv) {
 
 bool load_conf(int argc, char** argv, Conf &conf) {
     int opt;
-    std::string flagstr = ":t:c:p:de";
+    std::string flagstr = ":t:c:p:debv";
 
     #ifdef DEBUG_OUT
     flagstr += "D:";
@@ -135,6 +158,14 @@ bool load_conf(int argc, char** argv, Conf &conf) {
                 conf.set_realtime_mode(RealtimeParams::Mode::ENRICH);
                 break;
 
+            case 'b':
+                conf.set_paf_format(PafWriter::Format::BINARY);
+                break;
+
+            case 'v':
+                conf.set_virtual_clock(true);
+                break;
+
             case ':':  
             std::cerr << "Error: failed to load flag value\n";  
             return false;
@@ -0,0 +1,139 @@
+/* MIT License
+ *
+ * Copyright (c) 2018 Sam Kovaka <skovaka@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <unistd.h>
+#include "squiggle_sim.hpp"
+#include "paf_writer.hpp"
+
+//Writes simulated reads to multi-read fast5 files, along with a list of 
+//the fast5s, a list of read IDs and the true read locations in PAF format
+
+const u32 DEF_READ_COUNT = 4000,
+          DEF_FILE_READS = 4000,
+          DEF_CHANNELS = 512;
+
+void usage() {
+    std::cerr << "Usage: uncalled_squiggle [options] <bwa_prefix> <out_prefix>\n"
+              << "  -n INT    number of reads [" << DEF_READ_COUNT << "]\n"
+              << "  -r INT    reads per fast5 file [" << DEF_FILE_READS << "]\n"
+              << "  -c INT    number of channels [" << DEF_CHANNELS << "]\n"
+              << "  -l INT    minimum read length in bases\n"
+              << "  -L INT    maximum read length in bases\n"
+              << "  -w FLOAT  mean samples per base (0 = sample_rate / bp_per_sec)\n"
+              << "  -k FLOAT  gamma shape of samples per base\n"
+              << "  -z FLOAT  noise, as a multiple of the model stdv\n"
+              << "  -f FLOAT  signal drift in pA per second\n"
+              << "  -x FLOAT  fraction of off-target (random sequence) reads\n"
+              << "  -m FILE   pore model (template strand)\n"
+              << "  -s INT    random seed (0 = seed from time)\n"
+              << "Writes <out_prefix>_<i>.fast5, <out_prefix>_fast5s.txt, "
+              << "<out_prefix>_reads.txt and <out_prefix>_truth.paf\n";
+}
+
+int main(int argc, char** argv) {
+    SquiggleSim::Params prms = SquiggleSim::PRMS_DEF;
+    u32 read_count = DEF_READ_COUNT,
+        file_reads = DEF_FILE_READS,
+        channels = DEF_CHANNELS;
+
+    int opt;
+    while((opt = getopt(argc, argv, ":n:r:c:l:L:w:k:z:f:x:m:s:")) != -1) {
+        switch(opt) {
+            case 'n': read_count = atoi(optarg); break;
+            case 'r': file_reads = atoi(optarg); break;
+            case 'c': channels = atoi(optarg); break;
+            case 'l': prms.min_len = atoi(optarg); break;
+            case 'L': prms.max_len = atoi(optarg); break;
+            case 'w': prms.dwell_mean = atof(optarg); break;
+            case 'k': prms.dwell_shape = atof(optarg); break;
+            case 'z': prms.noise = atof(optarg); break;
+            case 'f': prms.drift = atof(optarg); break;
+            case 'x': prms.off_target = atof(optarg); break;
+            case 'm': prms.model_path = optarg; break;
+            case 's': prms.seed = atoi(optarg); break;
+
+            case ':':
+            std::cerr << "Error: failed to load flag value\n";
+            usage();
+            return 1;
+
+            case '?':
+            std::cerr << "Error: unknown flag\n";
+            usage();
+            return 1;
+        }
+    }
+
+    if (argc - optind != 2) {
+        usage();
+        return 1;
+    }
+
+    if (file_reads == 0 || channels == 0) {
+        std::cerr << "Error: reads per file and channels must be positive\n";
+        return 1;
+    }
+
+    prms.bwa_prefix = argv[optind];
+    std::string prefix = argv[optind+1];
+
+    std::cerr << "Loading index\n";
+    SquiggleSim sim(prms);
+
+    std::ofstream fast5_list(prefix + "_fast5s.txt"),
+                  read_list(prefix + "_reads.txt");
+    if (!fast5_list.is_open() || !read_list.is_open()) {
+        std::cerr << "Error: failed to open output lists\n";
+        return 1;
+    }
+
+    PafWriter truth_out(PafWriter::Format::TEXT, prefix + "_truth.paf");
+    if (!truth_out.is_open()) return 1;
+
+    std::vector<ReadBuffer> reads;
+    reads.reserve(file_reads);
+
+    Timer t;
+
+    for (u32 i = 0, f = 0; i < read_count; f++) {
+        reads.clear();
+        for (; i < read_count && reads.size() < file_reads; i++) {
+            Paf truth;
+            reads.push_back(sim.next_read(truth, (i % channels) + 1));
+            truth_out.write(truth);
+            read_list << reads.back().get_id() << "\n";
+        }
+
+        std::string fname = prefix + "_" + std::to_string(f) + ".fast5";
+        if (!SquiggleSim::write_fast5(fname, reads)) return 1;
+        fast5_list << fname << "\n";
+
+        std::cerr << i << " reads written (" << (t.get() / 1000) << " sec)\n";
+    }
+
+    truth_out.flush();
+
+    return 0;
+}
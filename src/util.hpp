@@ -29,6 +29,8 @@
 #include <cstdint>
 #include <chrono>
 #include <cassert>
+#include <cmath>
+#include <cstdio>
 
 #ifdef PYBIND
 #include "pybind11/pybind11.h"
@@ -52,6 +54,55 @@ using i16 = std::int16_t; using u16 = std::uint16_t;
 using i32 = std::int32_t; using u32 = std::uint32_t;
 using i64 = std::int64_t; using u64 = std::uint64_t;
 
+//Fast number formatting for output buffers, avoids iostream overhead
+inline void fmt_uint(std::string &s, u64 v) {
+    char buf[20];
+    char *p = buf + sizeof(buf);
+    do {
+        *--p = '0' + (v % 10);
+        v /= 10;
+    } while (v > 0);
+    s.append(p, buf + sizeof(buf) - p);
+}
+
+inline void fmt_int(std::string &s, i64 v) {
+    if (v < 0) {
+        s.push_back('-');
+        fmt_uint(s, -(u64) v);
+    } else {
+        fmt_uint(s, v);
+    }
+}
+
+//Same output as printf("%.<prec>f"), up to rounding of halfway cases
+inline void fmt_float(std::string &s, double v, u8 prec = 6) {
+    static const u64 POW10[] = {1, 10, 100, 1000, 10000, 100000, 
+                                1000000, 10000000, 100000000, 1000000000};
+
+    //Fall back to printf for large values, NaN, and inf
+    if (!std::isfinite(v) || std::fabs(v) >= 1e12 || prec > 9) {
+        char buf[64];
+        int n = snprintf(buf, sizeof(buf), "%.*f", prec, v);
+        s.append(buf, n);
+        return;
+    }
+
+    if (std::signbit(v)) s.push_back('-');
+
+    u64 scaled = std::llround(std::fabs(v) * POW10[prec]);
+    fmt_uint(s, scaled / POW10[prec]);
+
+    if (prec == 0) return;
+    s.push_back('.');
+
+    //Zero pad fraction
+    u64 frac = scaled % POW10[prec];
+    for (u8 i = prec-1; i > 0 && frac < POW10[i]; i--) {
+        s.push_back('0');
+    }
+    fmt_uint(s, frac);
+}
+
 class Timer {
     private:
         std::chrono::high_resolution_clock::time_point start;
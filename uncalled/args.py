@@ -135,6 +135,26 @@ def add_index_opts(p, conf):
             type=int, default=100, 
             help=""
     )
+    p.add_argument(
+            "-t", "--threads", 
+            type=int, default=conf.threads, 
+            help="Number of threads to use for index construction and reference self-alignment"
+    )
+    p.add_argument(
+            "--sketch", 
+            action="store_true",
+            help="Build a signal sketch of the reference, which can be used to reject off-target reads early with --sketch-events. Intended for small enrichment targets"
+    )
+    p.add_argument(
+            "--mask-iters", 
+            type=int, default=0, 
+            help="Number of high-frequency k-mers to mask before building the BWA index, one per iteration (see masking/README.md)"
+    )
+    p.add_argument(
+            "--mask-k", 
+            type=int, default=10, 
+            help="Length of k-mers masked by --mask-iters"
+    )
     p.add_argument(
             "--probs", 
             type=str, default=None, 
@@ -157,6 +177,26 @@ def add_bwa_opt(p, conf):
             type=str, default=conf.idx_preset, 
             help="Mapping mode"
     )
+    p.add_argument(
+            "-x", "--extra-prefixes", 
+            type=lambda s: s.split(","), default=None, 
+            help="Additional BWA prefixes to map to alongside the main index (comma separated, e.g. a host genome). Each must be processed by \"uncalled index\"."
+    )
+    p.add_argument(
+            "--extra-presets", 
+            type=lambda s: s.split(","), default=None, 
+            help="Mapping modes for each extra index (comma separated, defaults to --idx-preset)"
+    )
+    p.add_argument(
+            "--extra-roles", 
+            type=lambda s: s.split(","), default=None, 
+            help="Role of each extra index (comma separated, \"host\" or \"target\", defaults to \"host\"). Reads mapped to host indexes are ejected in both enrich and deplete modes"
+    )
+    p.add_argument(
+            "--map-index", 
+            type=int, default=conf.map_index, 
+            help="Only map to the index at this position (0 is the main index). Maps to all indexes at once if negative"
+    )
 
 def add_ru_opts(p, conf):
     #TODO: selectively enrich or deplete refs in index
@@ -170,6 +210,11 @@ def add_ru_opts(p, conf):
             type=float, default=1, required=False, 
             help="Length of chunks in seconds"
     )
+    p.add_argument(
+            "--chunk-trace", 
+            type=str, default=conf.chunk_trace, 
+            help="Record all chunks received and mapping updates to this file, which can be replayed with \"uncalled_replay\""
+    )
 
     modes = p.add_mutually_exclusive_group(required=True)
     modes.add_argument(
@@ -226,7 +271,23 @@ def add_sim_opts(p, conf):
     p.add_argument(
             "--sim-speed", 
             type=float, default=conf.sim_speed, 
-            help="")
+            help="Simulated seconds per second of wall time")
+    p.add_argument(
+            "--virtual-clock", 
+            action="store_true", default=None,
+            help="Advance simulated time as fast as reads can be mapped instead of following the wall clock. Each step waits for all chunks to be mapped, so runs are reproducible")
+    p.add_argument(
+            "--sim-step", 
+            type=float, default=conf.sim_step, 
+            help="Simulated seconds per step when using --virtual-clock. Mapping decisions take effect once the read's map time has passed in simulated time")
+    p.add_argument(
+            "--seed", 
+            type=int, default=conf.seed, 
+            help="Random seed (0 = seed from time)")
+    p.add_argument(
+            "--read-lookahead", 
+            type=int, default=conf.read_lookahead, 
+            help="Number of upcoming reads per channel to load into memory ahead of time (0 = load all reads before simulating)")
 
 def add_realtime_opts(p, conf):
     p.add_argument(
@@ -271,6 +332,11 @@ def add_fast5_opts(p, conf):
             type=int, default=None, 
             help=unc.Conf.max_reads.__doc__
     )
+    p.add_argument(
+            "--stream-signal", 
+            action="store_true", default=None,
+            help=unc.Conf.stream_signal.__doc__
+    )
 
 #TODO get defautls from conf
 def add_map_opts(p, conf):
@@ -279,6 +345,11 @@ def add_map_opts(p, conf):
             type=int, default=conf.threads, 
             help="Number of threads to use for mapping"
     )
+    p.add_argument(
+            "--binary-paf", action="store_const", 
+            const=unc.PafWriter.BINARY, dest="paf_format", 
+            help="Output compact binary records instead of text PAF. Convert to PAF with \"uncalled_paf\""
+    )
     p.add_argument(
             "--num-channels", 
             type=int, default=conf.num_channels, 
@@ -289,6 +360,26 @@ def add_map_opts(p, conf):
             type=int, default=conf.max_events, 
             help="Will give up on a read after this many events have been processed"
     )
+    p.add_argument(
+            "--prob-lut-bins", 
+            type=int, default=conf.prob_lut_bins, 
+            help="Precompute k-mer match probabilities for this many event levels (e.g. 2048) instead of computing them for each event. Use at least 2048 to keep mapping decisions unchanged. Uses 4 bytes per level per k-mer. Disabled if 0"
+    )
+    p.add_argument(
+            "--sketch-events", 
+            type=int, default=conf.sketch_events, 
+            help="Score up to this many events of each read against the signal sketch built by \"uncalled index --sketch\" before searching the FM index, and end reads which clearly don't match the target (e.g. 300). Disabled if 0"
+    )
+    p.add_argument(
+            "--sketch-margin", 
+            type=int, default=conf.sketch_margin, 
+            help="Reads are only ended if none of their sketch paths come within this many bases of a hit. Others are ambiguous, and are mapped as usual. Lower values end more off-target reads, but also more noisy on-target reads"
+    )
+    p.add_argument(
+            "--sketch-prob", 
+            type=float, default=conf.sketch_prob, 
+            help="Minimum k-mer match probability for sketch scoring. Lower values keep more on-target reads but are slower"
+    )
 
 def load_conf(argv):
     conf = unc.Conf()
@@ -32,6 +32,7 @@ import uncalled as unc
 from bisect import bisect_left, bisect_right
 
 UNCL_SUFF = ".uncl"
+SKETCH_SUFF = ".sketch"
 AMB_SUFF = ".amb"
 ANN_SUFF = ".ann"
 BWT_SUFF = ".bwt"
@@ -79,25 +80,25 @@ class IndexParameterizer:
         else:
             sample_dist = args.max_sample_dist
 
-        fmlens = unc.self_align(args.bwa_prefix, sample_dist)
-        path_kfmlens = [p[args.kmer_len-1:] if len(p) >= args.kmer_len else [1] for p in fmlens]
+        #Only histograms of the self-alignment paths are returned
+        hist = unc.self_align_hist(args.bwa_prefix, sample_dist, args.kmer_len, 
+                                   args.max_replen, args.threads)
 
-        max_pathlen = 0
-        all_pathlens = [len(p) for p in path_kfmlens if len(p) <= args.max_replen]
-        gt1_counts = np.zeros(max(all_pathlens))
-        for l in all_pathlens:
-            for i in range(l):
-                gt1_counts[i] += 1
+        #Paths by length, last bin counts paths longer than max_replen
+        len_counts = np.array(hist.len_counts)
 
-        max_pathlen = np.flatnonzero(gt1_counts / len(all_pathlens) <= args.pathlen_percentile)[0]
-        max_fmexp = int(np.log2(max([p[0] for p in path_kfmlens])))+1
-        fm_path_mat = np.zeros((max_fmexp, max_pathlen))
+        #Number of paths up to max_replen long which are longer than each length
+        rep_counts = np.cumsum(len_counts[-2::-1])[::-1]
+        gt1_counts = np.append(rep_counts[1:], 0)
 
-        for p in path_kfmlens:
-            for i in range(min(max_pathlen, len(p))):
-                fm_path_mat[int(np.log2(p[i])), i] += 1
-            for i in range(len(p), max_pathlen):
-                fm_path_mat[0, i] += 1
+        max_pathlen = np.flatnonzero(gt1_counts / rep_counts[0] <= args.pathlen_percentile)[0]
+
+        fm_counts = np.array(hist.fm_len_counts, dtype=float)
+        max_fmexp = np.flatnonzero(fm_counts[:,0])[-1] + 1
+        fm_path_mat = fm_counts[:max_fmexp, :max_pathlen]
+
+        #Paths which ended before each location count as length 1
+        fm_path_mat[0] += np.cumsum(len_counts)[:max_pathlen]
 
         mean_fm_locs = list()
         for f in range(max_fmexp):
@@ -200,11 +201,13 @@ class IndexParameterizer:
         self.functions[name] = (fm_ekms, prob, speed)
 
     def write(self):
-        params_out = open(self.out_fname, "w")
+        presets = unc.IndexPresets()
         
         for name, fn in self.functions.items():
             ekms, prob, speed = fn
-            params_out.write("%s\t%s\t%.5f\t%.3f\n" % (name, ",".join(map(str,ekms)), prob, speed))
+            if not presets.add(name, [float(e) for e in ekms], prob, speed):
+                sys.exit(1)
 
-        params_out.close()
+        if not presets.write(self.out_fname):
+            sys.exit(1)
 